@@ -0,0 +1,142 @@
+//// FrameArena.cpp ///////////////////////////////////////////////////////////
+//
+// ⢀⢀⢀⣤⣤⣤⡀⢀⢀⢀⢀⢀⢀⢠⣤⡄⢀⢀⢀⢀⣠⣤⣤⣤⣤⣤⣤⣤⣤⣤⡀⢀⢀⢀⢠⣤⣄⢀⢀⢀⢀⢀⢀⢀⣤⣤⢀⢀⢀⢀⢀⢀⢀⢀⣀⣄⢀⢀⢠⣄⣀⢀⢀⢀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⣿⣷⡀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡟⡛⡛⡛⡛⡛⡛⡛⢁⢀⢀⢀⢀⢻⣿⣦⢀⢀⢀⢀⢠⣾⡿⢃⢀⢀⢀⢀⢀⣠⣾⣿⢿⡟⢀⢀⡙⢿⢿⣿⣦⡀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⡛⣿⣷⡀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡙⣿⡷⢀⢀⣰⣿⡟⢁⢀⢀⢀⢀⢀⣾⣿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⣿⡆⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⡈⢿⣷⡄⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣇⣀⣀⣀⣀⣀⣀⣀⢀⢀⢀⢀⢀⢀⢀⡈⢀⢀⣼⣿⢏⢀⢀⢀⢀⢀⢀⣼⣿⡏⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡘⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⡈⢿⣿⡄⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣿⢿⢿⢿⢿⢿⢿⢿⢇⢀⢀⢀⢀⢀⢀⢀⢠⣾⣿⣧⡀⢀⢀⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⡈⢿⣿⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣰⣿⡟⡛⣿⣷⡄⢀⢀⢀⢀⢀⢿⣿⣇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⡈⢿⢀⢀⢸⣿⡇⢀⢀⢀⢀⡛⡟⢁⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⡟⢀⢀⡈⢿⣿⣄⢀⢀⢀⢀⡘⣿⣿⣄⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⢏⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⢀⣀⣀⣀⣀⣀⣀⣀⣀⣀⡀⢀⢀⢀⣠⣾⡿⢃⢀⢀⢀⢀⢀⢻⣿⣧⡀⢀⢀⢀⡈⢻⣿⣷⣦⣄⢀⢀⣠⣤⣶⣿⡿⢋⢀⢀⢀⢀
+// ⢀⢀⢀⢿⢿⢀⢀⢀⢀⢀⢀⢀⢀⢸⢿⢃⢀⢀⢀⢀⢻⢿⢿⢿⢿⢿⢿⢿⢿⢿⢃⢀⢀⢀⢿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⡗⢀⢀⢀⢀⢀⡈⡉⡛⡛⢀⢀⢹⡛⢋⢁⢀⢀⢀⢀⢀⢀
+//
+//  Author:      Parallax Engine Team
+//  Date:        16/10/2026
+//  Description: Source file for the per-frame linear arena allocator
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include "FrameArena.hpp"
+
+#include <algorithm>
+#include <cstdint>
+
+namespace parallax {
+
+    FrameArena::Block::Block(const std::size_t size)
+        : data(std::make_unique_for_overwrite<std::byte[]>(size)), size(size)
+    {
+    }
+
+    FrameArena::FrameArena(const std::size_t blockSize) : m_blockSize(blockSize)
+    {
+    }
+
+    FrameArena &FrameArena::getInstance()
+    {
+        static FrameArena instance;
+        return instance;
+    }
+
+    void *FrameArena::tryAllocate(Block &block, const std::size_t bytes, const std::size_t alignment, std::size_t &consumed)
+    {
+        const auto base = reinterpret_cast<std::uintptr_t>(block.data.get());
+        std::size_t used = block.used.load(std::memory_order_relaxed);
+        while (true) {
+            const std::size_t start = ((base + used + alignment - 1) & ~(alignment - 1)) - base;
+            if (start + bytes > block.size)
+                return nullptr;
+            if (block.used.compare_exchange_weak(used, start + bytes, std::memory_order_relaxed)) {
+                consumed = start + bytes - used;
+                return block.data.get() + start;
+            }
+        }
+    }
+
+    void *FrameArena::do_allocate(const std::size_t bytes, const std::size_t alignment)
+    {
+        while (true) {
+            Block *block = m_current.load(std::memory_order_acquire);
+            std::size_t consumed = 0;
+            if (block) {
+                if (void *p = tryAllocate(*block, bytes, alignment, consumed)) {
+                    m_allocations.fetch_add(1, std::memory_order_relaxed);
+                    m_bytesAllocated.fetch_add(consumed, std::memory_order_relaxed);
+                    return p;
+                }
+            }
+
+            // Out of space: the first thread to get here adds a block, the others retry in it
+            std::lock_guard lock(m_mutex);
+            if (m_current.load(std::memory_order_relaxed) == block) {
+                addBlock(std::max(m_blockSize, bytes + alignment));
+                m_upstreamAllocations.fetch_add(1, std::memory_order_relaxed);
+            }
+        }
+    }
+
+    void FrameArena::do_deallocate(void *p, const std::size_t bytes, std::size_t)
+    {
+        // Only the last allocation of the current block can be given back, typically a temporary
+        // container growing or going out of scope right away
+        Block *block = m_current.load(std::memory_order_acquire);
+        if (!block)
+            return;
+        const auto address = reinterpret_cast<std::uintptr_t>(p);
+        const auto base = reinterpret_cast<std::uintptr_t>(block->data.get());
+        if (address < base || address + bytes > base + block->size)
+            return;
+        std::size_t end = address + bytes - base;
+        block->used.compare_exchange_strong(end, address - base, std::memory_order_relaxed);
+    }
+
+    bool FrameArena::do_is_equal(const memory_resource &other) const noexcept
+    {
+        return this == &other;
+    }
+
+    void FrameArena::addBlock(const std::size_t minSize)
+    {
+        m_blocks.push_back(std::make_unique<Block>(minSize));
+        m_current.store(m_blocks.back().get(), std::memory_order_release);
+    }
+
+    std::size_t FrameArena::capacity() const
+    {
+        std::size_t total = 0;
+        for (const auto &block : m_blocks)
+            total += block->size;
+        return total;
+    }
+
+    FrameAllocationStats FrameArena::reset()
+    {
+        const FrameAllocationStats frameStats = stats();
+
+        std::lock_guard lock(m_mutex);
+        if (m_blocks.size() > 1) {
+            // The frame did not fit in one block, the next ones get a block as large as all of them
+            const std::size_t total = capacity();
+            m_blocks.clear();
+            addBlock(total);
+        } else if (!m_blocks.empty()) {
+            m_blocks.back()->used.store(0, std::memory_order_relaxed);
+        }
+
+        m_allocations.store(0, std::memory_order_relaxed);
+        m_bytesAllocated.store(0, std::memory_order_relaxed);
+        m_upstreamAllocations.store(0, std::memory_order_relaxed);
+        return frameStats;
+    }
+
+    FrameAllocationStats FrameArena::stats() const
+    {
+        std::lock_guard lock(m_mutex);
+        return {
+            m_allocations.load(std::memory_order_relaxed),
+            m_bytesAllocated.load(std::memory_order_relaxed),
+            m_upstreamAllocations.load(std::memory_order_relaxed),
+            capacity()
+        };
+    }
+}
@@ -0,0 +1,121 @@
+//// FrameArena.hpp ///////////////////////////////////////////////////////////
+//
+// ⢀⢀⢀⣤⣤⣤⡀⢀⢀⢀⢀⢀⢀⢠⣤⡄⢀⢀⢀⢀⣠⣤⣤⣤⣤⣤⣤⣤⣤⣤⡀⢀⢀⢀⢠⣤⣄⢀⢀⢀⢀⢀⢀⢀⣤⣤⢀⢀⢀⢀⢀⢀⢀⢀⣀⣄⢀⢀⢠⣄⣀⢀⢀⢀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⣿⣷⡀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡟⡛⡛⡛⡛⡛⡛⡛⢁⢀⢀⢀⢀⢻⣿⣦⢀⢀⢀⢀⢠⣾⡿⢃⢀⢀⢀⢀⢀⣠⣾⣿⢿⡟⢀⢀⡙⢿⢿⣿⣦⡀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⡛⣿⣷⡀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡙⣿⡷⢀⢀⣰⣿⡟⢁⢀⢀⢀⢀⢀⣾⣿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⣿⡆⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⡈⢿⣷⡄⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣇⣀⣀⣀⣀⣀⣀⣀⢀⢀⢀⢀⢀⢀⢀⡈⢀⢀⣼⣿⢏⢀⢀⢀⢀⢀⢀⣼⣿⡏⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡘⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⡈⢿⣿⡄⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣿⢿⢿⢿⢿⢿⢿⢿⢇⢀⢀⢀⢀⢀⢀⢀⢠⣾⣿⣧⡀⢀⢀⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⡈⢿⣿⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣰⣿⡟⡛⣿⣷⡄⢀⢀⢀⢀⢀⢿⣿⣇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⡈⢿⢀⢀⢸⣿⡇⢀⢀⢀⢀⡛⡟⢁⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⡟⢀⢀⡈⢿⣿⣄⢀⢀⢀⢀⡘⣿⣿⣄⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⢏⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⢀⣀⣀⣀⣀⣀⣀⣀⣀⣀⡀⢀⢀⢀⣠⣾⡿⢃⢀⢀⢀⢀⢀⢻⣿⣧⡀⢀⢀⢀⡈⢻⣿⣷⣦⣄⢀⢀⣠⣤⣶⣿⡿⢋⢀⢀⢀⢀
+// ⢀⢀⢀⢿⢿⢀⢀⢀⢀⢀⢀⢀⢀⢸⢿⢃⢀⢀⢀⢀⢻⢿⢿⢿⢿⢿⢿⢿⢿⢿⢃⢀⢀⢀⢿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⡗⢀⢀⢀⢀⢀⡈⡉⡛⡛⢀⢀⢹⡛⢋⢁⢀⢀⢀⢀⢀⢀
+//
+//  Author:      Parallax Engine Team
+//  Date:        16/10/2026
+//  Description: Header file for the per-frame linear arena allocator
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+#include <mutex>
+#include <vector>
+
+namespace parallax {
+
+    /**
+     * @brief Allocation counters of the frame arena, reset every frame
+     */
+    struct FrameAllocationStats {
+        std::size_t allocations = 0;         ///< Allocations served by the arena
+        std::size_t bytesAllocated = 0;      ///< Bytes handed out, alignment padding included
+        std::size_t upstreamAllocations = 0; ///< Blocks requested from the heap because the arena ran out
+        std::size_t capacity = 0;            ///< Bytes owned by the arena
+    };
+
+    /**
+     * @class FrameArena
+     * @brief Linear allocator for memory that only lives until the end of the frame
+     *
+     * Allocations bump an offset inside the current block, deallocations are free (only the most
+     * recent allocation gives its bytes back). reset() releases everything at once, it must only
+     * be called once nothing allocated from the arena is alive anymore, which the application does
+     * in endFrame.
+     *
+     * Allocating is thread-safe: the offset is bumped with a compare-exchange, only running out of
+     * space takes a lock. When a frame needed several blocks, reset() merges them into a single one
+     * so that the following frames do not go back to the heap.
+     *
+     * Containers use it through std::pmr::polymorphic_allocator.
+     */
+    class FrameArena final : public std::pmr::memory_resource {
+        public:
+            static constexpr std::size_t DEFAULT_BLOCK_SIZE = 1024 * 1024;
+
+            /**
+             * @brief Creates an empty arena, the first block is allocated on first use
+             *
+             * @param blockSize Size of the blocks requested from the heap
+             */
+            explicit FrameArena(std::size_t blockSize = DEFAULT_BLOCK_SIZE);
+            ~FrameArena() override = default;
+
+            FrameArena(const FrameArena&) = delete;
+            FrameArena& operator=(const FrameArena&) = delete;
+            FrameArena(FrameArena&&) = delete;
+            FrameArena& operator=(FrameArena&&) = delete;
+
+            /**
+             * @brief Gets the arena shared by the whole engine, reset by Application::endFrame
+             *
+             * @return Reference to the frame arena
+             */
+            static FrameArena &getInstance();
+
+            /**
+             * @brief Releases every allocation and starts a new frame
+             *
+             * Must not run concurrently with an allocation.
+             *
+             * @return FrameAllocationStats Counters of the frame that just ended
+             */
+            FrameAllocationStats reset();
+
+            /**
+             * @brief Counters of the frame in progress
+             *
+             * @return FrameAllocationStats Allocations made since the last reset
+             */
+            [[nodiscard]] FrameAllocationStats stats() const;
+
+        private:
+            struct Block {
+                explicit Block(std::size_t size);
+
+                std::unique_ptr<std::byte[]> data;
+                std::size_t size;
+                std::atomic<std::size_t> used{0};
+            };
+
+            void *do_allocate(std::size_t bytes, std::size_t alignment) override;
+            void do_deallocate(void *p, std::size_t bytes, std::size_t alignment) override;
+            [[nodiscard]] bool do_is_equal(const memory_resource &other) const noexcept override;
+
+            static void *tryAllocate(Block &block, std::size_t bytes, std::size_t alignment, std::size_t &consumed);
+            void addBlock(std::size_t minSize);
+            [[nodiscard]] std::size_t capacity() const;
+
+            std::size_t m_blockSize;
+            std::vector<std::unique_ptr<Block>> m_blocks; ///< Every block of the frame, the last one is current
+            std::atomic<Block *> m_current{nullptr};
+            mutable std::mutex m_mutex;                   ///< Guards m_blocks
+
+            std::atomic<std::size_t> m_allocations{0};
+            std::atomic<std::size_t> m_bytesAllocated{0};
+            std::atomic<std::size_t> m_upstreamAllocations{0};
+    };
+}
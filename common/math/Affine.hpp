@@ -0,0 +1,66 @@
+//// Affine.hpp ///////////////////////////////////////////////////////////////
+//
+// ⢀⢀⢀⣤⣤⣤⡀⢀⢀⢀⢀⢀⢀⢠⣤⡄⢀⢀⢀⢀⣠⣤⣤⣤⣤⣤⣤⣤⣤⣤⡀⢀⢀⢀⢠⣤⣄⢀⢀⢀⢀⢀⢀⢀⣤⣤⢀⢀⢀⢀⢀⢀⢀⢀⣀⣄⢀⢀⢠⣄⣀⢀⢀⢀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⣿⣷⡀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡟⡛⡛⡛⡛⡛⡛⡛⢁⢀⢀⢀⢀⢻⣿⣦⢀⢀⢀⢀⢠⣾⡿⢃⢀⢀⢀⢀⢀⣠⣾⣿⢿⡟⢀⢀⡙⢿⢿⣿⣦⡀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⡛⣿⣷⡀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡙⣿⡷⢀⢀⣰⣿⡟⢁⢀⢀⢀⢀⢀⣾⣿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⣿⡆⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⡈⢿⣷⡄⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣇⣀⣀⣀⣀⣀⣀⣀⢀⢀⢀⢀⢀⢀⢀⡈⢀⢀⣼⣿⢏⢀⢀⢀⢀⢀⢀⣼⣿⡏⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡘⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⡈⢿⣿⡄⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣿⢿⢿⢿⢿⢿⢿⢿⢇⢀⢀⢀⢀⢀⢀⢀⢠⣾⣿⣧⡀⢀⢀⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⡈⢿⣿⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣰⣿⡟⡛⣿⣷⡄⢀⢀⢀⢀⢀⢿⣿⣇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⡈⢿⢀⢀⢸⣿⡇⢀⢀⢀⢀⡛⡟⢁⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⡟⢀⢀⡈⢿⣿⣄⢀⢀⢀⢀⡘⣿⣿⣄⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⢏⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⢀⣀⣀⣀⣀⣀⣀⣀⣀⣀⡀⢀⢀⢀⣠⣾⡿⢃⢀⢀⢀⢀⢀⢻⣿⣧⡀⢀⢀⢀⡈⢻⣿⣷⣦⣄⢀⢀⣠⣤⣶⣿⡿⢋⢀⢀⢀⢀
+// ⢀⢀⢀⢿⢿⢀⢀⢀⢀⢀⢀⢀⢀⢸⢿⢃⢀⢀⢀⢀⢻⢿⢿⢿⢿⢿⢿⢿⢿⢿⢃⢀⢀⢀⢿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⡗⢀⢀⢀⢀⢀⡈⡉⡛⡛⢀⢀⢹⡛⢋⢁⢀⢀⢀⢀⢀⢀
+//
+//  Author:      Parallax Engine Team
+//  Date:        16/10/2026
+//  Description: Helpers for affine matrices stored as glm::mat4x3
+//
+///////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include <glm/glm.hpp>
+
+namespace parallax::math {
+    /**
+     * @brief Expands an affine matrix to a 4x4 matrix
+     *
+     * glm::mat4x3 stores the four columns of a 4x4 matrix without their constant last row,
+     * which is restored as (0, 0, 0, 1).
+     *
+     * @param affine The affine matrix
+     * @return glm::mat4 The equivalent 4x4 matrix
+     */
+    inline glm::mat4 affineToMat4(const glm::mat4x3 &affine)
+    {
+        return {glm::vec4(affine[0], 0.0f), glm::vec4(affine[1], 0.0f),
+                glm::vec4(affine[2], 0.0f), glm::vec4(affine[3], 1.0f)};
+    }
+
+    /**
+     * @brief Drops the last row of a 4x4 matrix
+     *
+     * @param matrix A 4x4 matrix whose last row is (0, 0, 0, 1)
+     * @return glm::mat4x3 The affine part of the matrix
+     */
+    inline glm::mat4x3 mat4ToAffine(const glm::mat4 &matrix)
+    {
+        return {glm::vec3(matrix[0]), glm::vec3(matrix[1]), glm::vec3(matrix[2]), glm::vec3(matrix[3])};
+    }
+
+    /**
+     * @brief Composes two affine transforms, child being applied first
+     *
+     * Uses the operations of the 4x4 product minus the terms multiplied by the constant row,
+     * with 36 multiplications instead of 64.
+     *
+     * @param parent The outer transform
+     * @param child The inner transform
+     * @return glm::mat4x3 The affine part of parent * child
+     */
+    inline glm::mat4x3 composeAffine(const glm::mat4x3 &parent, const glm::mat4x3 &child)
+    {
+        return {parent[0] * child[0].x + parent[1] * child[0].y + parent[2] * child[0].z,
+                parent[0] * child[1].x + parent[1] * child[1].y + parent[2] * child[1].z,
+                parent[0] * child[2].x + parent[1] * child[2].y + parent[2] * child[2].z,
+                parent[0] * child[3].x + parent[1] * child[3].y + parent[2] * child[3].z + parent[3]};
+    }
+}
@@ -0,0 +1,138 @@
+//// Bounds.hpp ///////////////////////////////////////////////////////////////
+//
+// ⢀⢀⢀⣤⣤⣤⡀⢀⢀⢀⢀⢀⢀⢠⣤⡄⢀⢀⢀⢀⣠⣤⣤⣤⣤⣤⣤⣤⣤⣤⡀⢀⢀⢀⢠⣤⣄⢀⢀⢀⢀⢀⢀⢀⣤⣤⢀⢀⢀⢀⢀⢀⢀⢀⣀⣄⢀⢀⢠⣄⣀⢀⢀⢀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⣿⣷⡀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡟⡛⡛⡛⡛⡛⡛⡛⢁⢀⢀⢀⢀⢻⣿⣦⢀⢀⢀⢀⢠⣾⡿⢃⢀⢀⢀⢀⢀⣠⣾⣿⢿⡟⢀⢀⡙⢿⢿⣿⣦⡀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⡛⣿⣷⡀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡙⣿⡷⢀⢀⣰⣿⡟⢁⢀⢀⢀⢀⢀⣾⣿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⣿⡆⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⡈⢿⣷⡄⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣇⣀⣀⣀⣀⣀⣀⣀⢀⢀⢀⢀⢀⢀⢀⡈⢀⢀⣼⣿⢏⢀⢀⢀⢀⢀⢀⣼⣿⡏⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡘⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⡈⢿⣿⡄⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣿⢿⢿⢿⢿⢿⢿⢿⢇⢀⢀⢀⢀⢀⢀⢀⢠⣾⣿⣧⡀⢀⢀⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⡈⢿⣿⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣰⣿⡟⡛⣿⣷⡄⢀⢀⢀⢀⢀⢿⣿⣇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⡈⢿⢀⢀⢸⣿⡇⢀⢀⢀⢀⡛⡟⢁⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⡟⢀⢀⡈⢿⣿⣄⢀⢀⢀⢀⡘⣿⣿⣄⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⢏⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⢀⣀⣀⣀⣀⣀⣀⣀⣀⣀⡀⢀⢀⢀⣠⣾⡿⢃⢀⢀⢀⢀⢀⢻⣿⣧⡀⢀⢀⢀⡈⢻⣿⣷⣦⣄⢀⢀⣠⣤⣶⣿⡿⢋⢀⢀⢀⢀
+// ⢀⢀⢀⢿⢿⢀⢀⢀⢀⢀⢀⢀⢀⢸⢿⢃⢀⢀⢀⢀⢻⢿⢿⢿⢿⢿⢿⢿⢿⢿⢃⢀⢀⢀⢿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⡗⢀⢀⢀⢀⢀⡈⡉⡛⡛⢀⢀⢹⡛⢋⢁⢀⢀⢀⢀⢀⢀
+//
+//  Author:      Parallax Engine Team
+//  Date:        16/10/2026
+//  Description: Header file for the bounding box and view frustum utils
+//
+///////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+#include <glm/glm.hpp>
+
+namespace parallax::math {
+    /**
+     * @brief Axis-aligned bounding box
+     *
+     * The default box is empty (min above max). Bounds left empty are treated as unknown:
+     * their world box is infinite, so the mesh is never culled.
+     */
+    struct AABB {
+        glm::vec3 min{std::numeric_limits<float>::max()};
+        glm::vec3 max{std::numeric_limits<float>::lowest()};
+
+        [[nodiscard]] bool isEmpty() const
+        {
+            return min.x > max.x || min.y > max.y || min.z > max.z;
+        }
+
+        /**
+         * @brief Grows the box to contain a point
+         */
+        void expand(const glm::vec3 &point)
+        {
+            min = {std::min(min.x, point.x), std::min(min.y, point.y), std::min(min.z, point.z)};
+            max = {std::max(max.x, point.x), std::max(max.y, point.y), std::max(max.z, point.z)};
+        }
+    };
+
+    /**
+     * @brief Box given by its center and half size, the form used by the frustum test
+     */
+    struct CenterExtents {
+        glm::vec3 center{0.0f};
+        glm::vec3 extents{0.0f};
+    };
+
+    /**
+     * @brief Gets the world space box enclosing a local box moved by an affine transform
+     *
+     * The world center is the transformed local center, each world half size is the sum of the
+     * local half sizes weighted by the absolute values of the matrix row.
+     *
+     * @param localBounds Bounds in the local space of the mesh
+     * @param worldMatrix Affine local-to-world matrix
+     * @return CenterExtents The world box, infinite if the local bounds are empty
+     */
+    inline CenterExtents transformBounds(const AABB &localBounds, const glm::mat4x3 &worldMatrix)
+    {
+        if (localBounds.isEmpty()) {
+            constexpr float infinity = std::numeric_limits<float>::infinity();
+            return {worldMatrix[3], glm::vec3(infinity)};
+        }
+
+        const glm::vec3 localCenter = (localBounds.min + localBounds.max) * 0.5f;
+        const glm::vec3 localExtents = (localBounds.max - localBounds.min) * 0.5f;
+        CenterExtents world;
+        for (int row = 0; row < 3; ++row) {
+            world.center[row] = worldMatrix[0][row] * localCenter.x + worldMatrix[1][row] * localCenter.y +
+                                worldMatrix[2][row] * localCenter.z + worldMatrix[3][row];
+            world.extents[row] = std::abs(worldMatrix[0][row]) * localExtents.x +
+                                 std::abs(worldMatrix[1][row]) * localExtents.y +
+                                 std::abs(worldMatrix[2][row]) * localExtents.z;
+        }
+        return world;
+    }
+
+    /**
+     * @brief The six planes bounding what a camera sees
+     *
+     * Each plane is (normal, distance) with the normal pointing inside, a point p is on the
+     * inner side when dot(normal, p) + distance >= 0. The default frustum has null planes,
+     * which keep every box.
+     */
+    struct Frustum {
+        enum Plane { Left, Right, Bottom, Top, Near, Far, Count };
+
+        std::array<glm::vec4, Count> planes{};
+    };
+
+    /**
+     * @brief Extracts the frustum planes of a view-projection matrix
+     *
+     * Planes are the sums and differences of the last row with the other rows of the matrix
+     * (Gribb-Hartmann), for a clip space depth in [-1, 1]. They are normalized so that the
+     * plane equations give world space distances.
+     *
+     * @param viewProjection Combined view and projection matrix of the camera
+     * @return Frustum The world space planes of the frustum
+     */
+    inline Frustum extractFrustum(const glm::mat4 &viewProjection)
+    {
+        const auto row = [&viewProjection](const int index) {
+            return glm::vec4(viewProjection[0][index], viewProjection[1][index],
+                             viewProjection[2][index], viewProjection[3][index]);
+        };
+        const glm::vec4 x = row(0);
+        const glm::vec4 y = row(1);
+        const glm::vec4 z = row(2);
+        const glm::vec4 w = row(3);
+
+        Frustum frustum;
+        frustum.planes[Frustum::Left] = w + x;
+        frustum.planes[Frustum::Right] = w - x;
+        frustum.planes[Frustum::Bottom] = w + y;
+        frustum.planes[Frustum::Top] = w - y;
+        frustum.planes[Frustum::Near] = w + z;
+        frustum.planes[Frustum::Far] = w - z;
+        for (glm::vec4 &plane : frustum.planes) {
+            const float length = std::sqrt(plane.x * plane.x + plane.y * plane.y + plane.z * plane.z);
+            if (length > 0.0f)
+                plane = plane * (1.0f / length);
+        }
+        return frustum;
+    }
+}
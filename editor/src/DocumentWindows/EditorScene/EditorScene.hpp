@@ -304,6 +304,15 @@ namespace parallax::editor
          * rendered scene, and updates viewport bounds for input handling.
          */
         void renderView();
+
+        /**
+         * @brief Renders the rendering stats of the active camera over the bottom-left corner of the viewport.
+         *
+         * Shows how many meshes of the scene were left after frustum culling, the draw calls and the
+         * shader / VAO binds issued or skipped, and how many transform matrices were rebuilt in the
+         * last rendered frame.
+         */
+        void renderStats() const;
         void renderNoActiveCamera() const;
         void renderPrimitiveCreationPopup(const Primitives& primitive) const;
         void renderNewEntityPopup();
@@ -316,7 +325,6 @@ namespace parallax::editor
         int sampleEntityTexture(float mx, float my) const;
         static ecs::Entity findRootParent(ecs::Entity entityId);
         void selectEntityHierarchy(ecs::Entity entityId, bool isCtrlPressed);
-        void selectModelChildren(const std::vector<ecs::Entity>& children, bool isCtrlPressed);
         void updateSelection(int entityId, bool isShiftPressed, bool isCtrlPressed);
         void updateWindowState();
 
@@ -18,6 +18,8 @@
 
 #include "EditorScene.hpp"
 #include "components/Parent.hpp"
+#include "components/StaticMesh.hpp"
+#include "math/Affine.hpp"
 #include "context/Selector.hpp"
 #include "context/ActionManager.hpp"
 
@@ -81,7 +83,7 @@ namespace parallax::editor {
         if (!parentTransform)
             return {1.0f}; // Parent has no transform, return identity
 
-        return parentTransform->get().worldMatrix;
+        return math::affineToMat4(parentTransform->get().worldMatrix);
     }
 
     static glm::mat4 calculateWorldMatrix(const components::TransformComponent& transform)
@@ -106,7 +108,7 @@ namespace parallax::editor {
         const glm::mat4 localMatrix = calculateWorldMatrix(transform->get());
 
         // Update world matrix
-        transform->get().worldMatrix = parentWorldMatrix * localMatrix;
+        transform->get().worldMatrix = math::mat4ToAffine(parentWorldMatrix * localMatrix);
     }
 
     static void updateEntityWorldMatrixRecursive(const ecs::Entity entity)
@@ -141,7 +143,7 @@ namespace parallax::editor {
         );
 
         transform.quat = glm::normalize(transform.quat);
-        transform.worldMatrix = worldMatrix;
+        transform.worldMatrix = math::mat4ToAffine(worldMatrix);
     }
 
     float* EditorScene::getSnapSettingsForOperation(const ImGuizmo::OPERATION operation)
@@ -185,7 +187,7 @@ namespace parallax::editor {
             if (!entityTransform) continue;
 
             // Apply world space delta and convert back to local space
-            glm::mat4 newEntityWorldMatrix = deltaMatrix * entityTransform->get().worldMatrix;
+            glm::mat4 newEntityWorldMatrix = deltaMatrix * math::affineToMat4(entityTransform->get().worldMatrix);
             updateLocalTransformFromWorld(entityTransform->get(), newEntityWorldMatrix, entity);
         }
     }
@@ -296,8 +298,10 @@ namespace parallax::editor {
         const glm::mat4 Sscale      = glm::scale(glm::mat4(1.0f), primaryTransform->get().size);
         const glm::mat4 M0          = parentWorld * Tpos * Rrot * Sscale;
 
-        // 2) “centroid offset” = T(centroidLocal)
-        const glm::mat4 C_offset    = glm::translate(glm::mat4(1.0f), primaryTransform->get().localCenter);
+        // 2) “centroid offset” = T(centroidLocal), only meshes have a centroid
+        const auto primaryMesh      = coord->tryGetComponent<components::StaticMeshComponent>(primaryEntity);
+        const glm::vec3 localCenter = primaryMesh ? primaryMesh->get().localCenter : glm::vec3(0.0f);
+        const glm::mat4 C_offset    = glm::translate(glm::mat4(1.0f), localCenter);
 
         // 3) M1 = M0 * C_offset
         glm::mat4 worldTransformMatrix = M0 * C_offset;
@@ -344,7 +348,7 @@ namespace parallax::editor {
                 if (!tComp) continue;
 
                 // “OtherEntity_world₀” = tComp->worldMatrix
-                glm::mat4 otherWorldMatrix_0 = tComp->get().worldMatrix;
+                glm::mat4 otherWorldMatrix_0 = math::affineToMat4(tComp->get().worldMatrix);
                 // “OtherEntity_world₁” = deltaMatrix * otherWorldMatrix_0
                 glm::mat4 otherWorldMatrix_1 = deltaMatrix * otherWorldMatrix_0;
 
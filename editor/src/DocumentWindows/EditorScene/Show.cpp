@@ -26,6 +26,7 @@
 #include "context/actions/EntityActions.hpp"
 #include "context/ActionManager.hpp"
 #include <imgui_internal.h>
+#include <array>
 
 namespace parallax::editor
 {
@@ -161,6 +162,30 @@ namespace parallax::editor
         m_viewportBounds[1] = viewportMax;
     }
 
+    void EditorScene::renderStats() const
+    {
+        const auto &cameraComponent = Application::m_coordinator->getComponent<components::CameraComponent>(m_activeCamera);
+        const components::CameraCullingStats &culling = cameraComponent.cullingStats;
+        const renderer::DrawStats &draws = cameraComponent.drawStats;
+        const WorldState::WorldStats &worldStats = getApp().getWorldState().stats;
+
+        const std::array lines = {
+            std::format("Meshes: {} / {} visible", culling.visibleMeshes, culling.totalMeshes),
+            std::format("Draw calls: {} ({} instances)", draws.drawCalls, draws.instances),
+            std::format("Shader binds: {} issued / {} skipped", draws.shaderBinds, draws.shaderBindsSkipped),
+            std::format("VAO binds: {} issued / {} skipped", draws.vaoBinds, draws.vaoBindsSkipped),
+            std::format("Transforms: {} local / {} world rebuilt",
+                        worldStats.transforms.localMatrices, worldStats.transforms.worldMatrices)
+        };
+        const float lineHeight = ImGui::GetTextLineHeightWithSpacing();
+        ImVec2 textPos(m_viewportBounds[0].x + 10.0f,
+                       m_viewportBounds[1].y - 10.0f - lineHeight * static_cast<float>(lines.size()));
+        for (const std::string &text : lines) {
+            ImGui::GetWindowDrawList()->AddText(textPos, IM_COL32(255, 255, 255, 200), text.c_str());
+            textPos.y += lineHeight;
+        }
+    }
+
     void EditorScene::show()
     {
         // Handle deferred dock split before rendering
@@ -229,6 +254,7 @@ namespace parallax::editor
                 renderView();
                 renderGizmo();
                 renderToolbar();
+                renderStats();
             }
 
             if (m_popupManager.showPopup("Add new entity popup"))
@@ -118,36 +118,21 @@ namespace parallax::editor {
     void EditorScene::selectEntityHierarchy(const ecs::Entity entityId, const bool isCtrlPressed)
     {
         const auto &coord = Application::m_coordinator;
+        auto &selector = Selector::get();
 
-        const auto uuid = coord->tryGetComponent<components::UuidComponent>(entityId);
-        if (uuid) {
-            const SelectionType selType = getSelectionType(static_cast<int>(entityId));
+        // The entity and its descendants are contiguous in the hierarchy
+        const std::span<const ecs::Entity> subtree = coord->getHierarchy().subtree(entityId);
+        const std::span<const ecs::Entity> entities = subtree.empty() ? std::span<const ecs::Entity>(&entityId, 1) : subtree;
+        for (const ecs::Entity entity : entities) {
+            const auto uuid = coord->tryGetComponent<components::UuidComponent>(entity);
+            if (!uuid)
+                continue;
 
-            auto &selector = Selector::get();
+            const SelectionType selType = getSelectionType(static_cast<int>(entity));
             if (isCtrlPressed)
-                selector.toggleSelection(uuid->get().uuid, static_cast<int>(entityId), selType);
+                selector.toggleSelection(uuid->get().uuid, static_cast<int>(entity), selType);
             else
-                selector.addToSelection(uuid->get().uuid, static_cast<int>(entityId), selType);
-        }
-
-        if (coord->entityHasComponent<components::TransformComponent>(entityId)) {
-            const auto& transform = coord->getComponent<components::TransformComponent>(entityId);
-            selectModelChildren(transform.children, isCtrlPressed);
-        }
-    }
-
-    void EditorScene::selectModelChildren(const std::vector<ecs::Entity>& children, const bool isCtrlPressed)
-    {
-        const auto &coord = Application::m_coordinator;
-
-        for (const auto& entity : children) {
-            selectEntityHierarchy(entity, isCtrlPressed);
-            if (!coord->entityHasComponent<components::TransformComponent>(entity))
-                continue;
-            const auto &childTransform = coord->getComponent<components::TransformComponent>(entity);
-
-            if (!childTransform.children.empty())
-                selectModelChildren(childTransform.children, isCtrlPressed);
+                selector.addToSelection(uuid->get().uuid, static_cast<int>(entity), selType);
         }
     }
 
@@ -29,6 +29,7 @@
 #include "assets/AssetCatalog.hpp"
 #include "assets/Assets/Model/Model.hpp"
 #include "assets/Assets/Texture/Texture.hpp"
+#include "math/Affine.hpp"
 #include <imgui.h>
 #include <algorithm>
 #include <filesystem>
@@ -129,10 +130,7 @@ namespace parallax::editor {
                 auto parentComp = coordinator.tryGetComponent<components::ParentComponent>(payload.entity);
                 if (parentComp.has_value())
                 {
-                    auto parentTransform = coordinator.tryGetComponent<components::TransformComponent>(parentComp->get().parent);
-                    if (parentTransform.has_value())
-                        parentTransform->get().removeChild(payload.entity);
-
+                    coordinator.getHierarchy().setParent(payload.entity, ecs::INVALID_ENTITY);
                     coordinator.removeComponent<components::ParentComponent>(payload.entity);
                 }
 
@@ -151,13 +149,13 @@ namespace parallax::editor {
             if (!childTransformOpt.has_value())
                 return;
             auto &childTransform = childTransformOpt->get();
-            glm::mat4 childWorldMat = childTransform.worldMatrix;
+            glm::mat4 childWorldMat = math::affineToMat4(childTransform.worldMatrix);
 
             auto parentTransformOpt = coordinator.tryGetComponent<components::TransformComponent>(parentEntity);
             if (!parentTransformOpt.has_value())
                 return;
             auto& parentTransform = parentTransformOpt->get();
-            glm::mat4 parentWorldMat = parentTransform.worldMatrix;
+            glm::mat4 parentWorldMat = math::affineToMat4(parentTransform.worldMatrix);
 
             // Compute the new localMatrix so that parentWorldMat * local = old world
             glm::mat4 invParent = glm::inverse(parentWorldMat);
@@ -182,26 +180,19 @@ namespace parallax::editor {
             ecs::Entity oldParent = ecs::INVALID_ENTITY;
             auto oldParentComp = coordinator.tryGetComponent<components::ParentComponent>(childEntity);
             if (oldParentComp.has_value())
-            {
                 oldParent = oldParentComp->get().parent;
 
-                if (auto oldPT = coordinator.tryGetComponent<components::TransformComponent>(oldParent)) {
-                    oldPT->get().removeChild(childEntity);
-                    if (oldPT->get().children.empty() && coordinator.entityHasComponent<components::RootComponent>(oldParent))
-                        coordinator.removeComponent<components::RootComponent>(oldParent);
-                }
-            }
+            ecs::Hierarchy &hierarchy = coordinator.getHierarchy();
+            hierarchy.setParent(childEntity, parentEntity);
+            if (oldParent != ecs::INVALID_ENTITY && hierarchy.descendants(oldParent).empty() &&
+                coordinator.entityHasComponent<components::RootComponent>(oldParent))
+                coordinator.removeComponent<components::RootComponent>(oldParent);
 
             if (!oldParentComp.has_value())
                 coordinator.addComponent(childEntity, components::ParentComponent{parentEntity});
             else
                 oldParentComp->get().parent = parentEntity;
 
-            if (!coordinator.entityHasComponent<components::TransformComponent>(parentEntity))
-                coordinator.addComponent(parentEntity, components::TransformComponent{});
-            auto& pt = coordinator.getComponent<components::TransformComponent>(parentEntity);
-            pt.addChild(childEntity);
-
             if (!coordinator.entityHasComponent<components::ParentComponent>(parentEntity) &&
                 !coordinator.entityHasComponent<components::RootComponent>(parentEntity))
             {
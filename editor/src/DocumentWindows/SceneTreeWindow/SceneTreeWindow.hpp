@@ -160,7 +160,7 @@ namespace parallax::editor
         template <typename... Components, typename NodeCreator>
         static void generateNodes(std::map<scene::SceneId, SceneObject>& scenes, NodeCreator nodeCreator)
         {
-            const std::vector<ecs::Entity> entities = Application::m_coordinator->getAllEntitiesWith<Components...>();
+            const std::span<const ecs::Entity> entities = Application::m_coordinator->getAllEntitiesWith<Components...>();
             for (const ecs::Entity entity : entities)
             {
                 const auto& sceneTag = Application::m_coordinator->getComponent<components::SceneTag>(entity);
@@ -26,7 +26,7 @@ namespace parallax::editor {
     void SceneTreeWindow::generateHierarchicalNodes(std::map<scene::SceneId, SceneObject> &scenes)
     {
         // Find all root entities
-        const std::vector<ecs::Entity> rootEntities = Application::m_coordinator->getAllEntitiesWith<
+        const std::span<const ecs::Entity> rootEntities = Application::m_coordinator->getAllEntitiesWith<
             components::RootComponent,
             components::TransformComponent,
             components::SceneTag>();
@@ -48,7 +48,7 @@ namespace parallax::editor {
         }
 
         // Find standalone entities (those with no parent but without RootComponent)
-        const std::vector<ecs::Entity> standaloneEntities = Application::m_coordinator->getAllEntitiesWith<
+        const std::span<const ecs::Entity> standaloneEntities = Application::m_coordinator->getAllEntitiesWith<
             components::StaticMeshComponent,
             components::TransformComponent,
             components::SceneTag,
@@ -76,14 +76,10 @@ namespace parallax::editor {
         SceneObject& parentNode,
         std::unordered_set<ecs::Entity>& processedEntities)
     {
-        const auto& transform = Application::m_coordinator->getComponent<components::TransformComponent>(parentEntity);
-
-        for (const auto childEntity : transform.children) {
-            if (childEntity == ecs::INVALID_ENTITY)
-                continue;
+        Application::m_coordinator->getHierarchy().forEachChild(parentEntity, [&](const ecs::Entity childEntity) {
             // Skip if already processed
             if (processedEntities.contains(childEntity))
-                continue;
+                return;
 
             SceneObject childNode = createEntityNode(
                 parentNode.data.sceneProperties.sceneId,
@@ -93,7 +89,7 @@ namespace parallax::editor {
             processedEntities.insert(childEntity);
             buildChildNodesForEntity(childEntity, childNode, processedEntities);
             parentNode.children.push_back(childNode);
-        }
+        });
     }
 
     SceneObject SceneTreeWindow::createEntityNode(const scene::SceneId sceneId, const WindowId uiId, const ecs::Entity entity)
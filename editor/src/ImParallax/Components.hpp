@@ -21,6 +21,7 @@
 #include <imgui.h>
 #include <string>
 #include <vector>
+#include <span>
 #include <functional>
 
 #include "ecs/Coordinator.hpp"
@@ -109,7 +110,7 @@ namespace ImParallax {
      *
      * @param label Text label displayed next to the dropdown
      * @param targetEntity Reference to the entity variable that will be updated with the selection
-     * @param entities Vector of available entities to choose from
+     * @param entities Span of available entities to choose from
      * @param getNameFunc Function that converts an entity ID to a displayable name string
      * @return true if an entity was selected (value changed), false otherwise
      */
@@ -117,7 +118,7 @@ namespace ImParallax {
      bool RowEntityDropdown(
          const std::string& label,
          parallax::ecs::Entity& targetEntity,
-         const std::vector<parallax::ecs::Entity>& entities,
+         std::span<const parallax::ecs::Entity> entities,
          GetNameFunc&& getNameFunc
      )
      {
@@ -148,7 +149,7 @@ namespace ImParallax {
          if (needRebuild) {
              entityNamePairs.clear();
              entityNamePairs.reserve(entities.size());
-             lastEntities = entities;
+             lastEntities.assign(entities.begin(), entities.end());
              lastTargetEntity = targetEntity;
 
              for (parallax::ecs::Entity entity : entities) {
@@ -273,7 +273,7 @@ namespace ImParallax {
             ImGui::TableSetupColumn("##Label", ImGuiTableColumnFlags_WidthStretch | ImGuiTableColumnFlags_NoHeaderLabel);
             ImGui::TableSetupColumn("##X", ImGuiTableColumnFlags_WidthStretch | ImGuiTableColumnFlags_NoHeaderLabel);
 
-            const std::vector<parallax::ecs::Entity> &entities = parallax::Application::m_coordinator->getAllEntitiesWith<
+            const std::span<const parallax::ecs::Entity> entities = parallax::Application::m_coordinator->getAllEntitiesWith<
                                                             parallax::components::TransformComponent,
                                                             parallax::ecs::Exclude<parallax::components::CameraComponent>,
                                                             parallax::ecs::Exclude<parallax::components::DirectionalLightComponent>,
@@ -66,16 +66,8 @@ namespace parallax::editor {
 
     void EntityDeletionAction::redo()
     {
-        // Simply destroy the entity
+        // Simply destroy the entity, the coordinator also removes it from the hierarchy
         const auto& coordinator = Application::m_coordinator;
-        auto parentOpt = coordinator->tryGetComponent<components::ParentComponent>(m_entityId);
-        if (parentOpt.has_value()) {
-            ecs::Entity oldParent = parentOpt->get().parent;
-            auto parentTransformOpt = coordinator->tryGetComponent<components::TransformComponent>(oldParent);
-            if (parentTransformOpt.has_value()) {
-                parentTransformOpt->get().removeChild(m_entityId);
-            }
-        }
         coordinator->destroyEntity(m_entityId);
     }
 
@@ -90,13 +82,8 @@ namespace parallax::editor {
     void EntityParentChangeAction::redo()
     {
         auto& coordinator = *Application::m_coordinator;
-        // Handle old parent
-        if (m_oldParent != ecs::INVALID_ENTITY) {
-            const auto oldParentTransform = coordinator.tryGetComponent<components::TransformComponent>(m_oldParent);
-            if (oldParentTransform.has_value()) {
-                oldParentTransform->get().removeChild(m_entity);
-            }
-        }
+        // Moving the node in the hierarchy also detaches it from its old parent
+        coordinator.getHierarchy().setParent(m_entity, m_newParent);
 
         // Handle new parent
         if (m_newParent != ecs::INVALID_ENTITY) {
@@ -108,15 +95,9 @@ namespace parallax::editor {
                 parentComp->get().parent = m_newParent;
             }
 
-            // Add to new parent's children
-            auto newParentTransform = coordinator.tryGetComponent<components::TransformComponent>(m_newParent);
-            if (!newParentTransform.has_value()) {
+            // The transform hierarchy needs a transform on the new parent
+            if (!coordinator.entityHasComponent<components::TransformComponent>(m_newParent))
                 coordinator.addComponent(m_newParent, components::TransformComponent{});
-                newParentTransform = coordinator.tryGetComponent<components::TransformComponent>(m_newParent);
-            }
-            if (newParentTransform.has_value()) {
-                newParentTransform->get().addChild(m_entity);
-            }
         } else {
             // Remove parent component (make it a root entity)
             const auto parentComp = coordinator.tryGetComponent<components::ParentComponent>(m_entity);
@@ -129,14 +110,8 @@ namespace parallax::editor {
     void EntityParentChangeAction::undo()
     {
         auto& coordinator = *Application::m_coordinator;
-
-        // Handle new parent (undo by removing from it)
-        if (m_newParent != ecs::INVALID_ENTITY) {
-            const auto newParentTransform = coordinator.tryGetComponent<components::TransformComponent>(m_newParent);
-            if (newParentTransform.has_value()) {
-                newParentTransform->get().removeChild(m_entity);
-            }
-        }
+        // Moving the node back in the hierarchy also detaches it from the new parent
+        coordinator.getHierarchy().setParent(m_entity, m_oldParent);
 
         // Handle old parent (restore to it)
         if (m_oldParent != ecs::INVALID_ENTITY) {
@@ -148,15 +123,9 @@ namespace parallax::editor {
                 parentComp->get().parent = m_oldParent;
             }
 
-            // Add back to old parent's children
-            auto oldParentTransform = coordinator.tryGetComponent<components::TransformComponent>(m_oldParent);
-            if (!oldParentTransform.has_value()) {
+            // The transform hierarchy needs a transform on the old parent
+            if (!coordinator.entityHasComponent<components::TransformComponent>(m_oldParent))
                 coordinator.addComponent(m_oldParent, components::TransformComponent{});
-                oldParentTransform = coordinator.tryGetComponent<components::TransformComponent>(m_oldParent);
-            }
-            if (oldParentTransform.has_value()) {
-                oldParentTransform->get().addChild(m_entity);
-            }
         } else {
             // Remove parent component (restore to root entity)
             const auto parentComp = coordinator.tryGetComponent<components::ParentComponent>(m_entity);
@@ -171,14 +140,11 @@ namespace parallax::editor {
     {
         std::function<void(ecs::Entity)> collectActions = [&](ecs::Entity entity) {
 
-            auto transformOpt = Application::m_coordinator->tryGetComponent<components::TransformComponent>(entity);
-            if (transformOpt) {
-                for (const auto& child : transformOpt->get().children) {
-                    collectActions(child);
-                    m_parentRelations.emplace_back(child, entity);
-                    m_group->addAction(std::make_unique<EntityDeletionAction>(child));
-                }
-            }
+            Application::m_coordinator->getHierarchy().forEachChild(entity, [&](const ecs::Entity child) {
+                collectActions(child);
+                m_parentRelations.emplace_back(child, entity);
+                m_group->addAction(std::make_unique<EntityDeletionAction>(child));
+            });
 
             auto parentOpt = Application::m_coordinator->tryGetComponent<components::ParentComponent>(entity);
             if (parentOpt && parentOpt->get().parent != ecs::INVALID_ENTITY) {
@@ -204,14 +170,11 @@ namespace parallax::editor {
         : m_root(rootEntity), m_group(std::make_unique<ActionGroup>())
     {
         std::function<void(ecs::Entity)> collectActions = [&](ecs::Entity entity) {
-            auto transformOpt = Application::m_coordinator->tryGetComponent<components::TransformComponent>(entity);
-            if (transformOpt) {
-                for (const auto& child : transformOpt->get().children) {
-                    collectActions(child);
-                    m_parentRelations.emplace_back(child, entity);
-                    m_group->addAction(std::make_unique<EntityCreationAction>(child));
-                }
-            }
+            Application::m_coordinator->getHierarchy().forEachChild(entity, [&](const ecs::Entity child) {
+                collectActions(child);
+                m_parentRelations.emplace_back(child, entity);
+                m_group->addAction(std::make_unique<EntityCreationAction>(child));
+            });
 
             auto parentOpt = Application::m_coordinator->tryGetComponent<components::ParentComponent>(entity);
             if (parentOpt && parentOpt->get().parent != ecs::INVALID_ENTITY) {
@@ -46,8 +46,7 @@
 #include "systems/CameraSystem.hpp"
 #include "systems/RenderBillboardSystem.hpp"
 #include "systems/RenderCommandSystem.hpp"
-#include "systems/TransformHierarchySystem.hpp"
-#include "systems/TransformMatrixSystem.hpp"
+#include "systems/TransformSystem.hpp"
 #include "systems/ScriptingSystem.hpp"
 #include "systems/lights/DirectionalLightsSystem.hpp"
 #include "systems/lights/PointLightsSystem.hpp"
@@ -117,12 +116,11 @@ namespace parallax {
     void Application::registerWindowCallbacks() const
     {
         m_window->setResizeCallback([this](const int width, const int height) {
-            m_eventManager->emitEvent<event::EventWindowResize>(
-                std::make_shared<event::EventWindowResize>(width, height));
+            m_eventManager->emitEvent<event::EventWindowResize>(width, height);
         });
 
         m_window->setCloseCallback([this]() {
-            m_eventManager->emitEvent<event::EventWindowClose>(std::make_shared<event::EventWindowClose>());
+            m_eventManager->emitEvent<event::EventWindowClose>();
         });
 
         m_window->setKeyCallback([this](const int key, const int action, const int mods) {
@@ -145,7 +143,7 @@ namespace parallax {
                 }
                 default: return;
             }
-            m_eventManager->emitEvent<event::EventKey>(std::make_shared<event::EventKey>(eventKey));
+            m_eventManager->emitEvent<event::EventKey>(eventKey);
         });
 
         m_window->setKeyCallback([this](const int key, const int action, const int mods) {
@@ -168,7 +166,7 @@ namespace parallax {
                 }
                 default: return;
             }
-            m_eventManager->emitEvent<event::EventKey>(std::make_shared<event::EventKey>(eventKey));
+            m_eventManager->emitEvent<event::EventKey>(eventKey);
         });
 
         m_window->setMouseClickCallback([this](const int button, const int action, const int mods) {
@@ -186,17 +184,15 @@ namespace parallax {
                     break;
                 default: return;
             }
-            m_eventManager->emitEvent<event::EventMouseClick>(std::make_shared<event::EventMouseClick>(event));
+            m_eventManager->emitEvent<event::EventMouseClick>(event);
         });
 
         m_window->setMouseScrollCallback([this](const double xOffset, const double yOffset) {
-            m_eventManager->emitEvent<event::EventMouseScroll>(
-                std::make_shared<event::EventMouseScroll>(static_cast<float>(xOffset), static_cast<float>(yOffset)));
+            m_eventManager->emitEvent<event::EventMouseScroll>(static_cast<float>(xOffset), static_cast<float>(yOffset));
         });
 
         m_window->setMouseMoveCallback([this](const double xpos, const double ypos) {
-            m_eventManager->emitEvent<event::EventMouseMove>(
-                std::make_shared<event::EventMouseMove>(static_cast<float>(xpos), static_cast<float>(ypos)));
+            m_eventManager->emitEvent<event::EventMouseMove>(static_cast<float>(xpos), static_cast<float>(ypos));
         });
 
         m_window->setFileDropCallback([this](const int count, const char** paths) {
@@ -205,8 +201,7 @@ namespace parallax {
             for (int i = 0; i < count; ++i) {
                 files.emplace_back(paths[i]);
             }
-            m_eventManager->emitEvent<event::EventFileDrop>(
-                std::make_shared<event::EventFileDrop>(files));
+            m_eventManager->emitEvent<event::EventFileDrop>(files);
         });
     }
 
@@ -217,8 +212,7 @@ namespace parallax {
         m_perspectiveCameraTargetSystem = m_coordinator->registerQuerySystem<system::PerspectiveCameraTargetSystem>();
         m_renderCommandSystem = m_coordinator->registerGroupSystem<system::RenderCommandSystem>();
         m_renderBillboardSystem = m_coordinator->registerGroupSystem<system::RenderBillboardSystem>();
-        m_transformHierarchySystem = m_coordinator->registerGroupSystem<system::TransformHierarchySystem>();
-        m_transformMatrixSystem = m_coordinator->registerQuerySystem<system::TransformMatrixSystem>();
+        m_transformSystem = m_coordinator->registerQuerySystem<system::TransformSystem>();
         m_physicsSystem = m_coordinator->registerQuerySystem<system::PhysicsSystem>();
         m_physicsSystem->init();
 
@@ -229,6 +223,14 @@ namespace parallax {
         m_lightSystem = std::make_shared<system::LightSystem>(ambientLightSystem, directionalLightSystem, pointLightSystem, spotLightSystem);
 
         m_scriptingSystem = std::make_shared<system::ScriptingSystem>();
+
+        m_frameScheduler.addSystem("TransformSystem", m_transformSystem);
+        m_frameScheduler.addSystem("CameraContextSystem", m_cameraContextSystem);
+        m_lightSystem->addToSchedule(m_frameScheduler);
+        // Both query the renderer for texture slots, which is only valid on the thread owning the GL context
+        m_frameScheduler.addSystem("RenderCommandSystem", m_renderCommandSystem, ecs::SystemThread::Main);
+        m_frameScheduler.addSystem("RenderBillboardSystem", m_renderBillboardSystem, ecs::SystemThread::Main);
+        LOG(PARALLAX_DEV, "{}", m_frameScheduler.describeSchedule());
     }
 
     int Application::initScripting() const
@@ -306,6 +308,7 @@ namespace parallax {
         m_worldState.time.deltaTime = time - m_worldState.time.totalTime;
         m_worldState.time.totalTime = time;
         m_worldState.stats.frameCount += 1;
+        m_coordinator->resetSignatureEvaluationStats();
     }
 
     void Application::run(const SceneInfo &sceneInfo)
@@ -327,17 +330,28 @@ namespace parallax {
             }
         	if (m_SceneManager.getScene(sceneInfo.id).isRendered())
 			{
-                m_transformMatrixSystem->update();
-                m_transformHierarchySystem->update();
-				m_cameraContextSystem->update();
-				m_lightSystem->update();
-				m_renderCommandSystem->update();
-				m_renderBillboardSystem->update();
-				for (auto &camera : renderContext.cameras)
+                m_frameScheduler.run();
+                m_worldState.stats.transforms = m_transformSystem->getStats();
+                // Sync point: structural changes recorded by the systems are applied once they are all done
+                m_coordinator->flushCommandBuffers();
+                // Component observers then receive the add / remove / change events of the frame in one batch per type
+                m_coordinator->flushObservers();
+				for (auto &camera : renderContext.cameras) {
 				    camera.pipeline.execute();
+				    // The context is dropped at the end of the frame, the culling and draw counters stay on the camera for the editor
+				    if (camera.entity == ecs::INVALID_ENTITY)
+				        continue;
+				    if (auto cameraComponent = m_coordinator->tryGetComponent<components::CameraComponent>(camera.entity)) {
+				        cameraComponent->get().cullingStats = camera.cullingStats;
+				        cameraComponent->get().drawStats = renderer::DrawCommand::getStats();
+				    }
+				}
 				// We have to unbind after the whole pipeline since multiple passes can use the same textures
 				// but we cant bind everything beforehand since a resize can be triggered and invalidate the whole state
                 renderer::NxRenderer3D::get().unbindTextures();
+                // Material indices reference the texture slots, so they are released with them
+                renderer::NxRenderer3D::get().resetMaterials();
+                renderer::NxRenderer3D::get().resetInstances();
                 
                 if (isInPlayMode()) {
                     m_physicsSystem->update();
@@ -361,6 +375,8 @@ namespace parallax {
     void Application::endFrame()
     {
     	m_eventManager->clearEvents();
+        // Nothing allocated from the frame arena outlives the events and the executed pipelines
+        m_worldState.stats.frameAllocations = FrameArena::getInstance().reset();
     }
 
     ecs::Entity Application::createEntity() const
@@ -370,56 +386,21 @@ namespace parallax {
 
     void Application::deleteEntity(const ecs::Entity entity)
     {
-        // First, recursively delete all children of this entity
-        deleteEntityChildren(entity);
-
-        // Then, remove this entity from its parent's children list (if it has a parent)
-        removeEntityFromParent(entity);
-
-        // Finally, handle the scene tag and destroy the entity as in the original code
-        const auto tag = m_coordinator->tryGetComponent<components::SceneTag>(entity);
-        if (tag) {
-            const unsigned int sceneId = tag->get().id;
-            m_SceneManager.getScene(sceneId).removeEntity(entity);
-        }
-        m_coordinator->destroyEntity(entity);
-    }
-
-    void Application::removeEntityFromParent(const ecs::Entity entity) const
-    {
-        // Get the parent component to find the parent entity
-        auto parentComponent = m_coordinator->tryGetComponent<components::ParentComponent>(entity);
-        if (!parentComponent || parentComponent->get().parent == ecs::INVALID_ENTITY)
-            return;
-
-        ecs::Entity parentEntity = parentComponent->get().parent;
-
-        // Get the parent's transform component which now stores children
-        auto parentTransform = m_coordinator->tryGetComponent<components::TransformComponent>(parentEntity);
-        if (parentTransform) {
-            // Remove this entity from parent's children vector
-            parentTransform->get().removeChild(entity);
-        }
-    }
-
-    void Application::deleteEntityChildren(const ecs::Entity entity)
-    {
-        // Check if this entity has a transform component with children
-        auto transform = m_coordinator->tryGetComponent<components::TransformComponent>(entity);
-        if (!transform || transform->get().children.empty())
-            return;
-
-        // Create a copy of the children vector since we'll be modifying it during iteration
-        const std::vector<ecs::Entity> childrenCopy = transform->get().children;
-
-        // Delete each child entity recursively
-        for (const auto& childEntity : childrenCopy)
-        {
-            if (childEntity != ecs::INVALID_ENTITY && childEntity != entity) // Avoid circular references
-                deleteEntity(childEntity);
+        // The subtree is contiguous in the hierarchy: copy it, then drop it in a single erase
+        ecs::Hierarchy &hierarchy = m_coordinator->getHierarchy();
+        const std::span<const ecs::Entity> nodes = hierarchy.subtree(entity);
+        std::vector<ecs::Entity> subtree(nodes.begin(), nodes.end());
+        if (subtree.empty())
+            subtree.push_back(entity);
+        hierarchy.removeSubtree(entity);
+
+        for (const ecs::Entity deleted : subtree) {
+            const auto tag = m_coordinator->tryGetComponent<components::SceneTag>(deleted);
+            if (tag) {
+                const unsigned int sceneId = tag->get().id;
+                m_SceneManager.getScene(sceneId).removeEntity(deleted);
+            }
+            m_coordinator->destroyEntity(deleted);
         }
-
-        // Clear the children list to avoid dangling references
-        transform->get().children.clear();
     }
 }
@@ -28,6 +28,7 @@
 #include "core/event/WindowEvent.hpp"
 #include "core/event/SignalEvent.hpp"
 #include "ecs/Coordinator.hpp"
+#include "ecs/SystemScheduler.hpp"
 #include "core/scene/SceneManager.hpp"
 #include "Logger.hpp"
 #include "Timer.hpp"
@@ -39,8 +40,7 @@
 #include "systems/LightSystem.hpp"
 #include "systems/RenderCommandSystem.hpp"
 #include "systems/RenderBillboardSystem.hpp"
-#include "systems/TransformHierarchySystem.hpp"
-#include "systems/TransformMatrixSystem.hpp"
+#include "systems/TransformSystem.hpp"
 #include "systems/PhysicsSystem.hpp"
 
 #define PARALLAX_PROFILE(name) parallax::Timer timer##__LINE__(name, [&](ProfileResult profileResult) {m_profileResults.push_back(profileResult); })
@@ -204,17 +204,20 @@ namespace parallax {
                 return m_physicsSystem;
             }
 
+            std::shared_ptr<system::TransformSystem> getTransformSystem() const {
+                return m_transformSystem;
+            }
+
             /**
              * @brief Deletes an existing entity.
              *
-             * If the entity has a SceneTag component, it is first removed from the corresponding scene,
-             * and then destroyed by the ECS coordinator.
+             * The descendants of the entity in the hierarchy are deleted with it. Each deleted entity
+             * with a SceneTag component is first removed from the corresponding scene, and then
+             * destroyed by the ECS coordinator.
              *
              * @param entity The entity to delete.
              */
             void deleteEntity(ecs::Entity entity);
-            void removeEntityFromParent(const ecs::Entity entity) const;
-            void deleteEntityChildren(const ecs::Entity entity);
 
             static Application &getInstance()
             {
@@ -286,8 +289,7 @@ namespace parallax {
 
             std::shared_ptr<system::CameraContextSystem> m_cameraContextSystem;
             std::shared_ptr<system::LightSystem> m_lightSystem;
-            std::shared_ptr<system::TransformMatrixSystem> m_transformMatrixSystem;
-            std::shared_ptr<system::TransformHierarchySystem> m_transformHierarchySystem;
+            std::shared_ptr<system::TransformSystem> m_transformSystem;
             std::shared_ptr<system::PerspectiveCameraControllerSystem> m_perspectiveCameraControllerSystem;
             std::shared_ptr<system::PerspectiveCameraTargetSystem> m_perspectiveCameraTargetSystem;
             std::shared_ptr<system::ScriptingSystem> m_scriptingSystem;
@@ -295,6 +297,9 @@ namespace parallax {
             std::shared_ptr<system::RenderBillboardSystem> m_renderBillboardSystem;
             std::shared_ptr<system::PhysicsSystem> m_physicsSystem;
 
+            // Render-stage systems, ordered from their access declarations
+            ecs::SystemScheduler m_frameScheduler;
+
             std::vector<ProfileResult> m_profilesResults;
 
     };
@@ -32,6 +32,7 @@
 #include "components/MaterialComponent.hpp"
 #include "assets/AssetCatalog.hpp"
 #include "Application.hpp"
+#include "math/Bounds.hpp"
 #include "math/Matrix.hpp"
 
 #define GLM_ENABLE_EXPERIMENTAL
@@ -40,6 +41,10 @@
 
 namespace parallax
 {
+    // Local bounds of the generated primitives, the cube spans [-0.5, 0.5] and the others [-1, 1] on each axis
+    constexpr math::AABB CUBE_BOUNDS{glm::vec3(-0.5f), glm::vec3(0.5f)};
+    constexpr math::AABB UNIT_PRIMITIVE_BOUNDS{glm::vec3(-1.0f), glm::vec3(1.0f)};
+
     ecs::Entity EntityFactory3D::createCube(glm::vec3 pos, glm::vec3 size, glm::vec3 rotation, glm::vec4 color)
     {
         components::TransformComponent transform{};
@@ -49,6 +54,7 @@ namespace parallax
 
         components::StaticMeshComponent mesh;
         mesh.vao = renderer::NxRenderer3D::getCubeVAO();
+        mesh.localBounds = CUBE_BOUNDS;
 
         auto material = std::make_unique<components::Material>();
         material->albedoColor = color;
@@ -84,6 +90,7 @@ namespace parallax
 
         components::StaticMeshComponent mesh;
         mesh.vao = renderer::NxRenderer3D::getCubeVAO();
+        mesh.localBounds = CUBE_BOUNDS;
 
         const auto materialRef = assets::AssetCatalog::getInstance().createAsset<assets::Material>(
             assets::AssetLocation("_internal::CubeMat@_internal"),
@@ -178,6 +185,7 @@ namespace parallax
 
         components::StaticMeshComponent mesh;
         mesh.vao = renderer::NxRenderer3D::getTetrahedronVAO();
+        mesh.localBounds = UNIT_PRIMITIVE_BOUNDS;
 
         auto material = std::make_unique<components::Material>();
         material->albedoColor = color;
@@ -209,6 +217,7 @@ namespace parallax
 
         components::StaticMeshComponent mesh;
         mesh.vao = renderer::NxRenderer3D::getTetrahedronVAO();
+        mesh.localBounds = UNIT_PRIMITIVE_BOUNDS;
 
         const auto materialRef = assets::AssetCatalog::getInstance().createAsset<assets::Material>(
             assets::AssetLocation("_internal::TetrahedronMat@_internal"),
@@ -236,6 +245,7 @@ namespace parallax
 
         components::StaticMeshComponent mesh;
         mesh.vao = renderer::NxRenderer3D::getPyramidVAO();
+        mesh.localBounds = UNIT_PRIMITIVE_BOUNDS;
 
         auto material = std::make_unique<components::Material>();
         material->albedoColor = color;
@@ -266,6 +276,7 @@ namespace parallax
 
         components::StaticMeshComponent mesh;
         mesh.vao = renderer::NxRenderer3D::getPyramidVAO();
+        mesh.localBounds = UNIT_PRIMITIVE_BOUNDS;
 
         const auto materialRef = assets::AssetCatalog::getInstance().createAsset<assets::Material>(
             assets::AssetLocation("_internal::PyramidMat@_internal"),
@@ -294,6 +305,7 @@ namespace parallax
 
         components::StaticMeshComponent mesh;
         mesh.vao = renderer::NxRenderer3D::getCylinderVAO(nbSegment);
+        mesh.localBounds = UNIT_PRIMITIVE_BOUNDS;
 
         auto material = std::make_unique<components::Material>();
         material->albedoColor = color;
@@ -324,6 +336,7 @@ namespace parallax
 
         components::StaticMeshComponent mesh;
         mesh.vao = renderer::NxRenderer3D::getCylinderVAO(nbSegment);
+        mesh.localBounds = UNIT_PRIMITIVE_BOUNDS;
 
         const auto materialRef = assets::AssetCatalog::getInstance().createAsset<assets::Material>(
             assets::AssetLocation("_internal::CylinderMat@_internal"),
@@ -352,6 +365,7 @@ namespace parallax
 
         components::StaticMeshComponent mesh;
         mesh.vao = renderer::NxRenderer3D::getSphereVAO(nbSubdivision);
+        mesh.localBounds = UNIT_PRIMITIVE_BOUNDS;
 
         auto material = std::make_unique<components::Material>();
         material->albedoColor = color;
@@ -382,6 +396,7 @@ namespace parallax
 
         components::StaticMeshComponent mesh;
         mesh.vao = renderer::NxRenderer3D::getSphereVAO(nbSubdivision);
+        mesh.localBounds = UNIT_PRIMITIVE_BOUNDS;
 
         const auto materialRef = assets::AssetCatalog::getInstance().createAsset<assets::Material>(
             assets::AssetLocation("_internal::SphereMat@_internal"),
@@ -462,12 +477,8 @@ namespace parallax
         components::ParentComponent parentComponent;
         parentComponent.parent = parentEntity;
         Application::m_coordinator->addComponent(nodeEntity, parentComponent);
-
-        auto parentTransform = Application::m_coordinator->tryGetComponent<
-            components::TransformComponent>(parentEntity);
-        if (parentTransform)
-            parentTransform->get().children.push_back(nodeEntity);
-
+        // Nodes are visited depth-first, so attaching them appends at the end of the hierarchy
+        Application::m_coordinator->getHierarchy().setParent(nodeEntity, parentEntity);
 
         if (!node.name.empty())
         {
@@ -488,11 +499,12 @@ namespace parallax
             meshTransform.pos = glm::vec3(0.0f);
             meshTransform.size = glm::vec3(1.0f);
             meshTransform.quat = glm::quat(1.0f, 0.0f, 0.0f, 0.0f);
-            // Centroid
-            meshTransform.localCenter = mesh.localCenter;
 
             components::StaticMeshComponent staticMesh;
             staticMesh.vao = mesh.vao;
+            // Centroid
+            staticMesh.localCenter = mesh.localCenter;
+            staticMesh.localBounds = mesh.localBounds;
 
             components::RenderComponent renderComponent;
             renderComponent.isRendered = true;
@@ -519,11 +531,7 @@ namespace parallax
             components::ParentComponent meshParentComponent;
             meshParentComponent.parent = nodeEntity;
             Application::m_coordinator->addComponent(meshEntity, meshParentComponent);
-
-            auto nodeTransform = Application::m_coordinator->tryGetComponent<
-                components::TransformComponent>(nodeEntity);
-            if (nodeTransform)
-                nodeTransform->get().children.push_back(meshEntity);
+            Application::m_coordinator->getHierarchy().setParent(meshEntity, nodeEntity);
         }
 
         for (const auto& childNode : node.children)
@@ -20,6 +20,8 @@
 #pragma once
 
 #include "Application.hpp"
+#include "FrameArena.hpp"
+#include "systems/TransformSystem.hpp"
 
 namespace parallax {
 
@@ -31,6 +33,8 @@ namespace parallax {
 
         struct WorldStats {
             int frameCount = 0; // Number of frames rendered
+            FrameAllocationStats frameAllocations; // Frame arena counters of the last completed frame
+            system::TransformUpdateStats transforms; // Matrices rebuilt by the transform system in the last rendered frame
         } stats;
     };
 
@@ -21,6 +21,7 @@
 #include "VertexArray.hpp"
 #include "assets/Asset.hpp"
 #include "assets/Assets/Material/Material.hpp"
+#include "math/Bounds.hpp"
 
 namespace parallax::assets {
 
@@ -30,6 +31,7 @@ namespace parallax::assets {
         AssetRef<Material> material;
 
         glm::vec3 localCenter = {0.0f, 0.0f, 0.0f};
+        math::AABB localBounds;
     };
 
     struct MeshNode {
@@ -376,22 +376,14 @@ namespace parallax::assets {
         std::vector<unsigned int> indices;
         vertices.reserve(mesh->mNumVertices);
 
-        glm::vec3 minBB(+FLT_MAX, +FLT_MAX, +FLT_MAX);
-        glm::vec3 maxBB(-FLT_MAX, -FLT_MAX, -FLT_MAX);
-
+        math::AABB localBounds;
 
         for (unsigned int i = 0; i < mesh->mNumVertices; i++)
         {
             renderer::NxVertex vertex{};
             vertex.position = {mesh->mVertices[i].x, mesh->mVertices[i].y, mesh->mVertices[i].z};
 
-            minBB.x = std::min(minBB.x, vertex.position.x);
-            minBB.y = std::min(minBB.y, vertex.position.y);
-            minBB.z = std::min(minBB.z, vertex.position.z);
-
-            maxBB.x = std::max(maxBB.x, vertex.position.x);
-            maxBB.y = std::max(maxBB.y, vertex.position.y);
-            maxBB.z = std::max(maxBB.z, vertex.position.z);
+            localBounds.expand(vertex.position);
 
             if (mesh->HasNormals()) {
                 vertex.normal = { mesh->mNormals[i].x, mesh->mNormals[i].y, mesh->mNormals[i].z };
@@ -405,7 +397,7 @@ namespace parallax::assets {
             vertices.push_back(vertex);
         }
 
-        glm::vec3 centerLocal = (minBB + maxBB) * 0.5f;
+        glm::vec3 centerLocal = localBounds.isEmpty() ? glm::vec3(0.0f) : (localBounds.min + localBounds.max) * 0.5f;
 
         for (unsigned int i = 0; i < mesh->mNumFaces; i++)
         {
@@ -431,7 +423,7 @@ namespace parallax::assets {
         }
 
         LOG(PARALLAX_INFO, "Loaded mesh {}", mesh->mName.C_Str());
-        return {mesh->mName.C_Str(), vao, materialComponent, centerLocal};
+        return {mesh->mName.C_Str(), vao, materialComponent, centerLocal, localBounds};
     }
 
     glm::mat4 ModelImporter::convertAssimpMatrixToGLM(const aiMatrix4x4& matrix)
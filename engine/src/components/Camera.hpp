@@ -22,6 +22,7 @@
 #include "renderer/Framebuffer.hpp"
 #include "ecs/Definitions.hpp"
 #include "renderer/RenderPipeline.hpp"
+#include "math/Bounds.hpp"
 #include <glm/glm.hpp>
 
 namespace parallax::components {
@@ -31,6 +32,14 @@ namespace parallax::components {
 		ORTHOGRAPHIC
 	};
 
+	/**
+     * @brief Meshes a camera considered in its last rendered frame and the ones left after frustum culling
+     */
+    struct CameraCullingStats {
+        unsigned int visibleMeshes = 0;     ///< Meshes inside the frustum, drawn by the camera.
+        unsigned int totalMeshes = 0;       ///< Meshes of the rendered scene.
+    };
+
 	/**
      * @brief Represents the camera component.
      *
@@ -58,6 +67,9 @@ namespace parallax::components {
 
         renderer::RenderPipeline pipeline;
 
+        CameraCullingStats cullingStats;    ///< Culling counters of the last frame rendered by the camera.
+        renderer::DrawStats drawStats;      ///< Draw calls and binds issued and skipped by the last frame rendered by the camera.
+
         /**
          * @brief Retrieves the projection matrix for this camera.
          *
@@ -189,5 +201,8 @@ namespace parallax::components {
         glm::vec4 clearColor;                                ///< Clear color used for rendering.
         std::shared_ptr<renderer::NxFramebuffer> renderTarget; ///< The render target framebuffer.
         renderer::RenderPipeline pipeline;
+        ecs::Entity entity = ecs::INVALID_ENTITY;            ///< The camera entity, INVALID_ENTITY if the context has none.
+        math::Frustum frustum;                               ///< Planes of the view-projection matrix, used for culling.
+        CameraCullingStats cullingStats;                     ///< Filled by the render systems while recording the frame.
     };
 }
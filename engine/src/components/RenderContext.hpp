@@ -23,6 +23,14 @@
 
 namespace parallax::components {
     struct RenderContext {
+        // Tags narrowing a WriteSingleton<RenderContext, Part> declaration, so that systems filling
+        // different parts of the context can be scheduled concurrently
+        struct CamerasPart {};
+        struct AmbientLightPart {};
+        struct DirectionalLightPart {};
+        struct PointLightsPart {};
+        struct SpotLightsPart {};
+
         int sceneRendered = -1;
         SceneType sceneType = SceneType::GAME;
         bool isChildWindow = false; //<< Is the current scene embedded in a sub window ?
@@ -19,6 +19,9 @@
 
 #include "renderer/Attributes.hpp"
 #include "renderer/VertexArray.hpp"
+#include "math/Bounds.hpp"
+
+#include <glm/glm.hpp>
 
 namespace parallax::components {
 
@@ -27,18 +30,28 @@ namespace parallax::components {
 
         renderer::RequiredAttributes meshAttributes;
 
+        // Centroid of the mesh in its local space
+        glm::vec3 localCenter = {0.0f, 0.0f, 0.0f};
+
+        // Bounding box of the mesh in its local space, left empty the mesh is never frustum culled
+        math::AABB localBounds;
+
         struct Memento {
             std::shared_ptr<renderer::NxVertexArray> vao;
+            glm::vec3 localCenter;
+            math::AABB localBounds;
         };
 
         void restore(const Memento &memento)
         {
             vao = memento.vao;
+            localCenter = memento.localCenter;
+            localBounds = memento.localBounds;
         }
 
         [[nodiscard]] Memento save() const
         {
-            return {vao};
+            return {vao, localCenter, localBounds};
         }
     };
 
@@ -18,8 +18,6 @@
 
 #include "Transform.hpp"
 
-#include <algorithm>
-
 namespace parallax::components {
     void TransformComponent::restore(const TransformComponent::Memento &memento)
     {
@@ -27,24 +25,10 @@ namespace parallax::components {
         quat = memento.rotation;
         size = memento.scale;
         localMatrix = memento.localMatrix;
-        localCenter = memento.localCenter;
-        children = memento.children;
     }
 
     [[nodiscard]] TransformComponent::Memento TransformComponent::save() const
     {
-        return {pos, quat, size, localMatrix, localCenter, children};
-    }
-
-    void TransformComponent::addChild(const ecs::Entity childEntity)
-    {
-        if (std::ranges::find(children, childEntity) != children.end())
-            return;
-        children.push_back(childEntity);
-    }
-
-    void TransformComponent::removeChild(const ecs::Entity childEntity)
-    {
-        children.erase(std::ranges::remove(children, childEntity).begin(), children.end());
+        return {pos, quat, size, localMatrix};
     }
 }
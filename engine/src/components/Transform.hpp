@@ -21,7 +21,6 @@
 
 #include <glm/glm.hpp>
 #include <glm/gtc/quaternion.hpp>
-#include <vector>
 
 namespace parallax::components {
 
@@ -31,27 +30,18 @@ namespace parallax::components {
             glm::quat rotation;
             glm::vec3 scale;
 
-            glm::mat4 localMatrix;
-            glm::vec3 localCenter;
-
-            std::vector<ecs::Entity> children;
+            glm::mat4x3 localMatrix;
         };
 
         void restore(const Memento &memento);
         [[nodiscard]] Memento save() const;
 
-        void addChild(ecs::Entity childEntity);
-        void removeChild(ecs::Entity childEntity);
-
         glm::vec3 pos;
         glm::vec3 size = glm::vec3(1.0f);
         glm::quat quat = glm::quat(1.0f, 0.0f, 0.0f, 0.0f);
 
-        glm::mat4 worldMatrix = glm::mat4(1.0f);
-        glm::mat4 localMatrix = glm::mat4(1.0f);
-
-        glm::vec3 localCenter = {0.0f, 0.0f, 0.0f};
-
-        std::vector<ecs::Entity> children{};
+        // Affine matrices without their constant (0, 0, 0, 1) row, see math/Affine.hpp
+        glm::mat4x3 worldMatrix = glm::mat4x3(1.0f);
+        glm::mat4x3 localMatrix = glm::mat4x3(1.0f);
     };
 }
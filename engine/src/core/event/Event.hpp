@@ -23,10 +23,12 @@
 #include <functional>
 #include <queue>
 #include <memory>
+#include <memory_resource>
 #include <concepts>
 
 #include "Listener.hpp"
 #include "Logger.hpp"
+#include "FrameArena.hpp"
 
 namespace parallax::scene {
     class Scene;
@@ -184,6 +186,8 @@ namespace parallax::event {
          * @brief Constructs and emits an event with the given arguments.
          *
          * Forwards arguments to the event's constructor and queues the event.
+         * Queued events are cleared at the end of the frame at the latest, so the event is
+         * allocated from the frame arena.
          *
          * @tparam EventType The event type.
          * @tparam Args The types of arguments to forward.
@@ -191,7 +195,8 @@ namespace parallax::event {
          */
         template <typename EventType, typename... Args>
         void emitEvent(Args&&... args) {
-            emitEvent(std::make_shared<EventType>(std::forward<Args>(args)...));
+            emitEvent(std::allocate_shared<EventType>(
+                std::pmr::polymorphic_allocator<EventType>(&FrameArena::getInstance()), std::forward<Args>(args)...));
         }
 
         /**
@@ -44,31 +44,12 @@ namespace parallax::scene {
         m_coordinator->addComponent<components::SceneTag>(entity, tag);
         m_entities.insert(entity);
 
-        // If it's a root entity or has children, recursively add all children to the scene
-        if (m_coordinator->entityHasComponent<components::TransformComponent>(entity)) {
-            const auto &transform = m_coordinator->getComponent<components::TransformComponent>(entity);
-
-            for (const auto &childEntity : transform.children)
-                addChildEntityToScene(childEntity);
-        }
-    }
-
-    void Scene::addChildEntityToScene(const ecs::Entity entity)
-    {
-        if (m_entities.contains(entity))
-            return;
-
-        // Add scene tag to this child entity
-        const components::SceneTag tag{m_id, true, true};
-        m_coordinator->addComponent<components::SceneTag>(entity, tag);
-        m_entities.insert(entity);
-
-        // Recursively add this entity's children
-        if (m_coordinator->entityHasComponent<components::TransformComponent>(entity)) {
-            const auto &transform = m_coordinator->getComponent<components::TransformComponent>(entity);
-
-            for (const auto &childEntity : transform.children)
-                addChildEntityToScene(childEntity);
+        // If it has children, add all of its descendants to the scene
+        for (const ecs::Entity descendant : m_coordinator->getHierarchy().descendants(entity)) {
+            if (m_entities.contains(descendant))
+                continue;
+            m_coordinator->addComponent<components::SceneTag>(descendant, tag);
+            m_entities.insert(descendant);
         }
     }
 
@@ -55,12 +55,11 @@ namespace parallax::scene {
 			* @brief Adds an entity to the scene.
 			*
 			* Attaches a SceneTag component (with the scene ID and default active/rendered state)
-			* to the entity and stores it in the scene's entity set.
+			* to the entity and its descendants in the hierarchy, and stores them in the scene's entity set.
 			*
 			* @param entity The entity identifier to add.
 			*/
 			void addEntity(ecs::Entity entity);
-			void addChildEntityToScene(ecs::Entity entity);
 
 			/**
              * @brief Removes an entity from the scene.
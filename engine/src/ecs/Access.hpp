@@ -19,6 +19,9 @@
 
 #include <tuple>
 #include <type_traits>
+#include <typeindex>
+#include <typeinfo>
+#include <vector>
 
 namespace parallax::ecs {
     /**
@@ -59,15 +62,24 @@ namespace parallax::ecs {
     template<typename T>
     struct ReadSingleton {
         using ComponentType = T;
+        using Part = void;
         static constexpr AccessType accessType = AccessType::Read;
     };
 
     /**
      * @brief Type alias for read-write singleton component access
+     *
+     * The optional Part tag narrows the declaration for the system scheduler: the system promises
+     * to only write the part of the singleton identified by the tag, so two systems writing
+     * different parts may run concurrently. Access through getSingleton is unchanged.
+     *
+     * @tparam T The singleton component type
+     * @tparam P Tag identifying the written part, void for the whole singleton
      */
-    template<typename T>
+    template<typename T, typename P = void>
     struct WriteSingleton {
         using ComponentType = T;
+        using Part = P;
         static constexpr AccessType accessType = AccessType::Write;
     };
 
@@ -144,12 +156,89 @@ namespace parallax::ecs {
     template<typename T>
     struct IsWriteSingleton : std::false_type {};
 
-    template<typename T>
-    struct IsWriteSingleton<WriteSingleton<T>> : std::true_type {};
+    template<typename T, typename P>
+    struct IsWriteSingleton<WriteSingleton<T, P>> : std::true_type {};
 
     /**
      * @brief Helper to check if a type is any kind of singleton component
      */
     template<typename T>
     struct IsSingleton : std::bool_constant<IsReadSingleton<T>::value || IsWriteSingleton<T>::value> {};
+
+    /**
+     * @brief Runtime description of the data a system reads and writes
+     *
+     * Built from the access markers of a system and used by the SystemScheduler to decide
+     * which systems may run concurrently.
+     */
+    struct SystemAccess {
+        /**
+         * @brief A single component or singleton accessed by a system
+         */
+        struct Resource {
+            std::type_index type;                    ///< Component or singleton type
+            std::type_index part = typeid(void);     ///< Written part of a singleton, void for the whole type
+            AccessType access = AccessType::Read;    ///< Read or write access
+        };
+
+        std::vector<Resource> resources;
+
+        /**
+         * @brief Checks whether two systems touch the same data with at least one of them writing it
+         *
+         * @param other The access declaration of the other system
+         * @return true if both systems cannot safely run concurrently
+         */
+        [[nodiscard]] bool conflictsWith(const SystemAccess &other) const
+        {
+            for (const Resource &mine : resources) {
+                for (const Resource &theirs : other.resources) {
+                    if (mine.type != theirs.type)
+                        continue;
+                    if (mine.access == AccessType::Read && theirs.access == AccessType::Read)
+                        continue;
+                    const bool wholeType = mine.part == typeid(void) || theirs.part == typeid(void);
+                    if (wholeType || mine.part == theirs.part)
+                        return true;
+                }
+            }
+            return false;
+        }
+
+        /**
+         * @brief Builds the access description of a pack of access markers
+         *
+         * Works with Read, Write, ReadSingleton and WriteSingleton markers. Owned<> and NonOwned<>
+         * wrappers are expanded.
+         *
+         * @tparam AccessTypes Access markers declared by a system
+         * @return SystemAccess The matching description
+         */
+        template<typename... AccessTypes>
+        static SystemAccess from()
+        {
+            SystemAccess access;
+            (access.append<AccessTypes>(), ...);
+            return access;
+        }
+
+        private:
+            template<typename... Ts>
+            void appendTuple(std::tuple<Ts...> *)
+            {
+                (append<Ts>(), ...);
+            }
+
+            template<typename AccessT>
+            void append()
+            {
+                if constexpr (requires { typename AccessT::ComponentTypes; }) {
+                    appendTuple(static_cast<typename AccessT::ComponentTypes *>(nullptr));
+                } else if constexpr (requires { typename AccessT::Part; }) {
+                    resources.push_back({typeid(typename AccessT::ComponentType), typeid(typename AccessT::Part), AccessT::accessType});
+                } else {
+                    resources.push_back({typeid(typename AccessT::ComponentType), typeid(void), AccessT::accessType});
+                }
+            }
+    };
 }
@@ -26,9 +26,9 @@ namespace parallax::ecs {
             throw std::invalid_argument("Component size cannot be zero");
         }
 
-        m_sparse.resize(m_capacity, INVALID_ENTITY);
         m_dense.reserve(m_capacity);
         m_componentData.reserve(m_capacity * m_componentSize);
+        m_changeTicks.reserve(m_capacity);
     }
 
     void TypeErasedComponentArray::insert(const Entity entity, const void* componentData)
@@ -41,16 +41,15 @@ namespace parallax::ecs {
         if (entity >= MAX_ENTITIES)
             THROW_EXCEPTION(OutOfRange, entity);
 
-        ensureSparseCapacity(entity);
-
         if (hasComponent(entity)) {
             LOG(PARALLAX_WARN, "Entity {} already has component", entity);
             return;
         }
 
         const size_t newIndex = m_size;
-        m_sparse[entity]      = newIndex;
+        m_sparse.set(entity, newIndex);
         m_dense.push_back(entity);
+        m_changeTicks.push_back(m_currentTick);
 
         // Resize component data vector if needed
         const size_t requiredSize = (m_size + 1) * m_componentSize;
@@ -63,6 +62,7 @@ namespace parallax::ecs {
                     componentData, m_componentSize);
 
         ++m_size;
+        recordAdded(entity);
     }
 
     void TypeErasedComponentArray::remove(const Entity entity)
@@ -78,8 +78,9 @@ namespace parallax::ecs {
             if (indexToRemove != groupLastIndex) {
                 swapComponents(indexToRemove, groupLastIndex);
                 std::swap(m_dense[indexToRemove], m_dense[groupLastIndex]);
-                m_sparse[m_dense[indexToRemove]]  = indexToRemove;
-                m_sparse[m_dense[groupLastIndex]] = groupLastIndex;
+                std::swap(m_changeTicks[indexToRemove], m_changeTicks[groupLastIndex]);
+                m_sparse.set(m_dense[indexToRemove], indexToRemove);
+                m_sparse.set(m_dense[groupLastIndex], groupLastIndex);
             }
             --m_groupSize;
             indexToRemove = groupLastIndex;
@@ -90,19 +91,22 @@ namespace parallax::ecs {
         if (indexToRemove != lastIndex) {
             swapComponents(indexToRemove, lastIndex);
             std::swap(m_dense[indexToRemove], m_dense[lastIndex]);
-            m_sparse[m_dense[indexToRemove]] = indexToRemove;
+            std::swap(m_changeTicks[indexToRemove], m_changeTicks[lastIndex]);
+            m_sparse.set(m_dense[indexToRemove], indexToRemove);
         }
 
-        m_sparse[entity] = INVALID_ENTITY;
+        m_sparse.erase(entity);
         m_dense.pop_back();
+        m_changeTicks.pop_back();
         --m_size;
+        recordRemoved(entity);
 
         shrinkIfNeeded();
     }
 
     bool TypeErasedComponentArray::hasComponent(const Entity entity) const
     {
-        return (entity < m_sparse.size() && m_sparse[entity] != INVALID_ENTITY);
+        return m_sparse.contains(entity);
     }
 
     void TypeErasedComponentArray::entityDestroyed(const Entity entity)
@@ -159,6 +163,26 @@ namespace parallax::ecs {
         return {m_dense.data(), m_size};
     }
 
+    void TypeErasedComponentArray::setCurrentTick(const Tick tick)
+    {
+        m_currentTick = tick;
+    }
+
+    void TypeErasedComponentArray::markChanged(const Entity entity)
+    {
+        if (!hasComponent(entity))
+            THROW_EXCEPTION(ComponentNotFound, entity);
+        m_changeTicks[m_sparse[entity]] = m_currentTick;
+        recordChanged(entity);
+    }
+
+    Tick TypeErasedComponentArray::getChangeTick(const Entity entity) const
+    {
+        if (!hasComponent(entity))
+            return 0;
+        return m_changeTicks[m_sparse[entity]];
+    }
+
     Entity TypeErasedComponentArray::getEntityAtIndex(const size_t index) const
     {
         if (index >= m_size)
@@ -178,8 +202,9 @@ namespace parallax::ecs {
         if (index != m_groupSize) {
             swapComponents(index, m_groupSize);
             std::swap(m_dense[index], m_dense[m_groupSize]);
-            m_sparse[m_dense[index]]       = index;
-            m_sparse[m_dense[m_groupSize]] = m_groupSize;
+            std::swap(m_changeTicks[index], m_changeTicks[m_groupSize]);
+            m_sparse.set(m_dense[index], index);
+            m_sparse.set(m_dense[m_groupSize], m_groupSize);
         }
         ++m_groupSize;
     }
@@ -197,8 +222,9 @@ namespace parallax::ecs {
         if (index != m_groupSize) {
             swapComponents(index, m_groupSize);
             std::swap(m_dense[index], m_dense[m_groupSize]);
-            m_sparse[m_dense[index]]       = index;
-            m_sparse[m_dense[m_groupSize]] = m_groupSize;
+            std::swap(m_changeTicks[index], m_changeTicks[m_groupSize]);
+            m_sparse.set(m_dense[index], index);
+            m_sparse.set(m_dense[m_groupSize], m_groupSize);
         }
     }
 
@@ -207,23 +233,57 @@ namespace parallax::ecs {
         return m_groupSize;
     }
 
-    size_t TypeErasedComponentArray::memoryUsage() const
+    ComponentMemoryUsage TypeErasedComponentArray::memoryUsage() const
     {
-        return m_componentData.capacity()
-               + sizeof(size_t) * m_sparse.capacity()
-               + sizeof(Entity) * m_dense.capacity();
+        return {
+            m_componentData.capacity()
+                + sizeof(Entity) * m_dense.capacity()
+                + sizeof(Tick) * m_changeTicks.capacity(),
+            m_sparse.pageMemory(),
+            m_sparse.overheadMemory()
+        };
     }
 
-    void TypeErasedComponentArray::ensureSparseCapacity(const Entity entity)
+    void TypeErasedComponentArray::snapshot(SnapshotWriter &writer) const
     {
-        if (entity >= m_sparse.size()) {
-            size_t newSize = m_sparse.size();
-            if (newSize == 0)
-                newSize = m_capacity;
-            while (entity >= newSize)
-                newSize *= 2;
-            m_sparse.resize(newSize, INVALID_ENTITY);
-        }
+        writer.reserve(sizeof(std::uint64_t) * 4 + m_size * (sizeof(Entity) + sizeof(Tick) + m_componentSize));
+        writer.write<std::uint64_t>(m_groupSize);
+        writer.writeBlock(std::span<const Entity>(m_dense.data(), m_size));
+        writer.writeBlock(std::span<const Tick>(m_changeTicks.data(), m_size));
+        writer.writeBlock(std::span<const std::byte>(m_componentData.data(), m_size * m_componentSize));
+    }
+
+    std::unique_ptr<ComponentSnapshotBlock> TypeErasedComponentArray::parseSnapshot(SnapshotReader &reader) const
+    {
+        auto block = std::make_unique<SnapshotBlock>();
+        const auto groupSize = reader.read<std::uint64_t>();
+        reader.readBlock(block->dense);
+        reader.readBlock(block->changeTicks);
+        reader.readBlock(block->componentData);
+
+        const bool consistent = block->changeTicks.size() == block->dense.size()
+            && block->componentData.size() == block->dense.size() * m_componentSize
+            && groupSize <= block->dense.size()
+            && std::ranges::all_of(block->dense, [](const Entity entity) { return entity < MAX_ENTITIES; });
+        if (!consistent)
+            THROW_EXCEPTION(InvalidSnapshot, "inconsistent block for a type-erased component");
+        block->groupSize = static_cast<size_t>(groupSize);
+        return block;
+    }
+
+    void TypeErasedComponentArray::commitSnapshot(ComponentSnapshotBlock &block)
+    {
+        auto &parsed = static_cast<SnapshotBlock &>(block);
+        for (size_t i = 0; i < m_size; ++i)
+            m_sparse.erase(m_dense[i]);
+        m_dense = std::move(parsed.dense);
+        m_changeTicks = std::move(parsed.changeTicks);
+        m_componentData = std::move(parsed.componentData);
+        m_size = m_dense.size();
+        m_groupSize = parsed.groupSize;
+        for (size_t i = 0; i < m_size; ++i)
+            m_sparse.set(m_dense[i], i);
+        clearPendingEvents();
     }
 
     void TypeErasedComponentArray::swapComponents(const size_t index1, const size_t index2)
@@ -249,9 +309,11 @@ namespace parallax::ecs {
 
             m_componentData.shrink_to_fit();
             m_dense.shrink_to_fit();
+            m_changeTicks.shrink_to_fit();
 
             m_componentData.reserve(newCapacity);
             m_dense.reserve(newCapacity / m_componentSize);
+            m_changeTicks.reserve(newCapacity / m_componentSize);
         }
     }
 
@@ -19,15 +19,64 @@
 
 #include "Definitions.hpp"
 #include "ECSExceptions.hpp"
+#include "SparseIndex.hpp"
+#include "Snapshot.hpp"
 #include "Exception.hpp"
 #include "Logger.hpp"
 
 #include <vector>
+#include <memory>
+#include <mutex>
 #include <span>
 #include <algorithm>
 #include <cstring>
 
 namespace parallax::ecs {
+    /**
+     * @brief Memory held by a component array, in bytes
+     */
+    struct ComponentMemoryUsage {
+        size_t dense = 0;        ///< Component values, entity IDs and change ticks
+        size_t sparse = 0;       ///< Allocated pages of the sparse index
+        size_t pageOverhead = 0; ///< Page table and per-page bookkeeping of the sparse index
+
+        [[nodiscard]] size_t total() const { return dense + sparse + pageOverhead; }
+    };
+
+    /**
+     * @brief Kinds of component mutations that can be observed
+     *
+     * Values are bit flags so that an array can record several kinds at once.
+     */
+    enum class ComponentEvent : std::uint8_t {
+        Added = 1 << 0,   ///< A component was inserted for an entity
+        Removed = 1 << 1, ///< A component was removed from an entity (including on destruction)
+        Changed = 1 << 2  ///< A component was marked as written
+    };
+
+    /**
+     * @brief Mutations recorded by a component array since the last observer flush
+     *
+     * Entities are appended in mutation order and may repeat; duplicates are
+     * collapsed when the events are delivered.
+     */
+    struct ComponentEvents {
+        std::vector<Entity> added;
+        std::vector<Entity> removed;
+        std::vector<Entity> changed;
+
+        [[nodiscard]] bool empty() const { return added.empty() && removed.empty() && changed.empty(); }
+    };
+
+    /**
+     * @brief Content of one component array read from a snapshot, validated but not applied yet
+     *
+     * Each array type derives its own block from this base.
+     */
+    struct ComponentSnapshotBlock {
+        virtual ~ComponentSnapshotBlock() = default;
+    };
+
     /**
      * @class IComponentArray
      * @brief Base interface for all component array types.
@@ -42,6 +91,45 @@ namespace parallax::ecs {
     public:
         virtual ~IComponentArray() = default;
 
+        /**
+         * @brief Selects which mutations are recorded for observers
+         *
+         * Kinds that are not observed cost a single branch per mutation and are never queued.
+         *
+         * @param mask Bitwise OR of ComponentEvent values, 0 to stop recording
+         */
+        void setObservedEvents(const std::uint8_t mask)
+        {
+            m_observedEvents = mask;
+            if (!(mask & static_cast<std::uint8_t>(ComponentEvent::Added)))
+                m_pendingEvents.added.clear();
+            if (!(mask & static_cast<std::uint8_t>(ComponentEvent::Removed)))
+                m_pendingEvents.removed.clear();
+            if (!(mask & static_cast<std::uint8_t>(ComponentEvent::Changed)))
+                m_pendingEvents.changed.clear();
+        }
+
+        /**
+         * @brief Gets the mask of recorded mutation kinds
+         * @return Bitwise OR of ComponentEvent values
+         */
+        [[nodiscard]] std::uint8_t observedEvents() const { return m_observedEvents; }
+
+        /**
+         * @brief Moves the recorded mutations out of the array
+         *
+         * @param out Receives the pending events; its previous content is swapped back
+         *            (cleared) so its capacity is reused by the next batch
+         */
+        void takePendingEvents(ComponentEvents &out)
+        {
+            out.added.clear();
+            out.removed.clear();
+            out.changed.clear();
+            std::scoped_lock lock(m_changedMutex);
+            std::swap(out, m_pendingEvents);
+        }
+
         /**
          * @brief Checks if an entity has a component in this array
          * @param entity The entity to check
@@ -125,6 +213,103 @@ namespace parallax::ecs {
          * @return Span of entity IDs
          */
         [[nodiscard]] virtual std::span<const Entity> entities() const = 0;
+
+        /**
+         * @brief Sets the tick stamped on components inserted or marked as changed from now on
+         * @param tick The current change-detection tick
+         */
+        virtual void setCurrentTick(Tick tick) = 0;
+
+        /**
+         * @brief Stamps the component of an entity with the current tick
+         * @param entity The entity whose component was written
+         */
+        virtual void markChanged(Entity entity) = 0;
+
+        /**
+         * @brief Gets the tick of the last write to the component of an entity
+         * @param entity The entity to look up
+         * @return The last change tick, or 0 if the entity doesn't have the component
+         */
+        [[nodiscard]] virtual Tick getChangeTick(Entity entity) const = 0;
+
+        /**
+         * @brief Gets the estimated memory usage of this component array, split by storage kind
+         * @return ComponentMemoryUsage Bytes held by the dense storage, the sparse pages and the page table
+         */
+        [[nodiscard]] virtual ComponentMemoryUsage memoryUsage() const = 0;
+
+        /**
+         * @brief Writes the dense storage (group size, entities, change ticks and components) to a snapshot
+         * @param writer Destination stream
+         * @throws ComponentNotSerializable if the components need a serializer and none was set
+         */
+        virtual void snapshot(SnapshotWriter &writer) const = 0;
+
+        /**
+         * @brief Reads and validates a block written by snapshot() without modifying the array
+         * @param reader Source stream
+         * @return The parsed content, applied with commitSnapshot()
+         * @throws InvalidSnapshot if the block is truncated or inconsistent
+         */
+        [[nodiscard]] virtual std::unique_ptr<ComponentSnapshotBlock> parseSnapshot(SnapshotReader &reader) const = 0;
+
+        /**
+         * @brief Replaces the content of the array with a block returned by parseSnapshot() on this array
+         * @param block The parsed content, moved from
+         */
+        virtual void commitSnapshot(ComponentSnapshotBlock &block) = 0;
+
+        /**
+         * @brief Replaces the content of the array with a block written by snapshot()
+         * @param reader Source stream
+         * @throws InvalidSnapshot if the block is inconsistent, the array is left untouched
+         */
+        void restore(SnapshotReader &reader)
+        {
+            const auto block = parseSnapshot(reader);
+            commitSnapshot(*block);
+        }
+
+    protected:
+        void recordAdded(const Entity entity)
+        {
+            if (m_observedEvents & static_cast<std::uint8_t>(ComponentEvent::Added)) [[unlikely]]
+                m_pendingEvents.added.push_back(entity);
+        }
+
+        void recordRemoved(const Entity entity)
+        {
+            if (m_observedEvents & static_cast<std::uint8_t>(ComponentEvent::Removed)) [[unlikely]]
+                m_pendingEvents.removed.push_back(entity);
+        }
+
+        void recordChanged(const Entity entity)
+        {
+            // Unlike insertions and removals, writes are marked from worker threads by the parallel iterations
+            if (m_observedEvents & static_cast<std::uint8_t>(ComponentEvent::Changed)) [[unlikely]] {
+                std::scoped_lock lock(m_changedMutex);
+                m_pendingEvents.changed.push_back(entity);
+            }
+        }
+
+        /**
+         * @brief Drops the recorded mutations, used when the whole content is replaced
+         */
+        void clearPendingEvents()
+        {
+            m_pendingEvents.added.clear();
+            m_pendingEvents.removed.clear();
+            m_pendingEvents.changed.clear();
+        }
+
+    private:
+        // Bitwise OR of the ComponentEvent kinds that have at least one observer.
+        std::uint8_t m_observedEvents = 0;
+        // Mutations recorded since the last flush, delivered in one batch by the component manager.
+        ComponentEvents m_pendingEvents;
+        // Guards m_pendingEvents.changed against concurrent recordChanged() calls.
+        std::mutex m_changedMutex;
     };
 
 #if defined(_MSC_VER)
@@ -163,9 +348,9 @@ namespace parallax::ecs {
          */
         ComponentArray()
         {
-            m_sparse.resize(capacity, INVALID_ENTITY);
             m_dense.reserve(capacity);
             m_componentArray.reserve(capacity);
+            m_changeTicks.reserve(capacity);
         }
 
         [[nodiscard]] size_t getComponentSize() const override
@@ -211,20 +396,19 @@ namespace parallax::ecs {
             if (entity >= MAX_ENTITIES)
                 THROW_EXCEPTION(OutOfRange, entity);
 
-            // Ensure m_sparse can hold this entity index.
-            ensureSparseCapacity(entity);
-
             if (hasComponent(entity)) {
                 LOG(PARALLAX_WARN, "Entity {} already has component: {}", entity, typeid(T).name());
                 return;
             }
 
             const size_t newIndex = m_size;
-            m_sparse[entity] = newIndex;
+            m_sparse.set(entity, newIndex);
             m_dense.push_back(entity);
             m_componentArray.push_back(component);
+            m_changeTicks.push_back(m_currentTick);
 
             ++m_size;
+            recordAdded(entity);
         }
 
         /**
@@ -242,16 +426,15 @@ namespace parallax::ecs {
             if (entity >= MAX_ENTITIES)
                 THROW_EXCEPTION(OutOfRange, entity);
 
-            ensureSparseCapacity(entity);
-
             if (hasComponent(entity)) {
                 LOG(PARALLAX_WARN, "Entity {} already has component: {}", entity, typeid(T).name());
                 return;
             }
 
             const size_t newIndex = m_size;
-            m_sparse[entity] = newIndex;
+            m_sparse.set(entity, newIndex);
             m_dense.push_back(entity);
+            m_changeTicks.push_back(m_currentTick);
 
             // allocate new component in the array
             m_componentArray.emplace_back();
@@ -259,6 +442,7 @@ namespace parallax::ecs {
             if constexpr (std::is_trivially_copyable_v<T>) {
                 std::memcpy(&m_componentArray[newIndex], componentData, sizeof(T));
                 ++m_size;
+                recordAdded(entity);
             } else {
                 THROW_EXCEPTION(InternalError, "Component type is not trivially copyable, raw insertion is not supported");
             }
@@ -289,8 +473,9 @@ namespace parallax::ecs {
                 if (indexToRemove != groupLastIndex) {
                     std::swap(m_componentArray[indexToRemove], m_componentArray[groupLastIndex]);
                     std::swap(m_dense[indexToRemove], m_dense[groupLastIndex]);
-                    m_sparse[m_dense[indexToRemove]] = indexToRemove;
-                    m_sparse[m_dense[groupLastIndex]] = groupLastIndex;
+                    std::swap(m_changeTicks[indexToRemove], m_changeTicks[groupLastIndex]);
+                    m_sparse.set(m_dense[indexToRemove], indexToRemove);
+                    m_sparse.set(m_dense[groupLastIndex], groupLastIndex);
                 }
                 --m_groupSize;
                 indexToRemove = groupLastIndex;
@@ -301,12 +486,15 @@ namespace parallax::ecs {
             if (indexToRemove != lastIndex) {
                 std::swap(m_componentArray[indexToRemove], m_componentArray[lastIndex]);
                 std::swap(m_dense[indexToRemove], m_dense[lastIndex]);
-                m_sparse[m_dense[indexToRemove]] = indexToRemove;
+                std::swap(m_changeTicks[indexToRemove], m_changeTicks[lastIndex]);
+                m_sparse.set(m_dense[indexToRemove], indexToRemove);
             }
-            m_sparse[entity] = INVALID_ENTITY;
+            m_sparse.erase(entity);
             m_componentArray.pop_back();
             m_dense.pop_back();
+            m_changeTicks.pop_back();
             --m_size;
+            recordRemoved(entity);
 
             shrinkIfNeeded();
         }
@@ -322,9 +510,10 @@ namespace parallax::ecs {
          */
         [[nodiscard]] T& get(const Entity entity)
         {
-            if (!hasComponent(entity))
+            const PagedSparseIndex::Index index = m_sparse.get(entity);
+            if (index == PagedSparseIndex::INVALID_INDEX)
                 THROW_EXCEPTION(ComponentNotFound, entity);
-            return m_componentArray[m_sparse[entity]];
+            return m_componentArray[index];
         }
 
         /**
@@ -338,9 +527,50 @@ namespace parallax::ecs {
          */
         [[nodiscard]] const T& get(const Entity entity) const
         {
-            if (!hasComponent(entity))
+            const PagedSparseIndex::Index index = m_sparse.get(entity);
+            if (index == PagedSparseIndex::INVALID_INDEX)
                 THROW_EXCEPTION(ComponentNotFound, entity);
-            return m_componentArray[m_sparse[entity]];
+            return m_componentArray[index];
+        }
+
+        /**
+         * @brief Gets the dense index of the component of an entity
+         *
+         * Resolves the entity with a single sparse lookup so callers can then read, write
+         * and stamp the component through the index based accessors.
+         *
+         * @param entity The entity to look up
+         * @return The dense index, or PagedSparseIndex::INVALID_INDEX if the entity doesn't have the component
+         */
+        [[nodiscard]] PagedSparseIndex::Index getDenseIndex(const Entity entity) const
+        {
+            return m_sparse.get(entity);
+        }
+
+        /**
+         * @brief Retrieves the component stored at a dense index
+         *
+         * @param index Index in the dense array
+         * @return Reference to the component
+         *
+         * @pre index < size()
+         */
+        [[nodiscard]] T& getAt(const size_t index)
+        {
+            return m_componentArray[index];
+        }
+
+        /**
+         * @brief Retrieves the component stored at a dense index (const version)
+         *
+         * @param index Index in the dense array
+         * @return Const reference to the component
+         *
+         * @pre index < size()
+         */
+        [[nodiscard]] const T& getAt(const size_t index) const
+        {
+            return m_componentArray[index];
         }
 
         void duplicateComponent(const Entity sourceEntity, const Entity destEntity) override
@@ -359,7 +589,7 @@ namespace parallax::ecs {
          */
         [[nodiscard]] bool hasComponent(const Entity entity) const override
         {
-            return (entity < m_sparse.size() && m_sparse[entity] != INVALID_ENTITY);
+            return m_sparse.contains(entity);
         }
 
         /**
@@ -452,12 +682,25 @@ namespace parallax::ecs {
             if (index != m_groupSize) {
                 std::swap(m_componentArray[index], m_componentArray[m_groupSize]);
                 std::swap(m_dense[index], m_dense[m_groupSize]);
-                m_sparse[m_dense[index]] = index;
-                m_sparse[m_dense[m_groupSize]] = m_groupSize;
+                std::swap(m_changeTicks[index], m_changeTicks[m_groupSize]);
+                m_sparse.set(m_dense[index], index);
+                m_sparse.set(m_dense[m_groupSize], m_groupSize);
             }
             ++m_groupSize;
         }
 
+        /**
+         * @brief Moves the components of several entities into the group region.
+         *
+         * @param entities The entities to add to the group
+         * @throws ComponentNotFoundException if one of the entities doesn't have the component
+         */
+        void addToGroup(const std::span<const Entity> entities)
+        {
+            for (const Entity entity : entities)
+                addToGroup(entity);
+        }
+
         /**
          * @brief Moves the component for the given entity out of the group region.
          *
@@ -481,8 +724,71 @@ namespace parallax::ecs {
             if (index != m_groupSize) {
                 std::swap(m_componentArray[index], m_componentArray[m_groupSize]);
                 std::swap(m_dense[index], m_dense[m_groupSize]);
-                m_sparse[m_dense[index]] = index;
-                m_sparse[m_dense[m_groupSize]] = m_groupSize;
+                std::swap(m_changeTicks[index], m_changeTicks[m_groupSize]);
+                m_sparse.set(m_dense[index], index);
+                m_sparse.set(m_dense[m_groupSize], m_groupSize);
+            }
+        }
+
+        /**
+         * @brief Swaps the components stored at two dense indices
+         *
+         * The entities, change ticks and sparse entries travel with the components. Used by
+         * groups to reorder their region in place.
+         *
+         * @param index1 First dense index
+         * @param index2 Second dense index
+         *
+         * @pre index1 < size() and index2 < size()
+         */
+        void swapComponents(const size_t index1, const size_t index2)
+        {
+            std::swap(m_componentArray[index1], m_componentArray[index2]);
+            std::swap(m_dense[index1], m_dense[index2]);
+            std::swap(m_changeTicks[index1], m_changeTicks[index2]);
+            m_sparse.set(m_dense[index1], index1);
+            m_sparse.set(m_dense[index2], index2);
+        }
+
+        /**
+         * @brief Reorders the first order.size() entries in place
+         *
+         * Afterwards the entry at index i is the one previously stored at order[i]. The
+         * permutation is applied by following its cycles, so every entry is moved once and
+         * only one entry per cycle is held in a temporary.
+         *
+         * @param order Source index of each destination index, a permutation of [0, order.size())
+         * @throws OutOfRange if order is larger than the array
+         */
+        void applyPermutation(const std::span<const size_t> order)
+        {
+            if (order.size() > m_size)
+                THROW_EXCEPTION(OutOfRange, order.size());
+
+            std::vector<bool> placed(order.size(), false);
+            for (size_t start = 0; start < order.size(); ++start) {
+                if (placed[start] || order[start] == start)
+                    continue;
+
+                T component = std::move(m_componentArray[start]);
+                const Entity entity = m_dense[start];
+                const Tick changeTick = m_changeTicks[start];
+
+                size_t current = start;
+                for (size_t source = order[current]; source != start; source = order[current]) {
+                    m_componentArray[current] = std::move(m_componentArray[source]);
+                    m_dense[current] = m_dense[source];
+                    m_changeTicks[current] = m_changeTicks[source];
+                    m_sparse.set(m_dense[current], current);
+                    placed[current] = true;
+                    current = source;
+                }
+
+                m_componentArray[current] = std::move(component);
+                m_dense[current] = entity;
+                m_changeTicks[current] = changeTick;
+                m_sparse.set(entity, current);
+                placed[current] = true;
             }
         }
 
@@ -494,26 +800,32 @@ namespace parallax::ecs {
          * @param index The index to set the component at
          * @param entity The entity to associate with this component
          * @param component The component data to set
+         * @param changeTick The change tick carried along with the component
          * @throws OutOfRange if the index is invalid
          */
-        void forceSetComponentAt(size_t index, const Entity entity, T component)
+        void forceSetComponentAt(size_t index, const Entity entity, T component, const Tick changeTick)
         {
             if (index >= m_size)
                 THROW_EXCEPTION(OutOfRange, index);
 
-            m_sparse[entity] = index;
+            m_sparse.set(entity, index);
             m_dense[index] = entity;
             m_componentArray[index] = std::move(component);
+            m_changeTicks[index] = changeTick;
         }
 
         /**
          * @brief Batch insertion of multiple components
          *
+         * The sparse and dense storage are grown once for the whole batch, then the components
+         * are appended contiguously at the end of the dense array.
+         *
          * @tparam EntityIt Iterator type for entities
          * @tparam CompIt Iterator type for components
          * @param entitiesBegin Start iterator for entities
          * @param entitiesEnd End iterator for entities
          * @param componentsBegin Start iterator for components
+         * @throws OutOfRange if one of the entities is beyond MAX_ENTITIES
          *
          * @pre The range [entitiesBegin, entitiesEnd) must be valid
          * @pre componentsBegin must point to a valid range of at least (entitiesEnd - entitiesBegin) elements
@@ -521,10 +833,31 @@ namespace parallax::ecs {
         template<typename EntityIt, typename CompIt>
         void insertBatch(EntityIt entitiesBegin, EntityIt entitiesEnd, CompIt componentsBegin)
         {
+            size_t count = 0;
+            Entity maxEntity = 0;
+            for (EntityIt entityIt = entitiesBegin; entityIt != entitiesEnd; ++entityIt, ++count)
+                maxEntity = std::max(maxEntity, static_cast<Entity>(*entityIt));
+            reserveBatch(count, maxEntity);
+
             CompIt compIt = componentsBegin;
-            for (EntityIt entityIt = entitiesBegin; entityIt != entitiesEnd; ++entityIt, ++compIt) {
-                insert(*entityIt, *compIt);
-            }
+            for (EntityIt entityIt = entitiesBegin; entityIt != entitiesEnd; ++entityIt, ++compIt)
+                appendComponent(*entityIt, *compIt);
+        }
+
+        /**
+         * @brief Batch insertion of the same component value for multiple entities
+         *
+         * @param entities The entities receiving a copy of the component
+         * @param component The component value to copy
+         * @throws OutOfRange if one of the entities is beyond MAX_ENTITIES
+         */
+        void insertBatch(const std::span<const Entity> entities, const T &component)
+        {
+            if (entities.empty())
+                return;
+            reserveBatch(entities.size(), std::ranges::max(entities));
+            for (const Entity entity : entities)
+                appendComponent(entity, component);
         }
 
         /**
@@ -566,44 +899,277 @@ namespace parallax::ecs {
         }
 
         /**
-         * @brief Get the estimated memory usage of this component array
+         * @brief Sets the tick stamped on components inserted or marked as changed from now on
+         *
+         * @param tick The current change-detection tick
+         */
+        void setCurrentTick(const Tick tick) override
+        {
+            m_currentTick = tick;
+        }
+
+        /**
+         * @brief Gets the tick currently stamped on written components
+         *
+         * @return The current change-detection tick
+         */
+        [[nodiscard]] constexpr Tick currentTick() const
+        {
+            return m_currentTick;
+        }
+
+        /**
+         * @brief Stamps the component of an entity with the current tick
+         *
+         * @param entity The entity whose component was written
+         * @throws ComponentNotFoundException if the entity doesn't have the component
+         */
+        void markChanged(const Entity entity) override
+        {
+            if (!hasComponent(entity))
+                THROW_EXCEPTION(ComponentNotFound, entity);
+            m_changeTicks[m_sparse[entity]] = m_currentTick;
+            recordChanged(entity);
+        }
+
+        /**
+         * @brief Stamps the component at a dense index with the current tick
+         *
+         * @param index Index in the dense array
+         */
+        void markChangedAt(const size_t index)
+        {
+            m_changeTicks[index] = m_currentTick;
+            recordChanged(m_dense[index]);
+        }
+
+        /**
+         * @brief Gets the tick of the last write to the component of an entity
+         *
+         * @param entity The entity to look up
+         * @return The last change tick, or 0 if the entity doesn't have the component
+         */
+        [[nodiscard]] Tick getChangeTick(const Entity entity) const override
+        {
+            if (!hasComponent(entity))
+                return 0;
+            return m_changeTicks[m_sparse[entity]];
+        }
+
+        /**
+         * @brief Checks whether the component of an entity was written after a given tick
+         *
+         * @param entity The entity to check
+         * @param since Reference tick
+         * @return true if the component exists and changed strictly after since
+         */
+        [[nodiscard]] bool isChangedSince(const Entity entity, const Tick since) const
+        {
+            return getChangeTick(entity) > since;
+        }
+
+        /**
+         * @brief Gets the tick of the last write to the component at a dense index
+         *
+         * @param index Index in the dense array
+         * @return The last change tick
+         */
+        [[nodiscard]] Tick getChangeTickAt(const size_t index) const
+        {
+            return m_changeTicks[index];
+        }
+
+        /**
+         * @brief Gets a view of the change ticks, parallel to getAllComponents()
+         *
+         * @return Const span of change ticks
+         */
+        [[nodiscard]] std::span<const Tick> getChangeTicks() const
+        {
+            return {m_changeTicks.data(), m_size};
+        }
+
+        /**
+         * @brief Get the estimated memory usage of this component array, split by storage kind
+         *
+         * @return ComponentMemoryUsage Bytes held by the dense storage, the sparse pages and the page table
+         */
+        [[nodiscard]] ComponentMemoryUsage memoryUsage() const override
+        {
+            return {
+                sizeof(T) * m_componentArray.capacity()
+                    + sizeof(Entity) * m_dense.capacity()
+                    + sizeof(Tick) * m_changeTicks.capacity(),
+                m_sparse.pageMemory(),
+                m_sparse.overheadMemory()
+            };
+        }
+
+        /**
+         * @brief Sets the callbacks used to snapshot components that are not trivially copyable
          *
-         * @return Size in bytes of memory used by this component array
+         * @param serializer Write and read callbacks, called once per component
          */
-        [[nodiscard]] size_t memoryUsage() const
+        void setSerializer(ComponentSerializer<T> serializer)
         {
-            return sizeof(T) * m_componentArray.capacity()
-                            + sizeof(size_t) * m_sparse.capacity()
-                            + sizeof(Entity) * m_dense.capacity();
+            m_serializer = std::move(serializer);
+        }
+
+        /**
+         * @brief Writes the dense storage to a snapshot
+         *
+         * Trivially copyable components are written as a single block, other types go
+         * through the serializer one component at a time.
+         *
+         * @param writer Destination stream
+         * @throws ComponentNotSerializable if T is not trivially copyable and no serializer was set
+         */
+        void snapshot(SnapshotWriter &writer) const override
+        {
+            if constexpr (!std::is_trivially_copyable_v<T>) {
+                if (!m_serializer.write)
+                    THROW_EXCEPTION(ComponentNotSerializable, typeid(T).name());
+            }
+
+            writer.reserve(sizeof(std::uint64_t) * 4 + m_size * (sizeof(Entity) + sizeof(Tick) + sizeof(T)));
+            writer.write<std::uint64_t>(m_groupSize);
+            writer.writeBlock(std::span<const Entity>(m_dense.data(), m_size));
+            writer.writeBlock(std::span<const Tick>(m_changeTicks.data(), m_size));
+            if constexpr (std::is_trivially_copyable_v<T>) {
+                writer.writeBlock(std::span<const T>(m_componentArray.data(), m_size));
+            } else {
+                for (size_t i = 0; i < m_size; ++i)
+                    m_serializer.write(writer, m_componentArray[i]);
+            }
+        }
+
+        /**
+         * @brief Reads and validates a block written by snapshot() without modifying the array
+         *
+         * @param reader Source stream
+         * @return The parsed dense storage
+         * @throws InvalidSnapshot if the block is inconsistent
+         * @throws ComponentNotSerializable if T is not trivially copyable and no serializer was set
+         */
+        [[nodiscard]] std::unique_ptr<ComponentSnapshotBlock> parseSnapshot(SnapshotReader &reader) const override
+        {
+            if constexpr (!std::is_trivially_copyable_v<T>) {
+                if (!m_serializer.read)
+                    THROW_EXCEPTION(ComponentNotSerializable, typeid(T).name());
+            }
+
+            auto block = std::make_unique<SnapshotBlock>();
+            const auto groupSize = reader.read<std::uint64_t>();
+            reader.readBlock(block->dense);
+            reader.readBlock(block->changeTicks);
+            if constexpr (std::is_trivially_copyable_v<T>) {
+                reader.readBlock(block->components);
+            } else {
+                block->components.reserve(block->dense.size());
+                for (size_t i = 0; i < block->dense.size(); ++i)
+                    block->components.push_back(m_serializer.read(reader));
+            }
+
+            const size_t count = block->dense.size();
+            if (block->changeTicks.size() != count || block->components.size() != count || groupSize > count)
+                THROW_EXCEPTION(InvalidSnapshot, std::format("inconsistent block for {}", typeid(T).name()));
+            if (std::ranges::any_of(block->dense, [](const Entity entity) { return entity >= MAX_ENTITIES; }))
+                THROW_EXCEPTION(InvalidSnapshot, std::format("entity out of range in {}", typeid(T).name()));
+            block->groupSize = static_cast<size_t>(groupSize);
+            return block;
+        }
+
+        /**
+         * @brief Replaces the content of the array with a block returned by parseSnapshot()
+         *
+         * The dense order, and therefore the group region, is restored exactly.
+         *
+         * @param block The parsed content, moved from
+         */
+        void commitSnapshot(ComponentSnapshotBlock &block) override
+        {
+            auto &parsed = static_cast<SnapshotBlock &>(block);
+            for (size_t i = 0; i < m_size; ++i)
+                m_sparse.erase(m_dense[i]);
+            m_dense = std::move(parsed.dense);
+            m_changeTicks = std::move(parsed.changeTicks);
+            m_componentArray = std::move(parsed.components);
+            m_size = m_dense.size();
+            m_groupSize = parsed.groupSize;
+            for (size_t i = 0; i < m_size; ++i)
+                m_sparse.set(m_dense[i], i);
+            clearPendingEvents();
         }
 
     private:
+        // Dense storage parsed from a snapshot, swapped in by commitSnapshot().
+        struct SnapshotBlock final : ComponentSnapshotBlock {
+            size_t groupSize = 0;
+            std::vector<Entity> dense;
+            std::vector<Tick> changeTicks;
+            std::vector<T> components;
+        };
+
         // Dense storage for components.
         std::vector<T> m_componentArray;
         // Sparse mapping: maps entity ID to index in the dense arrays.
-        std::vector<size_t> m_sparse;
+        PagedSparseIndex m_sparse;
         // Dense storage for entity IDs.
         std::vector<Entity> m_dense;
         // Current number of active components.
         size_t m_size = 0;
         // The first m_groupSize entries in m_dense/m_componentArray are considered "grouped".
         size_t m_groupSize = 0;
+        // Tick of the last write for each component, parallel to m_componentArray.
+        std::vector<Tick> m_changeTicks;
+        // Tick stamped on inserted or changed components.
+        Tick m_currentTick = FIRST_TICK;
+        // Snapshot callbacks for components that are not trivially copyable.
+        ComponentSerializer<T> m_serializer;
+
+        /**
+         * @brief Grows the sparse and dense storage once for a batch of insertions
+         *
+         * @param count Number of components about to be inserted
+         * @param maxEntity Highest entity ID of the batch
+         * @throws OutOfRange if maxEntity is beyond MAX_ENTITIES
+         */
+        void reserveBatch(const size_t count, const Entity maxEntity)
+        {
+            if (count == 0)
+                return;
+            if (maxEntity >= MAX_ENTITIES)
+                THROW_EXCEPTION(OutOfRange, maxEntity);
+            m_sparse.reserve(maxEntity);
+
+            const size_t required = m_size + count;
+            if (required > m_componentArray.capacity()) {
+                const size_t newCapacity = std::max(required, m_componentArray.capacity() * 2);
+                m_componentArray.reserve(newCapacity);
+                m_dense.reserve(newCapacity);
+                m_changeTicks.reserve(newCapacity);
+            }
+        }
 
         /**
-         * @brief Ensures m_sparse is large enough to index 'entity'
+         * @brief Appends a component at the end of the dense storage
          *
-         * @param entity The entity to ensure capacity for
+         * @param entity The entity receiving the component
+         * @param component The component value
          */
-        void ensureSparseCapacity(const Entity entity)
+        void appendComponent(const Entity entity, const T &component)
         {
-            if (entity >= m_sparse.size()) {
-                size_t newSize = m_sparse.size();
-                if (newSize == 0)
-                    newSize = capacity;
-                while (entity >= newSize)
-                    newSize *= 2;
-                m_sparse.resize(newSize, INVALID_ENTITY);
+            if (hasComponent(entity)) {
+                LOG(PARALLAX_WARN, "Entity {} already has component: {}", entity, typeid(T).name());
+                return;
             }
+
+            m_sparse.set(entity, m_size);
+            m_dense.push_back(entity);
+            m_componentArray.push_back(component);
+            m_changeTicks.push_back(m_currentTick);
+            ++m_size;
+            recordAdded(entity);
         }
 
         /**
@@ -622,10 +1188,12 @@ namespace parallax::ecs {
 
                 m_componentArray.shrink_to_fit();
                 m_dense.shrink_to_fit();
+                m_changeTicks.shrink_to_fit();
 
                 // Reserve the optimized capacity to ensure future growth is efficient
                 m_componentArray.reserve(newCapacity);
                 m_dense.reserve(newCapacity);
+                m_changeTicks.reserve(newCapacity);
             }
         }
     };
@@ -700,6 +1268,12 @@ namespace parallax::ecs {
 
         [[nodiscard]] std::span<const Entity> entities() const override;
 
+        void setCurrentTick(Tick tick) override;
+
+        void markChanged(Entity entity) override;
+
+        [[nodiscard]] Tick getChangeTick(Entity entity) const override;
+
         /**
          * @brief Gets the entity at the given index in the dense array
          * @param index The index to look up
@@ -725,17 +1299,27 @@ namespace parallax::ecs {
          */
         [[nodiscard]] constexpr size_t groupSize() const;
 
-        /**
-         * @brief Get the estimated memory usage of this component array
-         * @return Size in bytes of memory used by this component array
-         */
-        [[nodiscard]] size_t memoryUsage() const;
+        [[nodiscard]] ComponentMemoryUsage memoryUsage() const override;
+
+        void snapshot(SnapshotWriter &writer) const override;
+
+        [[nodiscard]] std::unique_ptr<ComponentSnapshotBlock> parseSnapshot(SnapshotReader &reader) const override;
+
+        void commitSnapshot(ComponentSnapshotBlock &block) override;
 
     private:
+        // Dense storage parsed from a snapshot, swapped in by commitSnapshot()
+        struct SnapshotBlock final : ComponentSnapshotBlock {
+            size_t groupSize = 0;
+            std::vector<Entity> dense;
+            std::vector<Tick> changeTicks;
+            std::vector<std::byte> componentData;
+        };
+
         // Component data storage
         std::vector<std::byte> m_componentData;
         // Sparse mapping: maps entity ID to index in the dense arrays
-        std::vector<size_t> m_sparse;
+        PagedSparseIndex m_sparse;
         // Dense storage for entity IDs
         std::vector<Entity> m_dense;
         // Size of each component in bytes
@@ -746,8 +1330,10 @@ namespace parallax::ecs {
         size_t m_size = 0;
         // Group size for component grouping
         size_t m_groupSize = 0;
-
-        void ensureSparseCapacity(Entity entity);
+        // Tick of the last write for each component
+        std::vector<Tick> m_changeTicks;
+        // Tick stamped on inserted or changed components
+        Tick m_currentTick = FIRST_TICK;
 
         void swapComponents(size_t index1, size_t index2);
 
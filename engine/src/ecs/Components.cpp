@@ -22,14 +22,204 @@ namespace parallax::ecs {
 
     void ComponentManager::entityDestroyed(const Entity entity, const Signature &entitySignature)
     {
-        for (const auto &group: m_groupRegistry | std::views::values) {
-            if ((entitySignature & group->allSignature()) == group->allSignature())
+        m_groupIndex.forEachReferencing(entitySignature, [&](const Signature &groupSignature, const auto &group) {
+            ++m_signatureEvaluations;
+            if ((entitySignature & groupSignature) == groupSignature)
                 group->removeFromGroup(entity);
-        }
+        });
         for (const auto& componentArray : m_componentArrays) {
             if (componentArray)
                 componentArray->entityDestroyed(entity);
         }
     }
 
+    void ComponentManager::snapshot(SnapshotWriter &writer) const
+    {
+        Signature registered;
+        for (ComponentType type = 0; type < MAX_COMPONENT_TYPE; ++type)
+            registered.set(type, m_componentArrays[type] != nullptr);
+
+        writer.write<Tick>(m_currentTick);
+        writer.write<std::uint64_t>(registered.to_ullong());
+        for (const auto& componentArray : m_componentArrays) {
+            if (componentArray)
+                writer.write<std::uint64_t>(componentArray->getComponentSize());
+        }
+        for (const auto& componentArray : m_componentArrays) {
+            if (componentArray)
+                componentArray->snapshot(writer);
+        }
+    }
+
+    void ComponentManager::restore(SnapshotReader &reader)
+    {
+        const auto tick = reader.read<Tick>();
+        const Signature registered(reader.read<std::uint64_t>());
+        for (ComponentType type = 0; type < MAX_COMPONENT_TYPE; ++type) {
+            if (registered.test(type) != (m_componentArrays[type] != nullptr))
+                THROW_EXCEPTION(InvalidSnapshot, std::format("component type {} registration differs", type));
+        }
+        for (ComponentType type = 0; type < MAX_COMPONENT_TYPE; ++type) {
+            if (!registered.test(type))
+                continue;
+            if (reader.read<std::uint64_t>() != m_componentArrays[type]->getComponentSize())
+                THROW_EXCEPTION(InvalidSnapshot, std::format("component type {} size differs", type));
+        }
+
+        // Every block is parsed before the first array is replaced, so a truncated or corrupt
+        // block further in the stream leaves all the arrays untouched
+        std::array<std::unique_ptr<ComponentSnapshotBlock>, MAX_COMPONENT_TYPE> blocks;
+        for (ComponentType type = 0; type < MAX_COMPONENT_TYPE; ++type) {
+            if (m_componentArrays[type])
+                blocks[type] = m_componentArrays[type]->parseSnapshot(reader);
+        }
+        for (ComponentType type = 0; type < MAX_COMPONENT_TYPE; ++type) {
+            if (blocks[type])
+                m_componentArrays[type]->commitSnapshot(*blocks[type]);
+        }
+
+        m_currentTick = tick;
+        for (const auto& componentArray : m_componentArrays) {
+            if (componentArray)
+                componentArray->setCurrentTick(m_currentTick);
+        }
+        for (const auto& group : std::views::values(m_groupRegistry))
+            group->invalidateOrdering();
+    }
+
+    ObserverId ComponentManager::addObserver(const ComponentType componentType, const ComponentEvent event, ComponentObserver callback)
+    {
+        if (!m_componentArrays[componentType])
+            THROW_EXCEPTION(ComponentNotRegistered);
+        const ObserverId id = m_nextObserverId++;
+        m_observers.push_back({id, componentType, event, std::move(callback)});
+        updateObservedEvents(componentType);
+        return id;
+    }
+
+    void ComponentManager::removeObserver(const ObserverId id)
+    {
+        const auto it = std::ranges::find(m_observers, id, &ObserverEntry::id);
+        if (it == m_observers.end() || !it->callback)
+            return;
+
+        const ComponentType componentType = it->componentType;
+        // Entries are only erased outside of a flush so that delivery can keep iterating by index
+        if (m_flushingObservers)
+            it->callback = nullptr;
+        else
+            m_observers.erase(it);
+        updateObservedEvents(componentType);
+    }
+
+    void ComponentManager::updateObservedEvents(const ComponentType componentType) const
+    {
+        std::uint8_t mask = 0;
+        for (const auto &observer : m_observers) {
+            if (observer.componentType == componentType && observer.callback)
+                mask |= static_cast<std::uint8_t>(observer.event);
+        }
+        if (m_componentArrays[componentType])
+            m_componentArrays[componentType]->setObservedEvents(mask);
+    }
+
+    void ComponentManager::notifyObservers(const ComponentType componentType, const ComponentEvent event, const std::span<const Entity> entities)
+    {
+        if (entities.empty())
+            return;
+        // Observers registered by a callback only receive the next batches
+        const size_t count = m_observers.size();
+        for (size_t i = 0; i < count; ++i) {
+            const ObserverEntry &observer = m_observers[i];
+            if (observer.componentType == componentType && observer.event == event && observer.callback)
+                observer.callback(entities);
+        }
+    }
+
+    void ComponentManager::flushObservers()
+    {
+        if (m_flushingObservers || m_observers.empty())
+            return;
+        m_flushingObservers = true;
+
+        const auto sortUnique = [](std::vector<Entity> &entities) {
+            std::ranges::sort(entities);
+            const auto duplicates = std::ranges::unique(entities);
+            entities.erase(duplicates.begin(), duplicates.end());
+        };
+
+        ComponentEvents events;
+        try {
+            for (ComponentType type = 0; type < MAX_COMPONENT_TYPE; ++type) {
+                const auto &componentArray = m_componentArrays[type];
+                if (!componentArray || componentArray->observedEvents() == 0)
+                    continue;
+                componentArray->takePendingEvents(events);
+                if (events.empty())
+                    continue;
+
+                sortUnique(events.removed);
+                notifyObservers(type, ComponentEvent::Removed, events.removed);
+
+                // An entity added then removed within the batch is only reported as removed
+                sortUnique(events.added);
+                std::erase_if(events.added, [&](const Entity entity) { return !componentArray->hasComponent(entity); });
+                notifyObservers(type, ComponentEvent::Added, events.added);
+
+                sortUnique(events.changed);
+                std::erase_if(events.changed, [&](const Entity entity) {
+                    return !componentArray->hasComponent(entity) || std::ranges::binary_search(events.added, entity);
+                });
+                notifyObservers(type, ComponentEvent::Changed, events.changed);
+            }
+        } catch (...) {
+            m_flushingObservers = false;
+            std::erase_if(m_observers, [](const ObserverEntry &observer) { return !observer.callback; });
+            throw;
+        }
+
+        m_flushingObservers = false;
+        std::erase_if(m_observers, [](const ObserverEntry &observer) { return !observer.callback; });
+    }
+
+    std::vector<std::pair<ComponentType, ComponentMemoryUsage>> ComponentManager::getMemoryUsage() const
+    {
+        std::vector<std::pair<ComponentType, ComponentMemoryUsage>> usage;
+        for (ComponentType type = 0; type < MAX_COMPONENT_TYPE; ++type) {
+            if (m_componentArrays[type])
+                usage.emplace_back(type, m_componentArrays[type]->memoryUsage());
+        }
+        return usage;
+    }
+
+    void ComponentManager::leaveGroups(const Entity entity, const Signature &previousSignature, const Signature &newSignature) const
+    {
+        m_groupIndex.forEachReferencing(previousSignature ^ newSignature, [&](const Signature &groupSignature, const auto &group) {
+            ++m_signatureEvaluations;
+            if (((previousSignature & groupSignature) == groupSignature) &&
+                ((newSignature & groupSignature) != groupSignature))
+                group->removeFromGroup(entity);
+        });
+    }
+
+    void ComponentManager::joinGroups(const Entity entity, const Signature &previousSignature, const Signature &newSignature) const
+    {
+        m_groupIndex.forEachReferencing(previousSignature ^ newSignature, [&](const Signature &groupSignature, const auto &group) {
+            ++m_signatureEvaluations;
+            if (((previousSignature & groupSignature) != groupSignature) &&
+                ((newSignature & groupSignature) == groupSignature))
+                group->addToGroup(entity);
+        });
+    }
+
+    void ComponentManager::joinGroups(const std::span<const Entity> entities, const Signature &previousSignature, const Signature &newSignature) const
+    {
+        m_groupIndex.forEachReferencing(previousSignature ^ newSignature, [&](const Signature &groupSignature, const auto &group) {
+            ++m_signatureEvaluations;
+            if (((previousSignature & groupSignature) != groupSignature) &&
+                ((newSignature & groupSignature) == groupSignature))
+                group->addToGroup(entities);
+        });
+    }
+
 }
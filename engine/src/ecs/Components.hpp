@@ -37,6 +37,7 @@
 #include "Logger.hpp"
 #include "ComponentArray.hpp"
 #include "Group.hpp"
+#include "SignatureIndex.hpp"
 
 namespace parallax::ecs {
 	/**
@@ -186,6 +187,16 @@ namespace parallax::ecs {
 	 * - Managing component group registrations
 	 * - Handling entity destruction with respect to components
 	 */
+	/**
+	 * @brief Callback receiving one batch of entities for an observed component event
+	 */
+	using ComponentObserver = std::function<void(std::span<const Entity>)>;
+
+	/**
+	 * @brief Identifier returned when registering a component observer, used to unregister it
+	 */
+	using ObserverId = std::uint32_t;
+
 	class ComponentManager {
 		public:
 		    ComponentManager() = default;
@@ -238,6 +249,7 @@ namespace parallax::ecs {
 		        }
 
 		        m_componentArrays[typeID] = std::make_shared<ComponentArray<T>>();
+		        m_componentArrays[typeID]->setCurrentTick(m_currentTick);
 		    }
 
 	        ComponentType registerComponent(const size_t componentSize, const size_t initialCapacity = 1024)
@@ -247,9 +259,49 @@ namespace parallax::ecs {
 
 		        assert(m_componentArrays[typeID] == nullptr && "TypeErasedComponent already registered, should really not happen");
 		        m_componentArrays[typeID] = std::make_shared<TypeErasedComponentArray>(componentSize, initialCapacity);
+		        m_componentArrays[typeID]->setCurrentTick(m_currentTick);
 		        return typeID;
 		    }
 
+		    /**
+		     * @brief Advances the change-detection tick
+		     *
+		     * Every component inserted or marked as changed afterwards is stamped with the new tick.
+		     *
+		     * @return The new current tick
+		     */
+		    Tick advanceTick()
+		    {
+		        ++m_currentTick;
+		        for (const auto& componentArray : m_componentArrays) {
+		            if (componentArray)
+		                componentArray->setCurrentTick(m_currentTick);
+		        }
+		        return m_currentTick;
+		    }
+
+		    /**
+		     * @brief Gets the current change-detection tick
+		     *
+		     * @return The tick stamped on components written right now
+		     */
+		    [[nodiscard]] Tick getCurrentTick() const
+		    {
+		        return m_currentTick;
+		    }
+
+		    /**
+		     * @brief Stamps the component of an entity with the current tick
+		     *
+		     * @param entity The entity whose component was written
+		     * @param componentType The type ID of the written component
+		     */
+		    void markChanged(const Entity entity, const ComponentType componentType) const
+		    {
+		        if (m_componentArrays[componentType])
+		            m_componentArrays[componentType]->markChanged(entity);
+		    }
+
 		    /**
 		     * @brief Gets the unique identifier for a component type
 		     *
@@ -285,13 +337,7 @@ namespace parallax::ecs {
 			{
 		        getComponentArray<T>()->insert(entity, std::move(component));
 
-				for (const auto& group : std::ranges::views::values(m_groupRegistry)) {
-				    // Check if entity qualifies now but did not qualify before.
-                    if (((oldSignature & group->allSignature()) != group->allSignature()) &&
-                            ((newSignature & group->allSignature()) == group->allSignature())) {
-		    			group->addToGroup(entity);
-					}
-				}
+				joinGroups(entity, oldSignature, newSignature);
 		    }
 
 	        /**
@@ -314,13 +360,7 @@ namespace parallax::ecs {
 		    {
 		        getComponentArray(componentType)->insertRaw(entity, componentData);
 
-		        for (const auto& group : std::ranges::views::values(m_groupRegistry)) {
-		            // Check if entity qualifies now but did not qualify before.
-		            if (((oldSignature & group->allSignature()) != group->allSignature()) &&
-                            ((newSignature & group->allSignature()) == group->allSignature())) {
-		                group->addToGroup(entity);
-                    }
-		        }
+		        joinGroups(entity, oldSignature, newSignature);
 		    }
 
 	        /**
@@ -338,14 +378,7 @@ namespace parallax::ecs {
              */
 	        void removeComponent(const Entity entity, const ComponentType componentType, const Signature previousSignature, const Signature newSignature)
 		    {
-		        for (const auto& group : std::ranges::views::values(m_groupRegistry))
-		        {
-		            if (((previousSignature & group->allSignature()) == group->allSignature()) &&
-                        ((newSignature & group->allSignature()) != group->allSignature()))
-		            {
-		                group->removeFromGroup(entity);
-		            }
-		        }
+		        leaveGroups(entity, previousSignature, newSignature);
 		        getComponentArray(componentType)->remove(entity);
 		    }
 
@@ -364,14 +397,7 @@ namespace parallax::ecs {
             template<typename T>
             void removeComponent(Entity entity, const Signature previousSignature, const Signature newSignature)
             {
-                for (const auto& group : std::ranges::views::values(m_groupRegistry))
-                {
-                    // If the entity no longer qualifies but did before, remove it.
-                    if (((previousSignature & group->allSignature()) == group->allSignature()) &&
-                    ((newSignature & group->allSignature()) != group->allSignature())) {
-                        group->removeFromGroup(entity);
-                    }
-                }
+                leaveGroups(entity, previousSignature, newSignature);
                 getComponentArray<T>()->remove(entity);
             }
 
@@ -394,14 +420,7 @@ namespace parallax::ecs {
 		        if (!componentArray->hasComponent(entity))
 		            return false;
 
-				for (const auto& group : std::ranges::views::values(m_groupRegistry))
-				{
-				    // If the entity no longer qualifies but did before, remove it.
-                    if (((previousSignature & group->allSignature()) == group->allSignature()) &&
-                    ((newSignature & group->allSignature()) != group->allSignature())) {
-                        group->removeFromGroup(entity);
-                    }
-				}
+				leaveGroups(entity, previousSignature, newSignature);
 		        componentArray->remove(entity);
 		        return true;
 		    }
@@ -442,13 +461,7 @@ namespace parallax::ecs {
 			    const auto& componentArray = m_componentArrays[componentType];
 				componentArray->duplicateComponent(sourceEntity, destEntity);
 
-				for (const auto& group : std::ranges::views::values(m_groupRegistry)) {
-				    // Check if entity qualifies now but did not qualify before.
-                    if (((oldSignature & group->allSignature()) != group->allSignature()) &&
-                            ((newSignature & group->allSignature()) == group->allSignature())) {
-		    			group->addToGroup(destEntity);
-					}
-				}
+				joinGroups(destEntity, oldSignature, newSignature);
 			}
 
 	        /**
@@ -538,6 +551,157 @@ namespace parallax::ecs {
 		     */
 		    void entityDestroyed(Entity entity, const Signature &entitySignature);
 
+		    /**
+		     * @brief Reports the memory held by every registered component array
+		     *
+		     * @return Pairs of component type and memory breakdown, ordered by component type
+		     */
+		    [[nodiscard]] std::vector<std::pair<ComponentType, ComponentMemoryUsage>> getMemoryUsage() const;
+
+		    /**
+		     * @brief Writes the current tick, the registered component layout and every component array to a snapshot
+		     *
+		     * @param writer Destination stream
+		     * @throws ComponentNotSerializable if an array holds components that cannot be written
+		     */
+		    void snapshot(SnapshotWriter &writer) const;
+
+		    /**
+		     * @brief Replaces every component array with the content written by snapshot()
+		     *
+		     * The layout is checked and every array block is parsed before any array is touched: the
+		     * same component types must be registered, with the same sizes. Groups keep their regions since the dense order is
+		     * restored exactly, only their sorting and partitions are invalidated.
+		     *
+		     * @param reader Source stream
+		     * @throws InvalidSnapshot if the layout does not match or the data is inconsistent
+		     */
+		    void restore(SnapshotReader &reader);
+
+		    /**
+		     * @brief Removes an entity from every group it stops qualifying for
+		     *
+		     * Must be called before the components missing from newSignature are removed from their arrays.
+		     *
+		     * @param entity The entity changing signature
+		     * @param previousSignature The entity's current signature
+		     * @param newSignature The entity's signature once the change is applied
+		     */
+		    void leaveGroups(Entity entity, const Signature &previousSignature, const Signature &newSignature) const;
+
+		    /**
+		     * @brief Adds an entity to every group it starts qualifying for
+		     *
+		     * Must be called once the components gained in newSignature have been inserted in their arrays.
+		     *
+		     * @param entity The entity changing signature
+		     * @param previousSignature The entity's signature before the change
+		     * @param newSignature The entity's new signature
+		     */
+		    void joinGroups(Entity entity, const Signature &previousSignature, const Signature &newSignature) const;
+
+		    /**
+		     * @brief Adds a batch of entities sharing the same signature change to the groups they start qualifying for
+		     *
+		     * Each group is visited once for the whole batch.
+		     *
+		     * @param entities The entities changing signature
+		     * @param previousSignature The signature of the entities before the change
+		     * @param newSignature The new signature of the entities
+		     */
+		    void joinGroups(std::span<const Entity> entities, const Signature &previousSignature, const Signature &newSignature) const;
+
+		    /**
+		     * @brief Registers an observer called with the entities that received a component of type T
+		     *
+		     * Notifications are queued by the component array and delivered by flushObservers(),
+		     * never synchronously from the insertion itself.
+		     *
+		     * @tparam T The observed component type
+		     * @param callback Called once per flush with the entities, sorted and without duplicates
+		     * @return ObserverId Identifier to pass to removeObserver()
+		     * @throws ComponentNotRegistered if T is not registered
+		     */
+		    template<typename T>
+		    ObserverId onAdd(ComponentObserver callback)
+		    {
+		        return addObserver(getComponentTypeID<T>(), ComponentEvent::Added, std::move(callback));
+		    }
+
+		    /**
+		     * @brief Registers an observer called with the entities that lost their component of type T
+		     *
+		     * Destroyed entities are reported as well. The component data is gone when the batch is delivered.
+		     *
+		     * @tparam T The observed component type
+		     * @param callback Called once per flush with the entities, sorted and without duplicates
+		     * @return ObserverId Identifier to pass to removeObserver()
+		     * @throws ComponentNotRegistered if T is not registered
+		     */
+		    template<typename T>
+		    ObserverId onRemove(ComponentObserver callback)
+		    {
+		        return addObserver(getComponentTypeID<T>(), ComponentEvent::Removed, std::move(callback));
+		    }
+
+		    /**
+		     * @brief Registers an observer called with the entities whose component of type T was marked as changed
+		     *
+		     * An entity written several times between two flushes is reported once, and entities
+		     * added during the same batch are only reported to onAdd observers.
+		     *
+		     * @tparam T The observed component type
+		     * @param callback Called once per flush with the entities, sorted and without duplicates
+		     * @return ObserverId Identifier to pass to removeObserver()
+		     * @throws ComponentNotRegistered if T is not registered
+		     */
+		    template<typename T>
+		    ObserverId onChange(ComponentObserver callback)
+		    {
+		        return addObserver(getComponentTypeID<T>(), ComponentEvent::Changed, std::move(callback));
+		    }
+
+		    /**
+		     * @brief Registers an observer for a component type ID
+		     *
+		     * @param componentType The observed component type
+		     * @param event The observed mutation kind
+		     * @param callback Called once per flush with the entities, sorted and without duplicates
+		     * @return ObserverId Identifier to pass to removeObserver()
+		     * @throws ComponentNotRegistered if the component type is not registered
+		     */
+		    ObserverId addObserver(ComponentType componentType, ComponentEvent event, ComponentObserver callback);
+
+		    /**
+		     * @brief Unregisters an observer
+		     *
+		     * Safe to call from inside an observer callback. Unknown identifiers are ignored.
+		     *
+		     * @param id The identifier returned at registration
+		     */
+		    void removeObserver(ObserverId id);
+
+		    /**
+		     * @brief Delivers every queued component event, one batch per component type and event kind
+		     *
+		     * For each observed type, removals are delivered first, then additions of entities that
+		     * still own the component, then changes of the remaining ones. Mutations performed by the
+		     * callbacks are queued for the next flush. Must be called at a sync point, while no system is running.
+		     */
+		    void flushObservers();
+
+		    /**
+		     * @brief Gets the number of group signatures tested since the last reset
+		     *
+		     * @return std::size_t Signature evaluation count
+		     */
+		    [[nodiscard]] std::size_t getSignatureEvaluationCount() const { return m_signatureEvaluations; }
+
+		    /**
+		     * @brief Resets the group signature evaluation counter, typically once per frame
+		     */
+		    void resetSignatureEvaluationCount() { m_signatureEvaluations = 0; }
+
 			/**
 			 * @brief Creates or retrieves a group for specific component combinations
 			 *
@@ -582,6 +746,7 @@ namespace parallax::ecs {
 
 			    auto group = createNewGroup<Owned...>(nonOwned);
 			    m_groupRegistry[newGroupKey] = group;
+			    m_groupIndex.insert(group->allSignature(), group);
 			    return group;
 			}
 
@@ -641,6 +806,55 @@ namespace parallax::ecs {
 			 */
 			std::unordered_map<GroupKey, std::shared_ptr<IGroup>> m_groupRegistry;
 
+			/**
+			 * @brief Groups indexed by the component types of their signature
+			 *
+			 * Signature changes only visit the groups referencing one of the changed components.
+			 */
+			SignatureIndex<std::shared_ptr<IGroup>> m_groupIndex;
+
+			/**
+			 * @brief Number of group signatures tested since the last reset
+			 */
+			mutable std::size_t m_signatureEvaluations = 0;
+
+			/**
+			 * @brief Current change-detection tick, broadcast to every component array
+			 */
+			Tick m_currentTick = FIRST_TICK;
+
+			struct ObserverEntry {
+				ObserverId id;
+				ComponentType componentType;
+				ComponentEvent event;
+				ComponentObserver callback; ///< Empty once removed during a flush, erased afterwards
+			};
+
+			/**
+			 * @brief Registered observers, in registration order
+			 */
+			std::vector<ObserverEntry> m_observers;
+
+			/**
+			 * @brief Identifier given to the next registered observer
+			 */
+			ObserverId m_nextObserverId = 0;
+
+			/**
+			 * @brief Whether flushObservers() is delivering, removals are then deferred
+			 */
+			bool m_flushingObservers = false;
+
+			/**
+			 * @brief Recomputes the mask of recorded events of a component array from its observers
+			 */
+			void updateObservedEvents(ComponentType componentType) const;
+
+			/**
+			 * @brief Calls the observers of one component type and event kind with a batch
+			 */
+			void notifyObservers(ComponentType componentType, ComponentEvent event, std::span<const Entity> entities);
+
 			/**
 			 * @brief Helper function to get the tuple of non-owned component arrays
 			 *
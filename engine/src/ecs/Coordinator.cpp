@@ -18,6 +18,8 @@
 
 #include "Coordinator.hpp"
 
+#include <algorithm>
+
 std::shared_ptr<parallax::ecs::Coordinator> parallax::ecs::System::coord = nullptr;
 
 namespace parallax::ecs {
@@ -28,6 +30,7 @@ namespace parallax::ecs {
         m_entityManager = std::make_shared<EntityManager>();
         m_systemManager = std::make_shared<SystemManager>();
         m_singletonComponentManager = std::make_shared<SingletonComponentManager>();
+        m_hierarchy = std::make_shared<Hierarchy>();
 
         System::coord = std::shared_ptr<Coordinator>(this, [](const Coordinator*) {});
 
@@ -39,12 +42,188 @@ namespace parallax::ecs {
         return m_entityManager->createEntity();
     }
 
+    void Coordinator::commitBatch(const std::span<const Entity> entities, const Signature signature) const
+    {
+        for (const Entity entity : entities)
+            m_entityManager->setSignature(entity, signature);
+        m_componentManager->joinGroups(entities, Signature{}, signature);
+        m_systemManager->entitiesSignatureChanged(entities, Signature{}, signature);
+    }
+
+    std::vector<Entity> Coordinator::collectMatchingEntities(const Signature required, const Signature excluded) const
+    {
+        std::span<const Entity> candidates = m_entityManager->getLivingEntities();
+        for (ComponentType type = 0; type < MAX_COMPONENT_TYPE; ++type) {
+            if (!required.test(type))
+                continue;
+            const std::span<const Entity> owners = m_componentManager->getComponentArray(type)->entities();
+            if (owners.size() < candidates.size())
+                candidates = owners;
+        }
+
+        std::vector<Entity> result;
+        result.reserve(candidates.size());
+        for (const Entity entity : candidates) {
+            const Signature signature = m_entityManager->getSignature(entity);
+            if ((signature & required) == required && (signature & excluded).none())
+                result.push_back(entity);
+        }
+        return result;
+    }
+
+    std::shared_ptr<EntityQuery> Coordinator::getOrRegisterQuery(const Signature required, const Signature excluded) const
+    {
+        if (auto query = m_systemManager->getQuery(required, excluded))
+            return query;
+        return m_systemManager->registerQuery(required, excluded, collectMatchingEntities(required, excluded));
+    }
+
     void Coordinator::destroyEntity(const Entity entity) const
     {
         const Signature signature = m_entityManager->getSignature(entity);
         m_entityManager->destroyEntity(entity);
         m_componentManager->entityDestroyed(entity, signature);
         m_systemManager->entityDestroyed(entity, signature);
+        m_hierarchy->remove(entity);
+    }
+
+    EntityHandle Coordinator::getEntityHandle(const Entity entity) const
+    {
+        return m_entityManager->getHandle(entity);
+    }
+
+    bool Coordinator::isEntityValid(const EntityHandle handle) const
+    {
+        return m_entityManager->isValid(handle);
+    }
+
+    EntityCommandBuffer &Coordinator::getCommandBuffer()
+    {
+        thread_local std::uint64_t t_cachedCoordinator = 0;
+        thread_local std::uint64_t t_cachedGeneration = 0;
+        thread_local EntityCommandBuffer *t_cachedBuffer = nullptr;
+        const std::uint64_t generation = m_commandBuffersGeneration.load(std::memory_order_acquire);
+        if (t_cachedCoordinator == m_coordinatorId && t_cachedGeneration == generation)
+            return *t_cachedBuffer;
+
+        const std::thread::id threadId = std::this_thread::get_id();
+        std::scoped_lock lock(m_commandBuffersMutex);
+        auto it = std::ranges::find(m_commandBuffers, threadId, [](const auto &entry) { return entry.first; });
+        if (it == m_commandBuffers.end()) {
+            m_commandBuffers.emplace_back(threadId, std::make_unique<EntityCommandBuffer>());
+            it = std::prev(m_commandBuffers.end());
+        }
+
+        t_cachedCoordinator = m_coordinatorId;
+        t_cachedGeneration = generation;
+        t_cachedBuffer = it->second.get();
+        return *t_cachedBuffer;
+    }
+
+    void Coordinator::flushCommandBuffers()
+    {
+        decltype(m_commandBuffers) pending;
+        {
+            std::scoped_lock lock(m_commandBuffersMutex);
+            pending.swap(m_commandBuffers);
+            // Threads recording from now on, including from the playback itself, get a fresh buffer
+            m_commandBuffersGeneration.fetch_add(1, std::memory_order_acq_rel);
+        }
+
+        for (const auto &buffer : pending | std::views::values)
+            buffer->playback(*this);
+
+        // Hand the emptied buffers back so their storage is reused. A thread that recorded during
+        // the playback keeps its new buffer, in the slot of its old one.
+        std::scoped_lock lock(m_commandBuffersMutex);
+        for (auto &[threadId, buffer] : m_commandBuffers) {
+            auto it = std::ranges::find(pending, threadId, [](const auto &entry) { return entry.first; });
+            if (it != pending.end())
+                it->second = std::move(buffer);
+            else
+                pending.emplace_back(threadId, std::move(buffer));
+        }
+        m_commandBuffers = std::move(pending);
+    }
+
+    void Coordinator::removeObserver(const ObserverId id) const
+    {
+        m_componentManager->removeObserver(id);
+    }
+
+    void Coordinator::flushObservers() const
+    {
+        m_componentManager->flushObservers();
+    }
+
+    Tick Coordinator::advanceTick() const
+    {
+        return m_componentManager->advanceTick();
+    }
+
+    std::vector<std::pair<ComponentType, ComponentMemoryUsage>> Coordinator::getComponentMemoryUsage() const
+    {
+        return m_componentManager->getMemoryUsage();
+    }
+
+    SignatureEvaluationStats Coordinator::getSignatureEvaluationStats() const
+    {
+        return {
+            .querySystemEvaluations = m_systemManager->getSignatureEvaluationCount(),
+            .groupEvaluations = m_componentManager->getSignatureEvaluationCount()
+        };
+    }
+
+    void Coordinator::resetSignatureEvaluationStats() const
+    {
+        m_systemManager->resetSignatureEvaluationCount();
+        m_componentManager->resetSignatureEvaluationCount();
+    }
+
+    WorldSnapshot Coordinator::snapshot() const
+    {
+        WorldSnapshot snapshot;
+        SnapshotWriter writer(snapshot.data);
+        writer.write(SNAPSHOT_MAGIC);
+        writer.write(SNAPSHOT_VERSION);
+        m_entityManager->snapshot(writer);
+        m_hierarchy->snapshot(writer);
+        m_componentManager->snapshot(writer);
+        return snapshot;
+    }
+
+    void Coordinator::restore(const WorldSnapshot &snapshot)
+    {
+        SnapshotReader reader(snapshot.data);
+        if (reader.read<std::uint32_t>() != SNAPSHOT_MAGIC)
+            THROW_EXCEPTION(InvalidSnapshot, "not a world snapshot");
+        if (const auto version = reader.read<std::uint32_t>(); version != SNAPSHOT_VERSION)
+            THROW_EXCEPTION(InvalidSnapshot, std::format("unsupported version {}", version));
+
+        // Entities and the hierarchy are parsed aside so a rejected snapshot leaves them untouched
+        EntityManager entityManager;
+        entityManager.restore(reader);
+        Hierarchy hierarchy;
+        hierarchy.restore(reader);
+        m_componentManager->restore(reader);
+        *m_entityManager = std::move(entityManager);
+        // The version must move past the live one, or caches built for the old hierarchy would stay valid
+        m_hierarchy->replaceWith(std::move(hierarchy));
+
+        // Systems are refilled through the batched dispatch, once per distinct signature
+        m_systemManager->clearEntities();
+        std::unordered_map<Signature, std::vector<Entity>> entitiesBySignature;
+        for (const Entity entity : m_entityManager->getLivingEntities()) {
+            if (const Signature signature = m_entityManager->getSignature(entity); signature.any())
+                entitiesBySignature[signature].push_back(entity);
+        }
+        for (const auto &[signature, entities] : entitiesBySignature)
+            m_systemManager->entitiesSignatureChanged(entities, Signature{}, signature);
+    }
+
+    Tick Coordinator::getCurrentTick() const
+    {
+        return m_componentManager->getCurrentTick();
     }
 
     std::vector<ComponentType> Coordinator::getAllComponentTypes(const Entity entity) const
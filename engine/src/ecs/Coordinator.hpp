@@ -21,11 +21,16 @@
 
 #include <memory>
 #include <any>
+#include <atomic>
+#include <mutex>
+#include <thread>
 
 #include "Components.hpp"
 #include "System.hpp"
 #include "SingletonComponent.hpp"
 #include "Entity.hpp"
+#include "EntityCommandBuffer.hpp"
+#include "Hierarchy.hpp"
 #include "Logger.hpp"
 #include "TypeErasedComponent/ComponentDescription.hpp"
 
@@ -135,10 +140,56 @@ namespace parallax::ecs {
             /**
             * @brief Destroys an entity and cleans up its components and system references.
             *
+            * If the entity is part of the hierarchy, its children are attached to its parent.
+            *
             * @param entity - The ID of the entity to destroy.
             */
             void destroyEntity(Entity entity) const;
 
+            /**
+            * @brief Gets the parent / child relationships between entities.
+            *
+            * @return Hierarchy& - The flat, depth-first hierarchy store of the world.
+            */
+            [[nodiscard]] Hierarchy &getHierarchy() const { return *m_hierarchy; }
+
+            /**
+            * @brief Builds a generation-counted handle for a living entity.
+            *
+            * Handles can be stored across frames and validated later with isEntityValid().
+            *
+            * @param entity - The ID of the entity.
+            * @return EntityHandle - The handle, or INVALID_ENTITY_HANDLE if the entity is not alive.
+            */
+            [[nodiscard]] EntityHandle getEntityHandle(Entity entity) const;
+
+            /**
+            * @brief Checks whether a handle still refers to the entity it was created from.
+            *
+            * @param handle - The handle to validate.
+            * @return true if the entity is alive and has not been recycled since, false otherwise.
+            */
+            [[nodiscard]] bool isEntityValid(EntityHandle handle) const;
+
+            /**
+            * @brief Gets the command buffer of the calling thread.
+            *
+            * Systems, including jobs running on worker threads, record structural changes in it
+            * instead of applying them while iterating. The buffers are applied by flushCommandBuffers().
+            *
+            * @return EntityCommandBuffer& - The buffer owned by the calling thread.
+            */
+            EntityCommandBuffer &getCommandBuffer();
+
+            /**
+            * @brief Plays back the command buffers of every thread, in the order the threads first used them.
+            *
+            * Must be called at a sync point, while no system is running. The buffers are taken out of
+            * the coordinator before being played back, so commands recorded during the playback land in
+            * new buffers and are applied by the next flush.
+            */
+            void flushCommandBuffers();
+
             /**
             * @brief Registers a new component type within the ComponentManager.
             */
@@ -226,6 +277,54 @@ namespace parallax::ecs {
                 m_systemManager->entitySignatureChanged(entity, oldSignature, signature);
             }
 
+            /**
+            * @brief Creates a batch of entities sharing the same initial components.
+            *
+            * Each component array grows once and receives the batch as a contiguous block, then the
+            * block joins the qualifying groups and systems in a single pass instead of once per entity.
+            *
+            * @param count - The number of entities to create.
+            * @param components - The initial value of each component, copied to every entity.
+            * @return std::vector<Entity> - The IDs of the new entities.
+            */
+            template<typename... Components>
+            std::vector<Entity> createEntities(const size_t count, const Components&... components)
+            {
+                const Signature signature = batchSignature<Components...>();
+                std::vector<Entity> entities = m_entityManager->createEntities(count);
+
+                (m_componentManager->getComponentArray<Components>()->insertBatch(entities, components), ...);
+                commitBatch(entities, signature);
+                return entities;
+            }
+
+            /**
+            * @brief Creates a batch of entities with a distinct value per entity for each component.
+            *
+            * Works like createEntities(), the i-th entity receiving the i-th element of every span.
+            *
+            * @param components - One span per component type, all of the same size.
+            * @return std::vector<Entity> - The IDs of the new entities.
+            * @throws BatchSizeMismatch if the spans do not all have the same size.
+            */
+            template<typename... Components>
+            std::vector<Entity> spawnBatch(std::span<const Components>... components)
+            {
+                static_assert(sizeof...(Components) > 0, "spawnBatch needs at least one component type");
+                const size_t count = std::get<0>(std::forward_as_tuple(components...)).size();
+                for (const size_t size : {components.size()...}) {
+                    if (size != count)
+                        THROW_EXCEPTION(BatchSizeMismatch, count, size);
+                }
+
+                const Signature signature = batchSignature<Components...>();
+                std::vector<Entity> entities = m_entityManager->createEntities(count);
+
+                (m_componentManager->getComponentArray<Components>()->insertBatch(entities.begin(), entities.end(), components.begin()), ...);
+                commitBatch(entities, signature);
+                return entities;
+            }
+
             /**
              * @brief Adds a component to an entity, updates its signature, and notifies systems.
              *
@@ -328,13 +427,18 @@ namespace parallax::ecs {
             /**
             * @brief Retrieves a reference to a component of an entity.
             *
+            * The reference is mutable, so the component is conservatively marked as changed.
+            *
             * @param entity - The ID of the entity.
             * @return T& - Reference to the requested component.
             */
             template <typename T>
             T &getComponent(const Entity entity)
             {
-                return m_componentManager->getComponent<T>(entity);
+                const auto componentArray = m_componentManager->getComponentArray<T>();
+                T &component = componentArray->get(entity);
+                componentArray->markChanged(entity);
+                return component;
             }
 
             /**
@@ -359,12 +463,154 @@ namespace parallax::ecs {
             template<typename T>
             std::optional<std::reference_wrapper<T>> tryGetComponent(const Entity entity)
             {
-                return m_componentManager->tryGetComponent<T>(entity);
+                auto component = m_componentManager->tryGetComponent<T>(entity);
+                if (component)
+                    m_componentManager->getComponentArray<T>()->markChanged(entity);
+                return component;
             }
 
             void *tryGetComponentById(const ComponentType componentType, const Entity entity)const
             {
-                return m_componentManager->tryGetComponent(entity, componentType);
+                void *component = m_componentManager->tryGetComponent(entity, componentType);
+                if (component)
+                    m_componentManager->markChanged(entity, componentType);
+                return component;
+            }
+
+            /**
+             * @brief Stamps a component of an entity with the current tick.
+             *
+             * Use this after writing through a component array or span obtained elsewhere.
+             *
+             * @tparam T The component type.
+             * @param entity The entity whose component was written.
+             */
+            template<typename T>
+            void markComponentChanged(const Entity entity) const
+            {
+                m_componentManager->getComponentArray<T>()->markChanged(entity);
+            }
+
+            /**
+             * @brief Registers an observer called with the entities that received a component of type T.
+             *
+             * Delivery is batched: the callback runs from flushObservers(), once per flush.
+             *
+             * @param callback Receives the entities, sorted and without duplicates.
+             * @return ObserverId Identifier to pass to removeObserver().
+             */
+            template<typename T>
+            ObserverId onAdd(ComponentObserver callback) const
+            {
+                return m_componentManager->onAdd<T>(std::move(callback));
+            }
+
+            /**
+             * @brief Registers an observer called with the entities that lost their component of type T.
+             *
+             * @param callback Receives the entities, sorted and without duplicates.
+             * @return ObserverId Identifier to pass to removeObserver().
+             */
+            template<typename T>
+            ObserverId onRemove(ComponentObserver callback) const
+            {
+                return m_componentManager->onRemove<T>(std::move(callback));
+            }
+
+            /**
+             * @brief Registers an observer called with the entities whose component of type T was marked as changed.
+             *
+             * @param callback Receives the entities, sorted and without duplicates.
+             * @return ObserverId Identifier to pass to removeObserver().
+             */
+            template<typename T>
+            ObserverId onChange(ComponentObserver callback) const
+            {
+                return m_componentManager->onChange<T>(std::move(callback));
+            }
+
+            /**
+             * @brief Unregisters a component observer.
+             *
+             * @param id The identifier returned at registration.
+             */
+            void removeObserver(ObserverId id) const;
+
+            /**
+             * @brief Delivers the component events queued since the last call, one batch per type and event kind.
+             *
+             * Must be called at a sync point, while no system is running.
+             */
+            void flushObservers() const;
+
+            /**
+             * @brief Advances the change-detection tick.
+             *
+             * Components written afterwards compare as changed against every tick issued before.
+             *
+             * @return Tick The new current tick.
+             */
+            Tick advanceTick() const;
+
+            /**
+             * @brief Gets the current change-detection tick.
+             *
+             * @return Tick The tick stamped on components written right now.
+             */
+            [[nodiscard]] Tick getCurrentTick() const;
+
+            /**
+             * @brief Reports the memory held by every registered component array.
+             *
+             * @return Pairs of component type and dense / sparse / page overhead breakdown, ordered by component type.
+             */
+            [[nodiscard]] std::vector<std::pair<ComponentType, ComponentMemoryUsage>> getComponentMemoryUsage() const;
+
+            /**
+             * @brief Reports how many system and group signatures were tested by structural changes.
+             *
+             * @return SignatureEvaluationStats Counts accumulated since the last reset.
+             */
+            [[nodiscard]] SignatureEvaluationStats getSignatureEvaluationStats() const;
+
+            /**
+             * @brief Resets the signature evaluation counters, called once per frame by the application.
+             */
+            void resetSignatureEvaluationStats() const;
+
+            /**
+             * @brief Captures every entity, the hierarchy and every component array in a binary snapshot.
+             *
+             * Trivially copyable components are copied with one memcpy per array, other types need a
+             * serializer set with setComponentSerializer(). Singleton components are not included.
+             *
+             * @return WorldSnapshot The binary image of the world.
+             * @throws ComponentNotSerializable if a component type cannot be written.
+             */
+            [[nodiscard]] WorldSnapshot snapshot() const;
+
+            /**
+             * @brief Replaces the world with a snapshot.
+             *
+             * The snapshot must come from a coordinator with the same registered components and groups.
+             * Entity IDs and generations are restored exactly, so handles issued before the snapshot stay
+             * valid. Query systems and cached queries are refilled from the restored signatures.
+             *
+             * @param snapshot The snapshot to restore.
+             * @throws InvalidSnapshot if the snapshot does not match this world.
+             */
+            void restore(const WorldSnapshot &snapshot);
+
+            /**
+             * @brief Sets how a component type that is not trivially copyable is written to snapshots.
+             *
+             * @tparam T The component type.
+             * @param serializer Callbacks writing and reading one component.
+             */
+            template<typename T>
+            void setComponentSerializer(ComponentSerializer<T> serializer)
+            {
+                m_componentManager->getComponentArray<T>()->setSerializer(std::move(serializer));
             }
 
             const std::unordered_map<ComponentType, std::type_index>& getTypeIdToTypeIndex() const {
@@ -424,39 +670,36 @@ namespace parallax::ecs {
             /**
             * @brief Retrieves all entities that have the specified components.
             *
-            * @tparam Components The component types to filter by.
-            * @return std::set<Entity> A set of entities that contain all the specified components.
+            * The result comes from a cached EntityQuery keyed by the required and excluded components,
+            * created on first use and kept up to date on every signature change afterwards.
+            *
+            * @tparam Components The component types to filter by, wrapped in Exclude<> for the ones to reject.
+            * @return std::span<const Entity> The matching entities, invalidated by the next structural change.
+            */
+            template<typename... Components>
+            std::span<const Entity> getAllEntitiesWith() const
+            {
+                return registerQuery<Components...>()->entities();
+            }
+
+            /**
+            * @brief Creates or retrieves the cached query for the specified components.
+            *
+            * A new query is seeded by iterating the smallest array among its required components.
+            *
+            * @tparam Components The component types to filter by, wrapped in Exclude<> for the ones to reject.
+            * @return std::shared_ptr<EntityQuery> The cached query.
             */
             template<typename... Components>
-            std::vector<Entity> getAllEntitiesWith() const
+            std::shared_ptr<EntityQuery> registerQuery() const
             {
-                // Prepare signatures
+                static_assert((!is_exclude_v<Components> || ...), "A query needs at least one required component");
+
                 Signature requiredSignature;
                 Signature excludeSignature;
-
-                // Process each component type
                 (processComponentSignature<Components>(requiredSignature, excludeSignature), ...);
 
-                // Query entities
-                std::span<const Entity> livingEntities = m_entityManager->getLivingEntities();
-                std::vector<Entity> result;
-                result.reserve(livingEntities.size());
-
-                for (Entity entity : livingEntities)
-                {
-                    const Signature entitySignature = m_entityManager->getSignature(entity);
-
-                    // Entity must have all required components
-                    const bool hasAllRequired = (entitySignature & requiredSignature) == requiredSignature;
-
-                    // Entity must not have any excluded components
-                    const bool hasAnyExcluded = (entitySignature & excludeSignature).any();
-
-                    if (hasAllRequired && !hasAnyExcluded)
-                        result.push_back(entity);
-                }
-
-                return result;
+                return getOrRegisterQuery(requiredSignature, excludeSignature);
             }
 
             /**
@@ -491,14 +734,7 @@ namespace parallax::ecs {
             template <typename T, typename... Args>
             std::shared_ptr<T> registerQuerySystem(Args&&... args) {
                 auto newQuerySystem =  m_systemManager->registerQuerySystem<T>(std::forward<Args>(args)...);
-                std::span<const Entity> livingEntities = m_entityManager->getLivingEntities();
-                const Signature querySystemSignature = newQuerySystem->getSignature();
-                for (Entity entity : livingEntities) {
-                    const Signature entitySignature = m_entityManager->getSignature(entity);
-                    if ((entitySignature & querySystemSignature) == querySystemSignature) {
-                        newQuerySystem->entities.insert(entity);
-                    }
-                }
+                newQuerySystem->entities.insert(collectMatchingEntities(newQuerySystem->getSignature(), Signature{}));
                 return newQuerySystem;
             }
 
@@ -598,33 +834,73 @@ namespace parallax::ecs {
             /**
             * @brief Retrieves all entities that have all the specified components.
             *
-            * This method iterates over all entities and returns a list of those that possess
-            * each of the given component types. It uses the current signature of each entity
-            * to determine component ownership.
-            *
             * @tparam ComponentTypes - A variadic list of component types to filter by.
-            * @return std::vector<Entity> - A list of entities matching all specified component types.
+            * @return std::span<const Entity> - The matching entities, invalidated by the next structural change.
             */
             template<typename... ComponentTypes>
-            std::vector<Entity> getEntitiesWithComponents() const
+            std::span<const Entity> getEntitiesWithComponents() const
             {
-                std::vector<Entity> result;
-                std::span<const Entity> livingEntities = m_entityManager->getLivingEntities();
-                result.reserve(livingEntities.size());
-                for (Entity entity : livingEntities)
-                {
-                    const bool hasAll = (entityHasComponent<ComponentTypes>(entity) && ...);
-                    if (hasAll)
-                    {
-                        result.push_back(entity);
-                    }
-                }
-                return result;
+                return getAllEntitiesWith<ComponentTypes...>();
             }
 
         void updateSystemEntities() const;
 
+            /**
+            * @brief Moves an entity to a new signature as a single structural change.
+            *
+            * Components missing from newSignature are removed, then insertComponent(IComponentArray&, ComponentType)
+            * is called for every gained component type so the caller can construct it in its array. Groups
+            * and systems are updated once, going straight from the current signature to the new one.
+            *
+            * @param entity - The ID of the entity.
+            * @param newSignature - The signature of the entity once the change is applied.
+            * @param insertComponent - Callback inserting a gained component in its array.
+            */
+            template<typename InsertFunc>
+            void applyStructuralChange(const Entity entity, const Signature newSignature, InsertFunc &&insertComponent)
+            {
+                const Signature oldSignature = m_entityManager->getSignature(entity);
+                const Signature removed = oldSignature & ~newSignature;
+                const Signature added = newSignature & ~oldSignature;
+
+                m_componentManager->leaveGroups(entity, oldSignature, newSignature);
+                for (ComponentType type = 0; type < MAX_COMPONENT_TYPE; ++type) {
+                    if (removed.test(type))
+                        m_componentManager->getComponentArray(type)->remove(entity);
+                }
+                for (ComponentType type = 0; type < MAX_COMPONENT_TYPE; ++type) {
+                    if (added.test(type))
+                        insertComponent(*m_componentManager->getComponentArray(type), type);
+                }
+                m_componentManager->joinGroups(entity, oldSignature, newSignature);
+
+                m_entityManager->setSignature(entity, newSignature);
+                m_systemManager->entitySignatureChanged(entity, oldSignature, newSignature);
+            }
+
         private:
+            template<typename... Components>
+            Signature batchSignature() const
+            {
+                Signature signature;
+                (signature.set(m_componentManager->getComponentType<Components>(), true), ...);
+                return signature;
+            }
+
+            /**
+            * @brief Publishes the signature of freshly created entities to groups and systems, once for the whole batch.
+            */
+            void commitBatch(std::span<const Entity> entities, Signature signature) const;
+
+            /**
+            * @brief Lists the living entities matching a signature pair by iterating the smallest required component array.
+            *
+            * Falls back to the living entities when no component is required.
+            */
+            std::vector<Entity> collectMatchingEntities(Signature required, Signature excluded) const;
+
+            std::shared_ptr<EntityQuery> getOrRegisterQuery(Signature required, Signature excluded) const;
+
             template<typename Component>
             void processComponentSignature(Signature& required, Signature& excluded) const {
                 if constexpr (is_exclude_v<Component>) {
@@ -641,6 +917,7 @@ namespace parallax::ecs {
             std::shared_ptr<EntityManager> m_entityManager;
             std::shared_ptr<SystemManager> m_systemManager;
             std::shared_ptr<SingletonComponentManager> m_singletonComponentManager;
+            std::shared_ptr<Hierarchy> m_hierarchy;
 
             std::unordered_map<ComponentType, std::type_index> m_typeIDtoTypeIndex;
             std::unordered_map<std::type_index, bool> m_supportsMementoPattern;
@@ -651,5 +928,14 @@ namespace parallax::ecs {
             std::unordered_map<std::type_index, std::function<std::any(Entity)>> m_getComponentPointers;
 
             std::unordered_map<ComponentType, std::shared_ptr<ComponentDescription>> m_componentDescriptions;
+
+            // Identifies this coordinator in the per-thread command buffer cache, addresses can be reused
+            inline static std::atomic<std::uint64_t> s_nextCoordinatorId{1};
+            const std::uint64_t m_coordinatorId = s_nextCoordinatorId++;
+
+            // Bumped by flushCommandBuffers() so that threads stop using their cached buffer while it is played back
+            std::atomic<std::uint64_t> m_commandBuffersGeneration{0};
+            std::mutex m_commandBuffersMutex;
+            std::vector<std::pair<std::thread::id, std::unique_ptr<EntityCommandBuffer>>> m_commandBuffers;
     };
 }
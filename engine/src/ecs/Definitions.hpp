@@ -43,6 +43,32 @@ namespace parallax::ecs {
 	*/
 	constexpr Entity INVALID_ENTITY = std::numeric_limits<Entity>::max();
 
+	/**
+	* @brief Generation counter type for entity slots
+	*
+	* Incremented every time an entity ID is destroyed so that handles referring
+	* to a previous occupant of the same ID can be detected.
+	*/
+	using EntityGeneration = std::uint32_t;
+
+	/**
+	* @brief Generation-counted reference to an entity
+	*
+	* Pairs the entity index with the generation it had when the handle was issued.
+	* A handle stays valid only as long as the entity it was created from is alive.
+	*/
+	struct EntityHandle {
+		Entity index = INVALID_ENTITY;       ///< Index of the entity (the plain Entity ID)
+		EntityGeneration generation = 0;     ///< Generation of the entity slot when the handle was issued
+
+		bool operator==(const EntityHandle &other) const = default;
+	};
+
+	/**
+	* @brief Special value representing a handle that never refers to a living entity
+	*/
+	constexpr EntityHandle INVALID_ENTITY_HANDLE{};
+
 	// Component type definitions
 
 	/**
@@ -114,6 +140,34 @@ namespace parallax::ecs {
 	*/
 	constexpr GroupType MAX_GROUP_NUMBER = 32;
 
+	// Change detection definitions
+
+	/**
+	* @brief Monotonic counter used to timestamp component writes
+	*
+	* Every component slot remembers the tick of its last write. Tick 0 is never
+	* issued, so filtering with ChangedSince{0} matches every component.
+	*/
+	using Tick = std::uint32_t;
+
+	/**
+	* @brief First tick issued by the component manager
+	*/
+	constexpr Tick FIRST_TICK = 1;
+
+	/**
+	* @brief Iteration filter selecting entities whose components changed after a given tick
+	*
+	* When Watched is empty, the filter matches entities for which any of the iterated
+	* components changed. Otherwise only the listed component types are checked.
+	*
+	* @tparam Watched Component types to check for changes
+	*/
+	template<typename... Watched>
+	struct ChangedSince {
+		Tick tick = 0; ///< Components written strictly after this tick are considered changed
+	};
+
 	/**
 	* @brief Signature type for component composition
 	*
@@ -89,4 +89,45 @@ namespace parallax::ecs {
             explicit OutOfRange(size_t index, const std::source_location loc = std::source_location::current())
                 : Exception(std::format("Index {} is out of range", index), loc) {}
     };
+
+    class InvalidSystemDependency final : public Exception {
+        public:
+            explicit InvalidSystemDependency(const std::string& before, const std::string& after,
+                                             const std::source_location loc = std::source_location::current())
+                : Exception(std::format("System {} cannot run before {} since it is registered after it", before, after), loc) {}
+    };
+
+    class BatchSizeMismatch final : public Exception {
+        public:
+            explicit BatchSizeMismatch(size_t expected, size_t actual,
+                                       const std::source_location loc = std::source_location::current())
+                : Exception(std::format("Batch of {} entities received {} components", expected, actual), loc) {}
+    };
+
+    class InvalidSnapshot final : public Exception {
+        public:
+            explicit InvalidSnapshot(const std::string& reason,
+                                     const std::source_location loc = std::source_location::current())
+                : Exception(std::format("Invalid world snapshot: {}", reason), loc) {}
+    };
+
+    class ComponentNotSerializable final : public Exception {
+        public:
+            explicit ComponentNotSerializable(const std::string& typeName,
+                                              const std::source_location loc = std::source_location::current())
+                : Exception(std::format("Component {} is not trivially copyable and has no snapshot serializer", typeName), loc) {}
+    };
+
+    class InvalidQuerySignature final : public Exception {
+        public:
+            explicit InvalidQuerySignature(const std::source_location loc = std::source_location::current())
+                : Exception("Cached queries need at least one required component", loc) {}
+    };
+
+    class HierarchyCycle final : public Exception {
+        public:
+            explicit HierarchyCycle(const Entity entity, const Entity parent,
+                                    const std::source_location loc = std::source_location::current())
+                : Exception(std::format("Entity {} cannot be attached under {}, which is itself or one of its descendants", entity, parent), loc) {}
+    };
 }
@@ -18,45 +18,88 @@
 
 #include "Entity.hpp"
 #include "ECSExceptions.hpp"
+#include "Snapshot.hpp"
 
 #include <algorithm>
-#include <iostream>
-#include <ranges>
 
 namespace parallax::ecs {
 
-    EntityManager::EntityManager()
-    {
-        for (Entity entity = 0; entity < MAX_ENTITIES; ++entity)
-            m_availableEntities.push_back(entity);
-    }
-
     Entity EntityManager::createEntity()
     {
         if (m_livingEntities.size() >= MAX_ENTITIES)
             THROW_EXCEPTION(TooManyEntities);
 
-        const Entity id = m_availableEntities.front();
-        m_availableEntities.pop_front();
+        Entity id;
+        if (!m_freeEntities.empty()) {
+            id = m_freeEntities.back();
+            m_freeEntities.pop_back();
+        } else {
+            id = m_nextEntity++;
+            m_livingIndices.push_back(INVALID_ENTITY);
+            m_generations.push_back(0);
+            if (m_signatures.size() < m_nextEntity)
+                m_signatures.resize(m_nextEntity);
+        }
+
+        m_livingIndices[id] = static_cast<Entity>(m_livingEntities.size());
         m_livingEntities.push_back(id);
 
         return id;
     }
 
+    std::vector<Entity> EntityManager::createEntities(const size_t count)
+    {
+        if (m_livingEntities.size() + count > MAX_ENTITIES)
+            THROW_EXCEPTION(TooManyEntities);
+
+        std::vector<Entity> entities;
+        entities.reserve(count);
+
+        const size_t reused = std::min(count, m_freeEntities.size());
+        for (size_t i = 0; i < reused; ++i) {
+            entities.push_back(m_freeEntities.back());
+            m_freeEntities.pop_back();
+        }
+
+        if (const size_t fresh = count - reused; fresh > 0) {
+            const Entity first = m_nextEntity;
+            m_nextEntity += static_cast<Entity>(fresh);
+            m_livingIndices.resize(m_nextEntity, INVALID_ENTITY);
+            m_generations.resize(m_nextEntity, 0);
+            if (m_signatures.size() < m_nextEntity)
+                m_signatures.resize(m_nextEntity);
+            for (Entity id = first; id < m_nextEntity; ++id)
+                entities.push_back(id);
+        }
+
+        for (const Entity id : entities) {
+            m_livingIndices[id] = static_cast<Entity>(m_livingEntities.size());
+            m_livingEntities.push_back(id);
+        }
+
+        return entities;
+    }
+
     void EntityManager::destroyEntity(const Entity entity)
     {
         if (entity >= MAX_ENTITIES)
             THROW_EXCEPTION(OutOfRange, entity);
 
-        const auto it = std::ranges::find(m_livingEntities, entity);
-        if (it != m_livingEntities.end())
-            m_livingEntities.erase(it);
-        else
+        if (!isAlive(entity))
             return;
-        m_signatures[entity].reset();
 
-        m_availableEntities.push_front(entity);
+        // Swap-remove from the living list
+        const Entity index = m_livingIndices[entity];
+        const Entity lastEntity = m_livingEntities.back();
+        m_livingEntities[index] = lastEntity;
+        m_livingIndices[lastEntity] = index;
+        m_livingEntities.pop_back();
+        m_livingIndices[entity] = INVALID_ENTITY;
 
+        m_signatures[entity].reset();
+        ++m_generations[entity];
+
+        m_freeEntities.push_back(entity);
     }
 
     void EntityManager::setSignature(const Entity entity, const Signature signature)
@@ -64,6 +107,8 @@ namespace parallax::ecs {
         if (entity >= MAX_ENTITIES)
             THROW_EXCEPTION(OutOfRange, entity);
 
+        if (entity >= m_signatures.size())
+            m_signatures.resize(static_cast<size_t>(entity) + 1);
         m_signatures[entity] = signature;
     }
 
@@ -72,9 +117,38 @@ namespace parallax::ecs {
         if (entity >= MAX_ENTITIES)
             THROW_EXCEPTION(OutOfRange, entity);
 
+        if (entity >= m_signatures.size())
+            return {};
         return m_signatures[entity];
     }
 
+    bool EntityManager::isAlive(const Entity entity) const
+    {
+        return entity < m_livingIndices.size() && m_livingIndices[entity] != INVALID_ENTITY;
+    }
+
+    EntityGeneration EntityManager::getGeneration(const Entity entity) const
+    {
+        if (entity >= MAX_ENTITIES)
+            THROW_EXCEPTION(OutOfRange, entity);
+
+        if (entity >= m_generations.size())
+            return 0;
+        return m_generations[entity];
+    }
+
+    EntityHandle EntityManager::getHandle(const Entity entity) const
+    {
+        if (!isAlive(entity))
+            return INVALID_ENTITY_HANDLE;
+        return {entity, m_generations[entity]};
+    }
+
+    bool EntityManager::isValid(const EntityHandle handle) const
+    {
+        return isAlive(handle.index) && m_generations[handle.index] == handle.generation;
+    }
+
     size_t EntityManager::getLivingEntityCount() const
     {
         return m_livingEntities.size();
@@ -85,4 +159,60 @@ namespace parallax::ecs {
         return {m_livingEntities};
     }
 
+    size_t EntityManager::getAllocatedEntityCount() const
+    {
+        return m_nextEntity;
+    }
+
+    void EntityManager::snapshot(SnapshotWriter &writer) const
+    {
+        std::vector<std::uint64_t> signatures(m_nextEntity);
+        for (Entity entity = 0; entity < m_nextEntity && entity < m_signatures.size(); ++entity)
+            signatures[entity] = m_signatures[entity].to_ullong();
+
+        writer.write<Entity>(m_nextEntity);
+        writer.writeBlock(std::span<const Entity>(m_freeEntities));
+        writer.writeBlock(std::span<const Entity>(m_livingEntities));
+        writer.writeBlock(std::span<const EntityGeneration>(m_generations));
+        writer.writeBlock(std::span<const std::uint64_t>(signatures));
+    }
+
+    void EntityManager::restore(SnapshotReader &reader)
+    {
+        const auto nextEntity = reader.read<Entity>();
+        std::vector<Entity> freeEntities;
+        std::vector<Entity> livingEntities;
+        std::vector<EntityGeneration> generations;
+        std::vector<std::uint64_t> signatures;
+        reader.readBlock(freeEntities);
+        reader.readBlock(livingEntities);
+        reader.readBlock(generations);
+        reader.readBlock(signatures);
+
+        if (nextEntity > MAX_ENTITIES || generations.size() != nextEntity || signatures.size() != nextEntity
+            || freeEntities.size() + livingEntities.size() != nextEntity)
+            THROW_EXCEPTION(InvalidSnapshot, "entity manager sizes do not match");
+
+        std::vector<Entity> livingIndices(nextEntity, INVALID_ENTITY);
+        for (size_t i = 0; i < livingEntities.size(); ++i) {
+            const Entity entity = livingEntities[i];
+            if (entity >= nextEntity || livingIndices[entity] != INVALID_ENTITY)
+                THROW_EXCEPTION(InvalidSnapshot, std::format("living entity {} is invalid", entity));
+            livingIndices[entity] = static_cast<Entity>(i);
+        }
+        for (const Entity entity : freeEntities) {
+            if (entity >= nextEntity || livingIndices[entity] != INVALID_ENTITY)
+                THROW_EXCEPTION(InvalidSnapshot, std::format("free entity {} is invalid", entity));
+        }
+
+        m_nextEntity = nextEntity;
+        m_freeEntities = std::move(freeEntities);
+        m_livingEntities = std::move(livingEntities);
+        m_livingIndices = std::move(livingIndices);
+        m_generations = std::move(generations);
+        m_signatures.assign(nextEntity, Signature{});
+        for (Entity entity = 0; entity < nextEntity; ++entity)
+            m_signatures[entity] = Signature(signatures[entity]);
+    }
+
 }
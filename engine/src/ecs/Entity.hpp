@@ -19,8 +19,6 @@
 
 #pragma once
 
-#include <deque>
-#include <array>
 #include <vector>
 #include <span>
 
@@ -28,6 +26,9 @@
 
 namespace parallax::ecs {
 
+    class SnapshotWriter;
+    class SnapshotReader;
+
     /**
     * @class EntityManager
     *
@@ -35,28 +36,46 @@ namespace parallax::ecs {
     *
     * This class is responsible for creating, managing, and destroying entities. It maintains
     * a record of active entities and their signatures, which define the components associated with each entity.
+    *
+    * Entity IDs are handed out lazily: never-used IDs come from a monotonically increasing counter,
+    * and destroyed IDs are pushed on a free list and reused first (LIFO). Every ID slot carries a generation
+    * counter that is bumped on destruction, which lets EntityHandle detect references to destroyed entities.
+    * Living entities are kept in a dense array with a back-index so destruction is a O(1) swap-remove.
     */
     class EntityManager {
         public:
             /**
             * @brief Constructor for EntityManager.
             *
-            * Initializes the pool of available entities. Each entity is represented by a unique ID.
+            * No entity ID is allocated up front, per-entity storage grows as new IDs are handed out.
             */
-            EntityManager();
+            EntityManager() = default;
 
             /**
             * @brief Creates a new entity.
             *
-            * Assigns a unique ID to the new entity and tracks it as an active entity.
+            * Reuses the most recently destroyed ID if any, otherwise allocates the next never-used ID.
             * @return Entity - The ID of the newly created entity.
+            * @throws TooManyEntities if MAX_ENTITIES entities are already alive
             */
             Entity createEntity();
 
+            /**
+            * @brief Creates several entities at once.
+            *
+            * Free IDs are reused first, the remaining ones are allocated as a contiguous range
+            * and the per-entity storage is grown a single time.
+            * @param count - The number of entities to create.
+            * @return std::vector<Entity> - The IDs of the new entities.
+            * @throws TooManyEntities if the batch would exceed MAX_ENTITIES living entities
+            */
+            std::vector<Entity> createEntities(size_t count);
+
             /**
             * @brief Destroys an entity.
             *
-            * Marks the entity as inactive and returns its ID to the pool of available IDs.
+            * Removes the entity from the living list in O(1), bumps its generation
+            * and returns its ID to the free list. Destroying a dead entity is a no-op.
             * @param entity - The ID of the entity to be destroyed.
             */
             void destroyEntity(Entity entity);
@@ -78,6 +97,38 @@ namespace parallax::ecs {
             */
             [[nodiscard]] Signature getSignature(Entity entity) const;
 
+            /**
+             * @brief Checks whether an entity ID currently refers to a living entity
+             *
+             * @param entity The ID of the entity
+             * @return true if the entity is alive, false otherwise
+             */
+            [[nodiscard]] bool isAlive(Entity entity) const;
+
+            /**
+             * @brief Returns the current generation of an entity slot
+             *
+             * @param entity The ID of the entity
+             * @return EntityGeneration The number of times this ID has been destroyed
+             */
+            [[nodiscard]] EntityGeneration getGeneration(Entity entity) const;
+
+            /**
+             * @brief Builds a generation-counted handle for a living entity
+             *
+             * @param entity The ID of the entity
+             * @return EntityHandle The handle, or INVALID_ENTITY_HANDLE if the entity is not alive
+             */
+            [[nodiscard]] EntityHandle getHandle(Entity entity) const;
+
+            /**
+             * @brief Checks whether a handle still refers to the entity it was created from
+             *
+             * @param handle The handle to validate
+             * @return true if the entity is alive and its generation matches, false otherwise
+             */
+            [[nodiscard]] bool isValid(EntityHandle handle) const;
+
             /**
              * @brief Returns the number of currently active entities
              *
@@ -88,14 +139,49 @@ namespace parallax::ecs {
             /**
              * @brief Retrieves a view of all currently active entities
              *
+             * @note The order is not stable, destroying an entity moves the last living entity in its place.
+             *
              * @return std::span<const Entity> A span containing all living entity IDs
              */
             [[nodiscard]] std::span<const Entity> getLivingEntities() const;
 
+            /**
+             * @brief Returns the number of entity IDs handed out at least once
+             *
+             * @return size_t The size of the per-entity storage
+             */
+            [[nodiscard]] size_t getAllocatedEntityCount() const;
+
+            /**
+             * @brief Writes the ID allocator, generations and signatures to a snapshot
+             *
+             * @param writer Destination stream
+             */
+            void snapshot(SnapshotWriter &writer) const;
+
+            /**
+             * @brief Replaces the whole entity state with the one written by snapshot()
+             *
+             * IDs, generations and the order of the free list are restored exactly, so handles
+             * issued before the snapshot stay valid afterwards. The current state is left untouched
+             * if the data is rejected.
+             *
+             * @param reader Source stream
+             * @throws InvalidSnapshot if the data is inconsistent
+             */
+            void restore(SnapshotReader &reader);
+
         private:
-            std::deque<Entity> m_availableEntities{};
+            // Next never-used entity ID
+            Entity m_nextEntity = 0;
+            // Destroyed IDs waiting to be reused, most recently destroyed last
+            std::vector<Entity> m_freeEntities{};
+            // Dense array of living entities
             std::vector<Entity> m_livingEntities{};
 
-            std::array<Signature, MAX_ENTITIES> m_signatures{};
+            // Per-entity storage, indexed by entity ID and grown on demand
+            std::vector<Entity> m_livingIndices{};
+            std::vector<EntityGeneration> m_generations{};
+            std::vector<Signature> m_signatures{};
     };
 }
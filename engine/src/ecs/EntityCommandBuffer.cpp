@@ -0,0 +1,189 @@
+//// EntityCommandBuffer.cpp //////////////////////////////////////////////////
+//
+// ⢀⢀⢀⣤⣤⣤⡀⢀⢀⢀⢀⢀⢀⢠⣤⡄⢀⢀⢀⢀⣠⣤⣤⣤⣤⣤⣤⣤⣤⣤⡀⢀⢀⢀⢠⣤⣄⢀⢀⢀⢀⢀⢀⢀⣤⣤⢀⢀⢀⢀⢀⢀⢀⢀⣀⣄⢀⢀⢠⣄⣀⢀⢀⢀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⣿⣷⡀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡟⡛⡛⡛⡛⡛⡛⡛⢁⢀⢀⢀⢀⢻⣿⣦⢀⢀⢀⢀⢠⣾⡿⢃⢀⢀⢀⢀⢀⣠⣾⣿⢿⡟⢀⢀⡙⢿⢿⣿⣦⡀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⡛⣿⣷⡀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡙⣿⡷⢀⢀⣰⣿⡟⢁⢀⢀⢀⢀⢀⣾⣿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⣿⡆⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⡈⢿⣷⡄⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣇⣀⣀⣀⣀⣀⣀⣀⢀⢀⢀⢀⢀⢀⢀⡈⢀⢀⣼⣿⢏⢀⢀⢀⢀⢀⢀⣼⣿⡏⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡘⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⡈⢿⣿⡄⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣿⢿⢿⢿⢿⢿⢿⢿⢇⢀⢀⢀⢀⢀⢀⢀⢠⣾⣿⣧⡀⢀⢀⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⡈⢿⣿⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣰⣿⡟⡛⣿⣷⡄⢀⢀⢀⢀⢀⢿⣿⣇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⡈⢿⢀⢀⢸⣿⡇⢀⢀⢀⢀⡛⡟⢁⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⡟⢀⢀⡈⢿⣿⣄⢀⢀⢀⢀⡘⣿⣿⣄⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⢏⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⢀⣀⣀⣀⣀⣀⣀⣀⣀⣀⡀⢀⢀⢀⣠⣾⡿⢃⢀⢀⢀⢀⢀⢻⣿⣧⡀⢀⢀⢀⡈⢻⣿⣷⣦⣄⢀⢀⣠⣤⣶⣿⡿⢋⢀⢀⢀⢀
+// ⢀⢀⢀⢿⢿⢀⢀⢀⢀⢀⢀⢀⢀⢸⢿⢃⢀⢀⢀⢀⢻⢿⢿⢿⢿⢿⢿⢿⢿⢿⢃⢀⢀⢀⢿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⡗⢀⢀⢀⢀⢀⡈⡉⡛⡛⢀⢀⢹⡛⢋⢁⢀⢀⢀⢀⢀⢀
+//
+//  Author:      Parallax Engine Team
+//  Date:        16/10/2026
+//  Description: Source file for the deferred entity command buffer
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include "EntityCommandBuffer.hpp"
+#include "Coordinator.hpp"
+
+#include <array>
+#include <cstring>
+#include <unordered_map>
+
+namespace parallax::ecs {
+
+    const EntityCommandBuffer::PayloadOps EntityCommandBuffer::RAW_OPS{
+        [](IComponentArray &array, const Entity entity, void *payload) { array.insertRaw(entity, payload); },
+        [](void *destination, void *payload, const std::size_t size) { std::memcpy(destination, payload, size); },
+        nullptr
+    };
+
+    EntityCommandBuffer::~EntityCommandBuffer()
+    {
+        clear();
+    }
+
+    PendingEntity EntityCommandBuffer::createEntity()
+    {
+        const PendingEntity entity{m_createdCount++};
+        m_commands.push_back({CommandType::Create, 0, toTarget(entity)});
+        return entity;
+    }
+
+    void EntityCommandBuffer::destroyEntity(const Entity entity)
+    {
+        m_commands.push_back({CommandType::Destroy, 0, entity});
+    }
+
+    void EntityCommandBuffer::destroyEntity(const PendingEntity entity)
+    {
+        m_commands.push_back({CommandType::Destroy, 0, toTarget(entity)});
+    }
+
+    void EntityCommandBuffer::addComponent(const Entity entity, const ComponentType componentType,
+                                           const void *componentData, const std::size_t componentSize)
+    {
+        void *payload = allocate(componentSize, alignof(std::max_align_t));
+        std::memcpy(payload, componentData, componentSize);
+        m_commands.push_back({CommandType::Add, componentType, entity, payload, &RAW_OPS, componentSize});
+    }
+
+    void EntityCommandBuffer::removeComponent(const Entity entity, const ComponentType componentType)
+    {
+        m_commands.push_back({CommandType::Remove, componentType, entity});
+    }
+
+    std::vector<Entity> EntityCommandBuffer::playback(Coordinator &coordinator)
+    {
+        // Net effect of the buffer on one entity
+        struct EntityChanges {
+            Entity entity;
+            Signature added;
+            Signature removed;
+            bool destroyed = false;
+            std::array<const Command *, MAX_COMPONENT_TYPE> lastAdd{};
+        };
+
+        std::vector<Entity> created;
+        created.reserve(m_createdCount);
+        std::vector<EntityChanges> changes;
+        std::unordered_map<Entity, std::size_t> changesIndex;
+
+        for (const Command &command : m_commands) {
+            if (command.type == CommandType::Create) {
+                created.push_back(coordinator.createEntity());
+                continue;
+            }
+
+            const Entity entity = (command.entity & PENDING_ENTITY_BIT)
+                ? created[command.entity & ~PENDING_ENTITY_BIT]
+                : command.entity;
+            const auto [it, inserted] = changesIndex.try_emplace(entity, changes.size());
+            if (inserted)
+                changes.push_back({entity, {}, {}});
+
+            EntityChanges &entityChanges = changes[it->second];
+            if (entityChanges.destroyed)
+                continue;
+
+            switch (command.type) {
+                case CommandType::Destroy:
+                    entityChanges.destroyed = true;
+                    break;
+                case CommandType::Add:
+                    entityChanges.added.set(command.componentType);
+                    entityChanges.removed.reset(command.componentType);
+                    entityChanges.lastAdd[command.componentType] = &command;
+                    break;
+                case CommandType::Remove:
+                    entityChanges.removed.set(command.componentType);
+                    entityChanges.added.reset(command.componentType);
+                    entityChanges.lastAdd[command.componentType] = nullptr;
+                    break;
+                default:
+                    break;
+            }
+        }
+
+        for (const EntityChanges &entityChanges : changes) {
+            const Entity entity = entityChanges.entity;
+            if (entityChanges.destroyed) {
+                coordinator.destroyEntity(entity);
+                continue;
+            }
+
+            const Signature oldSignature = coordinator.getSignature(entity);
+            const Signature replaced = oldSignature & entityChanges.added;
+            const Signature newSignature = (oldSignature & ~entityChanges.removed) | entityChanges.added;
+
+            if (newSignature != oldSignature) {
+                coordinator.applyStructuralChange(entity, newSignature,
+                    [&](IComponentArray &array, const ComponentType type) {
+                        const Command *add = entityChanges.lastAdd[type];
+                        add->ops->insert(array, entity, add->payload);
+                    });
+            }
+
+            if (replaced.none())
+                continue;
+            for (ComponentType type = 0; type < MAX_COMPONENT_TYPE; ++type) {
+                if (!replaced.test(type))
+                    continue;
+                const Command *add = entityChanges.lastAdd[type];
+                add->ops->assign(coordinator.tryGetComponentById(type, entity), add->payload, add->payloadSize);
+            }
+        }
+
+        clear();
+        return created;
+    }
+
+    void EntityCommandBuffer::clear()
+    {
+        for (const Command &command : m_commands) {
+            if (command.type == CommandType::Add && command.ops->destroy)
+                command.ops->destroy(command.payload);
+        }
+        m_commands.clear();
+        m_createdCount = 0;
+
+        // Regular blocks are kept for the next frame, oversized ones are released
+        m_largeBlocks.clear();
+        m_currentBlock = 0;
+        m_blockOffset = 0;
+    }
+
+    void *EntityCommandBuffer::allocate(const std::size_t size, const std::size_t alignment)
+    {
+        if (size > COMMAND_BUFFER_BLOCK_SIZE) {
+            m_largeBlocks.push_back(std::make_unique_for_overwrite<std::byte[]>(size));
+            return m_largeBlocks.back().get();
+        }
+
+        std::size_t offset = (m_blockOffset + alignment - 1) & ~(alignment - 1);
+        if (m_blocks.empty() || offset + size > COMMAND_BUFFER_BLOCK_SIZE) {
+            if (!m_blocks.empty())
+                ++m_currentBlock;
+            if (m_currentBlock == m_blocks.size())
+                m_blocks.push_back(std::make_unique_for_overwrite<std::byte[]>(COMMAND_BUFFER_BLOCK_SIZE));
+            offset = 0;
+        }
+
+        m_blockOffset = offset + size;
+        return m_blocks[m_currentBlock].get() + offset;
+    }
+
+}
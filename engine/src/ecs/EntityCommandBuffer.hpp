@@ -0,0 +1,248 @@
+//// EntityCommandBuffer.hpp //////////////////////////////////////////////////
+//
+// ⢀⢀⢀⣤⣤⣤⡀⢀⢀⢀⢀⢀⢀⢠⣤⡄⢀⢀⢀⢀⣠⣤⣤⣤⣤⣤⣤⣤⣤⣤⡀⢀⢀⢀⢠⣤⣄⢀⢀⢀⢀⢀⢀⢀⣤⣤⢀⢀⢀⢀⢀⢀⢀⢀⣀⣄⢀⢀⢠⣄⣀⢀⢀⢀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⣿⣷⡀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡟⡛⡛⡛⡛⡛⡛⡛⢁⢀⢀⢀⢀⢻⣿⣦⢀⢀⢀⢀⢠⣾⡿⢃⢀⢀⢀⢀⢀⣠⣾⣿⢿⡟⢀⢀⡙⢿⢿⣿⣦⡀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⡛⣿⣷⡀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡙⣿⡷⢀⢀⣰⣿⡟⢁⢀⢀⢀⢀⢀⣾⣿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⣿⡆⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⡈⢿⣷⡄⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣇⣀⣀⣀⣀⣀⣀⣀⢀⢀⢀⢀⢀⢀⢀⡈⢀⢀⣼⣿⢏⢀⢀⢀⢀⢀⢀⣼⣿⡏⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡘⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⡈⢿⣿⡄⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣿⢿⢿⢿⢿⢿⢿⢿⢇⢀⢀⢀⢀⢀⢀⢀⢠⣾⣿⣧⡀⢀⢀⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⡈⢿⣿⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣰⣿⡟⡛⣿⣷⡄⢀⢀⢀⢀⢀⢿⣿⣇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⡈⢿⢀⢀⢸⣿⡇⢀⢀⢀⢀⡛⡟⢁⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⡟⢀⢀⡈⢿⣿⣄⢀⢀⢀⢀⡘⣿⣿⣄⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⢏⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⢀⣀⣀⣀⣀⣀⣀⣀⣀⣀⡀⢀⢀⢀⣠⣾⡿⢃⢀⢀⢀⢀⢀⢻⣿⣧⡀⢀⢀⢀⡈⢻⣿⣷⣦⣄⢀⢀⣠⣤⣶⣿⡿⢋⢀⢀⢀⢀
+// ⢀⢀⢀⢿⢿⢀⢀⢀⢀⢀⢀⢀⢀⢸⢿⢃⢀⢀⢀⢀⢻⢿⢿⢿⢿⢿⢿⢿⢿⢿⢃⢀⢀⢀⢿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⡗⢀⢀⢀⢀⢀⡈⡉⡛⡛⢀⢀⢹⡛⢋⢁⢀⢀⢀⢀⢀⢀
+//
+//  Author:      Parallax Engine Team
+//  Date:        16/10/2026
+//  Description: Header file for the deferred entity command buffer
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "ComponentArray.hpp"
+#include "Definitions.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace parallax::ecs {
+
+    class Coordinator;
+
+    /**
+     * @brief Placeholder for an entity whose creation has been recorded in an EntityCommandBuffer
+     *
+     * It can be used as the target of further commands recorded in the same buffer. The real
+     * entity is only known once the buffer has been played back.
+     */
+    struct PendingEntity {
+        std::uint32_t index = 0; ///< Position of the entity in the vector returned by EntityCommandBuffer::playback
+    };
+
+    /**
+     * @brief Default size of the blocks storing the components recorded in a command buffer
+     */
+    constexpr std::size_t COMMAND_BUFFER_BLOCK_SIZE = 16 * 1024;
+
+    /**
+     * @class EntityCommandBuffer
+     * @brief Records structural changes to apply later at a sync point
+     *
+     * Creating and destroying entities or adding and removing components moves data inside the
+     * component arrays and groups, which is unsafe while systems iterate over them. A command
+     * buffer only records these operations; playback() applies them once nothing is iterating.
+     *
+     * During playback the commands targeting the same entity are coalesced: the entity goes
+     * straight from its current signature to the final one, so gaining three components costs a
+     * single group migration and a single system notification instead of three.
+     *
+     * A buffer is not thread-safe. Each thread records into its own buffer, see
+     * Coordinator::getCommandBuffer().
+     */
+    class EntityCommandBuffer {
+        public:
+            EntityCommandBuffer() = default;
+            ~EntityCommandBuffer();
+
+            EntityCommandBuffer(const EntityCommandBuffer &) = delete;
+            EntityCommandBuffer &operator=(const EntityCommandBuffer &) = delete;
+
+            /**
+             * @brief Records the creation of an entity
+             *
+             * @return PendingEntity Placeholder usable by the following commands of this buffer
+             */
+            PendingEntity createEntity();
+
+            /**
+             * @brief Records the destruction of an entity
+             *
+             * Commands recorded afterwards for the same entity are ignored.
+             *
+             * @param entity The entity to destroy
+             */
+            void destroyEntity(Entity entity);
+            void destroyEntity(PendingEntity entity);
+
+            /**
+             * @brief Records the addition of a component
+             *
+             * If the entity already has the component when the buffer is played back,
+             * its value is replaced. The component type must already be registered.
+             *
+             * @tparam T The component type
+             * @param entity The entity receiving the component
+             * @param component The component value, moved into the buffer
+             */
+            template<typename T>
+            void addComponent(const Entity entity, T component)
+            {
+                recordAdd(entity, getComponentTypeID<T>(), std::move(component));
+            }
+
+            template<typename T>
+            void addComponent(const PendingEntity entity, T component)
+            {
+                recordAdd(toTarget(entity), getComponentTypeID<T>(), std::move(component));
+            }
+
+            /**
+             * @brief Records the addition of a component described by its type ID and raw data
+             *
+             * The data is copied into the buffer, so it must be trivially copyable.
+             *
+             * @param entity The entity receiving the component
+             * @param componentType The type ID of the component
+             * @param componentData Pointer to the component data
+             * @param componentSize Size of the component data in bytes
+             */
+            void addComponent(Entity entity, ComponentType componentType, const void *componentData, std::size_t componentSize);
+
+            /**
+             * @brief Records the removal of a component
+             *
+             * Removing a component the entity does not have at playback time does nothing.
+             *
+             * @tparam T The component type
+             * @param entity The entity losing the component
+             */
+            template<typename T>
+            void removeComponent(const Entity entity)
+            {
+                removeComponent(entity, getComponentTypeID<T>());
+            }
+
+            void removeComponent(Entity entity, ComponentType componentType);
+
+            /**
+             * @brief Applies every recorded command and empties the buffer
+             *
+             * Must be called while no system is iterating over the coordinator.
+             *
+             * @param coordinator The coordinator receiving the changes
+             * @return std::vector<Entity> The created entities, indexed by PendingEntity::index
+             */
+            std::vector<Entity> playback(Coordinator &coordinator);
+
+            /**
+             * @brief Drops every recorded command without applying it
+             */
+            void clear();
+
+            [[nodiscard]] bool empty() const { return m_commands.empty(); }
+            [[nodiscard]] std::size_t size() const { return m_commands.size(); }
+
+        private:
+            /**
+             * @brief Entity IDs with this bit set refer to entities created in this buffer
+             */
+            static constexpr Entity PENDING_ENTITY_BIT = Entity{1} << 31;
+            static_assert(MAX_ENTITIES < PENDING_ENTITY_BIT, "Entity IDs must leave room for the pending bit");
+
+            enum class CommandType : std::uint8_t {
+                Create,
+                Destroy,
+                Add,
+                Remove
+            };
+
+            /**
+             * @brief Type-erased operations on a recorded component value
+             */
+            struct PayloadOps {
+                void (*insert)(IComponentArray &array, Entity entity, void *payload);
+                void (*assign)(void *destination, void *payload, std::size_t size);
+                void (*destroy)(void *payload);
+            };
+
+            struct Command {
+                CommandType type;
+                ComponentType componentType = 0;
+                Entity entity = INVALID_ENTITY;
+                void *payload = nullptr;
+                const PayloadOps *ops = nullptr;
+                std::size_t payloadSize = 0;
+            };
+
+            template<typename T>
+            static void insertPayload(IComponentArray &array, const Entity entity, void *payload)
+            {
+                static_cast<ComponentArray<T> &>(array).insert(entity, std::move(*static_cast<T *>(payload)));
+            }
+
+            template<typename T>
+            static void assignPayload(void *destination, void *payload, std::size_t)
+            {
+                *static_cast<T *>(destination) = std::move(*static_cast<T *>(payload));
+            }
+
+            template<typename T>
+            static void destroyPayload(void *payload)
+            {
+                static_cast<T *>(payload)->~T();
+            }
+
+            template<typename T>
+            static constexpr PayloadOps TYPED_OPS{
+                &insertPayload<T>,
+                &assignPayload<T>,
+                std::is_trivially_destructible_v<T> ? nullptr : &destroyPayload<T>
+            };
+
+            static const PayloadOps RAW_OPS;
+
+            template<typename T>
+            void recordAdd(const Entity target, const ComponentType componentType, T &&component)
+            {
+                using Component = std::remove_cvref_t<T>;
+                static_assert(alignof(Component) <= __STDCPP_DEFAULT_NEW_ALIGNMENT__,
+                    "EntityCommandBuffer: over-aligned components are not supported");
+
+                void *payload = allocate(sizeof(Component), alignof(Component));
+                new (payload) Component(std::forward<T>(component));
+                m_commands.push_back({CommandType::Add, componentType, target, payload, &TYPED_OPS<Component>, sizeof(Component)});
+            }
+
+            static Entity toTarget(const PendingEntity entity) { return entity.index | PENDING_ENTITY_BIT; }
+
+            /**
+             * @brief Reserves storage for a recorded component
+             *
+             * Blocks are never reallocated, so the recorded values never move before playback.
+             */
+            void *allocate(std::size_t size, std::size_t alignment);
+
+            std::vector<Command> m_commands;
+            std::uint32_t m_createdCount = 0;
+
+            std::vector<std::unique_ptr<std::byte[]>> m_blocks;
+            std::vector<std::unique_ptr<std::byte[]>> m_largeBlocks;
+            std::size_t m_currentBlock = 0;
+            std::size_t m_blockOffset = 0;
+    };
+
+}
@@ -20,11 +20,16 @@
 #include "Definitions.hpp"
 #include "ComponentArray.hpp"
 #include "ECSExceptions.hpp"
+#include "JobSystem.hpp"
+#include "RadixSort.hpp"
 #include "Exception.hpp"
+#include "FrameArena.hpp"
 
 #include <functional>
+#include <limits>
 #include <span>
 #include <memory>
+#include <memory_resource>
 #include <unordered_map>
 #include <vector>
 #include <tuple>
@@ -56,12 +61,22 @@ namespace parallax::ecs {
 		     * @param e Entity to add.
 		     */
 		    virtual void addToGroup(Entity e) = 0;
+		    /**
+		     * @brief Adds several entities to the group at once.
+		     *
+		     * @param entities Entities to add.
+		     */
+		    virtual void addToGroup(std::span<const Entity> entities) = 0;
 		    /**
 		     * @brief Removes an entity from the group.
 		     *
 		     * @param e Entity to remove.
 		     */
 		    virtual void removeFromGroup(Entity e) = 0;
+		    /**
+		     * @brief Marks the sorting and partitions as stale after the owned arrays were replaced.
+		     */
+		    virtual void invalidateOrdering() = 0;
 	};
 
 	/**
@@ -117,6 +132,24 @@ namespace parallax::ecs {
 	    size_t count;      ///< The number of entities in the partition.
 	};
 
+	/**
+	 * @brief Typed reference to a partitioning registered on a group.
+	 *
+	 * Handles are acquired once through Group::getPartitionHandle and then passed to
+	 * Group::getPartitionView, which avoids building a string key and a key extractor
+	 * on every access. A handle is only meaningful for the group that issued it.
+	 *
+	 * @tparam KeyType The type of the key used for partitioning.
+	 */
+	template<typename KeyType>
+	struct PartitionHandle {
+		static constexpr size_t INVALID_INDEX = std::numeric_limits<size_t>::max();
+
+		size_t index = INVALID_INDEX; ///< Index of the partition storage inside its group.
+
+		[[nodiscard]] bool isValid() const { return index != INVALID_INDEX; }
+	};
+
 	/**
 	 * @brief Alias for a function that extracts a field from a component.
 	 *
@@ -373,6 +406,84 @@ namespace parallax::ecs {
 				}
 			}
 
+		    /**
+		     * @brief Iterates over each entity in the group, spreading the work across the job system.
+		     *
+		     * The dense group range is split into chunks of grainSize entities that run concurrently,
+		     * so func must only write to the components of the entity it receives.
+		     * Returns once every entity has been processed.
+		     *
+		     * @tparam Func Callable type.
+		     * @param func Function to call for each entity.
+		     * @param grainSize Number of entities processed by a single job.
+		     */
+		    template<typename Func>
+		    void eachParallel(Func func, const size_t grainSize = DEFAULT_GRAIN_SIZE) const
+		    {
+				auto firstArray = std::get<0>(m_ownedArrays);
+				if (!firstArray)
+					THROW_EXCEPTION(InternalError, "Component array is null");
+
+				JobSystem::getInstance().parallelFor(0, firstArray->groupSize(), grainSize,
+					[this, &func](const size_t start, const size_t end) {
+						eachInRange(start, end - start, func);
+					});
+		    }
+
+		    /**
+		     * @brief Iterates over the entities of the group whose components changed after a given tick.
+		     *
+		     * With an empty watch list, an entity is visited if any of its owned or non-owned
+		     * components changed. Owned change ticks are read by index, non-owned ones through
+		     * the sparse lookup.
+		     *
+		     * @tparam Watched Component types to check for changes.
+		     * @tparam Func Callable type.
+		     * @param filter Change filter holding the reference tick.
+		     * @param func Function to call for each changed entity.
+		     */
+		    template<typename... Watched, typename Func>
+		    void each(const ChangedSince<Watched...> filter, Func func) const
+		    {
+				auto firstArray = std::get<0>(m_ownedArrays);
+				if (!firstArray)
+					THROW_EXCEPTION(InternalError, "Component array is null");
+
+				eachInRange(0, firstArray->groupSize(), filter, func);
+		    }
+
+		    /**
+		     * @brief Iterates over the entities of a sub-range whose components changed after a given tick.
+		     *
+		     * @tparam Watched Component types to check for changes.
+		     * @tparam Func Callable type.
+		     * @param startIndex Starting index.
+		     * @param count Number of entities to consider.
+		     * @param filter Change filter holding the reference tick.
+		     * @param func Function to call for each changed entity in range.
+		     */
+		    template<typename... Watched, typename Func>
+			void eachInRange(size_t startIndex, const size_t count, const ChangedSince<Watched...> filter, Func func) const
+			{
+				auto firstArray = std::get<0>(m_ownedArrays);
+				if (!firstArray)
+					THROW_EXCEPTION(InternalError, "Component array is null");
+
+				if (startIndex >= firstArray->groupSize())
+					return; // Nothing to iterate
+
+				const size_t endIndex = std::min(startIndex + count, firstArray->groupSize());
+
+				for (size_t i = startIndex; i < endIndex; i++) {
+					Entity e = firstArray->getEntityAtIndex(i);
+					if (!isChangedSince<Watched...>(e, i, filter.tick))
+						continue;
+					callFunc(func, e,
+						std::make_index_sequence<std::tuple_size_v<OwnedTuple>>{},
+						std::make_index_sequence<std::tuple_size_v<NonOwnedTuple>>{});
+				}
+			}
+
 		    /**
 		     * @brief Adds an entity to the group.
 		     *
@@ -382,12 +493,35 @@ namespace parallax::ecs {
 		     */
 		    void addToGroup(Entity e) override
 		    {
+				const size_t previousSize = size();
 				std::apply([e](auto&&... arrays) {
 					((arrays->addToGroup(e)), ...);
 				}, m_ownedArrays);
 
 				m_sortingInvalidated = true;
-				invalidatePartitions();
+				partitionEntitiesAdded(previousSize);
+		    }
+
+		    /**
+		     * @brief Adds several entities to the group at once.
+		     *
+		     * Every owned array moves the whole batch into its group region, then sorting is
+		     * invalidated a single time and the new entities are slotted into their partitions.
+		     *
+		     * @param entities Entities to add.
+		     */
+		    void addToGroup(const std::span<const Entity> entities) override
+		    {
+				if (entities.empty())
+					return;
+
+				const size_t previousSize = size();
+				std::apply([entities](auto&&... arrays) {
+					((arrays->addToGroup(entities)), ...);
+				}, m_ownedArrays);
+
+				m_sortingInvalidated = true;
+				partitionEntitiesAdded(previousSize);
 		    }
 
 		    /**
@@ -399,11 +533,22 @@ namespace parallax::ecs {
 		     */
 		    void removeFromGroup(Entity e) override
 		    {
+				partitionEntityRemoved(e);
 				std::apply([e](auto&&... arrays) {
 					((arrays->removeFromGroup(e)), ...);
 				}, m_ownedArrays);
 
 				m_sortingInvalidated = true;
+		    }
+
+		    /**
+		     * @brief Marks the sorting and partitions as stale after the owned arrays were replaced.
+		     *
+		     * The group region itself is kept, the next sortBy or getPartitionView call rebuilds its order.
+		     */
+		    void invalidateOrdering() override
+		    {
+				m_sortingInvalidated = true;
 				invalidatePartitions();
 		    }
 
@@ -485,7 +630,14 @@ namespace parallax::ecs {
 			/**
 			 * @brief Sorts the group by a specified component field.
 			 *
-			 * The sorting is only performed if the sorting is invalidated.
+			 * The sorting is only performed if the sorting is invalidated. Keys are extracted
+			 * once per entity, then:
+			 *   - if the group is already nearly in order (e.g. depth keys that barely moved since
+			 *     last frame), a bounded insertion sort finishes the job in linear time;
+			 *   - otherwise arithmetic and enum keys go through an LSD radix sort and any other
+			 *     key type through a stable comparison sort.
+			 * The resulting permutation is applied in place to every owned array by following
+			 * its cycles. Entities with equal keys keep their relative order.
 			 *
 			 * @tparam CompType Component type to sort by.
 			 * @tparam FieldType Field type to compare.
@@ -521,25 +673,50 @@ namespace parallax::ecs {
 			    auto drivingArray = std::get<0>(m_ownedArrays);
 			    const size_t groupSize = drivingArray->groupSize();
 
-			    std::vector<Entity> entities;
-			    entities.reserve(groupSize);
-
-			    // Add all entities currently in the group
-			    for (size_t i = 0; i < groupSize; i++)
-			        entities.push_back(drivingArray->getEntityAtIndex(i));
+				// Owned components are aligned with the group slots, non-owned ones need a lookup
+				auto componentAt = [&](const size_t index) -> const CompType& {
+					if constexpr (tuple_contains_component_v<CompType, OwnedTuple>)
+						return compArray->getAt(index);
+					else
+						return compArray->get(drivingArray->getEntityAtIndex(index));
+				};
 
-			    // Sort entities based on the extracted field from the component
-				std::ranges::sort(entities,
-                    [&](Entity a, Entity b) {
-                        const auto& compA = compArray->get(a);
-                        const auto& compB = compArray->get(b);
-                        if (ascending)
-                            return extractor(compA) < extractor(compB);
-                        return extractor(compA) > extractor(compB);
-                });
+				std::vector<size_t> order;
+				if constexpr (RadixSortable<FieldType>) {
+					// Descending order is an ascending sort on the complemented keys
+					using Key = RadixKey<FieldType>;
+					const Key flip = ascending ? Key{0} : ~Key{0};
+					std::vector<std::pair<Key, std::uint32_t>> items;
+					items.reserve(groupSize);
+					for (size_t i = 0; i < groupSize; i++)
+						items.emplace_back(toRadixKey(extractor(componentAt(i))) ^ flip, static_cast<std::uint32_t>(i));
+
+					auto less = [](const auto& a, const auto& b) { return a.first < b.first; };
+					if (!boundedInsertionSort(items, groupSize, less))
+						radixSort(items);
+					order = toOrder(items);
+				} else {
+					std::vector<std::pair<FieldType, std::uint32_t>> items;
+					items.reserve(groupSize);
+					for (size_t i = 0; i < groupSize; i++)
+						items.emplace_back(extractor(componentAt(i)), static_cast<std::uint32_t>(i));
+
+					auto less = [ascending](const auto& a, const auto& b) {
+						return ascending ? a.first < b.first : b.first < a.first;
+					};
+					if (!boundedInsertionSort(items, groupSize, less))
+						std::ranges::stable_sort(items, less);
+					order = toOrder(items);
+				}
 
-			    reorderGroup(entities);
 				m_sortingInvalidated = false;
+				if (order.empty())
+					return;
+
+				std::apply([&order](auto&&... arrays) {
+					((arrays->applyPermutation(order)), ...);
+				}, m_ownedArrays);
+				invalidatePartitions();
 			}
 
 			// =======================================
@@ -595,6 +772,25 @@ namespace parallax::ecs {
 						m_group->eachInRange(partition->startIndex, partition->count, func);
 					}
 
+					/**
+					* @brief Iterates over the entities of a partition whose components changed after a given tick.
+					*
+					* @tparam Watched Component types to check for changes.
+					* @tparam Func Callable type.
+					* @param key Key of the partition.
+					* @param filter Change filter holding the reference tick.
+					* @param func Function to apply to each changed entity.
+					*/
+					template<typename... Watched, typename Func>
+					void each(const KeyType& key, const ChangedSince<Watched...> filter, Func func) const
+					{
+						const auto* partition = getPartition(key);
+						if (!partition)
+							return;
+
+						m_group->eachInRange(partition->startIndex, partition->count, filter, func);
+					}
+
 					/**
 					* @brief Gets all partition keys.
 					*
@@ -625,19 +821,26 @@ namespace parallax::ecs {
 			};
 
 			/**
-			 * @brief Returns a partition view based on a component field.
+			 * @brief Returns a handle to the partitioning of the group by a component field.
+			 *
+			 * The partitioning is registered on the first call; later calls with the same
+			 * component and key types return the same handle. Store the handle and pass it to
+			 * getPartitionView(PartitionHandle) on every frame.
 			 *
 			 * @tparam CompType Component type used to partition.
 			 * @tparam KeyType Key type extracted from the component.
 			 * @param keyExtractor Function to extract the key from the component.
-			 * @return PartitionView<KeyType> View over the partitioned entities.
+			 * @return PartitionHandle<KeyType> Handle to the partitioning.
 			 */
 			template<typename CompType, typename KeyType>
-			PartitionView<KeyType> getPartitionView(FieldExtractor<CompType, KeyType> keyExtractor)
+			PartitionHandle<KeyType> getPartitionHandle(FieldExtractor<CompType, KeyType> keyExtractor)
 			{
 				std::string typeId = typeid(KeyType).name();
 				typeId += "_" + std::string(typeid(CompType).name());
 
+				if (const auto it = m_partitionIds.find(typeId); it != m_partitionIds.end())
+					return PartitionHandle<KeyType>{it->second};
+
 				EntityKeyExtractor<KeyType> entityKeyExtractor = [this, keyExtractor](Entity e) {
 				if constexpr (tuple_contains_component_v<CompType, OwnedTuple>) {
 					auto compArray = getOwnedImpl<CompType>();
@@ -655,7 +858,70 @@ namespace parallax::ecs {
 					static_assert(dependent_false<CompType>::value, "Component type not found in group");
 				};
 
-				return getEntityPartitionView<KeyType>(typeId, entityKeyExtractor);
+				return registerPartition<KeyType>(typeId, std::move(entityKeyExtractor));
+			}
+
+			/**
+			* @brief Returns a handle to a partitioning of the group based directly on entity IDs.
+			*
+			* @tparam KeyType Key type.
+			* @param partitionId Identifier for the partitioning.
+			* @param keyExtractor Function to extract the key from an entity, only used on the first call.
+			* @return PartitionHandle<KeyType> Handle to the partitioning.
+			*/
+			template<typename KeyType>
+			PartitionHandle<KeyType> getEntityPartitionHandle(const std::string& partitionId,
+																EntityKeyExtractor<KeyType> keyExtractor)
+			{
+				if (const auto it = m_partitionIds.find(partitionId); it != m_partitionIds.end())
+					return PartitionHandle<KeyType>{it->second};
+
+				return registerPartition<KeyType>(partitionId, std::move(keyExtractor));
+			}
+
+			/**
+			* @brief Returns the partition view of a registered partitioning.
+			*
+			* The group region is kept ordered for one partitioning at a time. Entities joining or
+			* leaving the group are slotted into that partitioning incrementally; requesting a
+			* different partitioning, or one invalidated by invalidatePartitions(), reorders the
+			* whole group once.
+			*
+			* @tparam KeyType Key type.
+			* @param handle Handle returned by getPartitionHandle or getEntityPartitionHandle.
+			* @return PartitionView<KeyType> View over the partitioned entities.
+			* @throws InternalError if the handle doesn't belong to this group.
+			*/
+			template<typename KeyType>
+			PartitionView<KeyType> getPartitionView(const PartitionHandle<KeyType> handle)
+			{
+				if (handle.index >= m_partitionStorages.size())
+					THROW_EXCEPTION(InternalError, "Invalid partition handle");
+
+				auto* storage = static_cast<PartitionStorage<KeyType>*>(m_partitionStorages[handle.index].get());
+				if (m_orderedPartition != handle.index) {
+					storage->rebuild();
+					m_orderedPartition = handle.index;
+				}
+
+				return PartitionView<KeyType>(this, storage->getPartitions());
+			}
+
+			/**
+			 * @brief Returns a partition view based on a component field.
+			 *
+			 * Convenience overload that looks the partitioning up by type on every call,
+			 * prefer acquiring a PartitionHandle once in hot paths.
+			 *
+			 * @tparam CompType Component type used to partition.
+			 * @tparam KeyType Key type extracted from the component.
+			 * @param keyExtractor Function to extract the key from the component.
+			 * @return PartitionView<KeyType> View over the partitioned entities.
+			 */
+			template<typename CompType, typename KeyType>
+			PartitionView<KeyType> getPartitionView(FieldExtractor<CompType, KeyType> keyExtractor)
+			{
+				return getPartitionView(getPartitionHandle<CompType, KeyType>(std::move(keyExtractor)));
 			}
 
 			/**
@@ -670,33 +936,18 @@ namespace parallax::ecs {
 			PartitionView<KeyType> getEntityPartitionView(const std::string& partitionId,
 															EntityKeyExtractor<KeyType> keyExtractor)
 			{
-				// Check if we already have this partition view
-				auto it = m_partitionStorageMap.find(partitionId);
-				if (it == m_partitionStorageMap.end()) {
-					auto storage = std::make_unique<PartitionStorage<KeyType>>(this, keyExtractor);
-					auto* storagePtr = storage.get();
-					m_partitionStorageMap[partitionId] = std::move(storage);
-					storagePtr->rebuild();
-
-					return PartitionView<KeyType>(this, storagePtr->getPartitions());
-				}
-
-				// Get the existing storage and cast to the right type
-				auto* storage = static_cast<PartitionStorage<KeyType>*>(it->second.get());
-
-				if (storage->isDirty())
-					storage->rebuild();
-
-				return PartitionView<KeyType>(this, storage->getPartitions());
+				return getPartitionView(getEntityPartitionHandle<KeyType>(partitionId, std::move(keyExtractor)));
 			}
 
 			/**
 			* @brief Invalidates all partition caches.
+			*
+			* Must be called when the key of an entity changes, the next getPartitionView
+			* call then rebuilds the requested partitioning.
 			*/
 			void invalidatePartitions()
 			{
-				for (auto& [_, storage] : m_partitionStorageMap)
-					storage->markDirty();
+				m_orderedPartition = NO_ORDERED_PARTITION;
 			}
 
 		private:
@@ -713,25 +964,31 @@ namespace parallax::ecs {
 			struct IPartitionStorage {
 				virtual ~IPartitionStorage() = default;
 				/**
-				* @brief Checks if the partition storage is dirty (needs rebuilding).
-				*
-				* @return true If dirty.
-				* @return false Otherwise.
+				* @brief Recomputes the partitions and reorders the whole group region accordingly.
 				*/
-				[[nodiscard]] virtual bool isDirty() const = 0;
+				virtual void rebuild() = 0;
 				/**
-				* @brief Marks the partition storage as dirty.
+				* @brief Slots an entity that just joined the group into its partition.
+				*
+				* @param e Entity that was added.
+				* @param index Current index of the entity, right after the partitioned region.
 				*/
-				virtual void markDirty() = 0;
+				virtual void entityAdded(Entity e, size_t index) = 0;
 				/**
-				* @brief Rebuilds the partition storage.
+				* @brief Moves an entity about to leave the group to the end of the group region.
+				*
+				* @param index Current index of the entity in the group.
 				*/
-				virtual void rebuild() = 0;
+				virtual void entityRemoved(size_t index) = 0;
 			};
 
 			/**
 			 * @brief Concrete partition storage for a specific key type.
 			 *
+			 * Partitions are contiguous ranges of the group region, stored in index order.
+			 * Inserting or removing an entity shifts every following partition by one slot,
+			 * which only swaps the element at each partition boundary.
+			 *
 			 * @tparam KeyType Type of the partition key.
 			 */
 			template<typename KeyType>
@@ -746,59 +1003,99 @@ namespace parallax::ecs {
 					PartitionStorage(Group* group, EntityKeyExtractor<KeyType> keyExtractor)
 						: m_group(group), m_keyExtractor(std::move(keyExtractor)) {}
 
-					[[nodiscard]] bool isDirty() const override { return m_isDirty; }
-					void markDirty() override { m_isDirty = true; }
-
 					/**
 					* @brief Rebuilds the partitions.
 					*
-					* This collects all entity keys and creates partitions. It then reorders
-					* the group entities according to the new partition order.
+					* Entities are bucketed by key, keeping the keys in order of first appearance,
+					* then swapped into place directly inside the owned arrays. The buckets are
+					* temporaries, allocated from the frame arena.
 					*/
 					void rebuild() override
 					{
-						if (!m_isDirty)
-							return;
 						auto drivingArray = std::get<0>(m_group->m_ownedArrays);
 						const size_t groupSize = drivingArray->groupSize();
 
-						// Skip if no entities
-						if (groupSize == 0) {
-							m_partitions.clear();
-							m_isDirty = false;
+						m_partitions.clear();
+						if (groupSize == 0)
 							return;
-						}
 
-						std::unordered_map<KeyType, std::vector<Entity>> keyToEntities;
+						std::pmr::memory_resource *arena = &FrameArena::getInstance();
+						std::pmr::unordered_map<KeyType, size_t> bucketOf(arena);
+						std::pmr::vector<std::pmr::vector<Entity>> buckets(arena);
 
 						for (size_t i = 0; i < groupSize; i++) {
-							Entity e = drivingArray->getEntityAtIndex(i);
-							KeyType key = m_keyExtractor(e);
-							keyToEntities[key].push_back(e);
+							const Entity e = drivingArray->getEntityAtIndex(i);
+							const KeyType key = m_keyExtractor(e);
+							const auto [it, inserted] = bucketOf.try_emplace(key, buckets.size());
+							if (inserted) {
+								buckets.emplace_back();
+								m_partitions.push_back(Partition<KeyType>{key, 0, 0});
+							}
+							buckets[it->second].push_back(e);
 						}
 
-						m_partitions.clear();
-						m_partitions.reserve(keyToEntities.size());
-
-						std::vector<Entity> newOrder;
-						newOrder.reserve(groupSize);
-
 						size_t currentIndex = 0;
-						for (auto& [key, entities] : keyToEntities) {
-							Partition<KeyType> partition;
-							partition.key = key;
-							partition.startIndex = currentIndex;
-							partition.count = entities.size();
-							m_partitions.push_back(partition);
+						for (size_t bucket = 0; bucket < buckets.size(); ++bucket) {
+							m_partitions[bucket].startIndex = currentIndex;
+							m_partitions[bucket].count = buckets[bucket].size();
+							for (const Entity e : buckets[bucket]) {
+								const size_t index = drivingArray->getDenseIndex(e);
+								if (index != currentIndex)
+									m_group->swapGroupSlots(index, currentIndex);
+								++currentIndex;
+							}
+						}
+					}
+
+					void entityAdded(const Entity e, const size_t index) override
+					{
+						const size_t end = m_partitions.empty() ? 0 : m_partitions.back().startIndex + m_partitions.back().count;
+						if (index != end)
+							m_group->swapGroupSlots(index, end);
+
+						const KeyType key = m_keyExtractor(e);
+						const auto it = std::ranges::find(m_partitions, key, &Partition<KeyType>::key);
+						if (it == m_partitions.end()) {
+							m_partitions.push_back(Partition<KeyType>{key, end, 1});
+							return;
+						}
 
-							// Add these entities to the new order
-							newOrder.insert(newOrder.end(), entities.begin(), entities.end());
+						// Rotate the entity down: each following partition gives its first slot
+						// to the entity and moves that element to its own end
+						const auto target = static_cast<size_t>(std::distance(m_partitions.begin(), it));
+						size_t hole = end;
+						for (size_t i = m_partitions.size() - 1; i > target; --i) {
+							Partition<KeyType>& partition = m_partitions[i];
+							m_group->swapGroupSlots(partition.startIndex, hole);
+							hole = partition.startIndex;
+							++partition.startIndex;
+						}
+						++it->count;
+					}
 
-							currentIndex += entities.size();
+					void entityRemoved(const size_t index) override
+					{
+						auto it = std::ranges::upper_bound(m_partitions, index, {}, &Partition<KeyType>::startIndex);
+						if (it == m_partitions.begin())
+							return;
+						--it;
+
+						size_t hole = it->startIndex + it->count - 1;
+						if (index != hole)
+							m_group->swapGroupSlots(index, hole);
+						--it->count;
+
+						// Bubble the entity up: each following partition moves its last element
+						// into the slot freed in front of it
+						for (auto partition = std::next(it); partition != m_partitions.end(); ++partition) {
+							const size_t last = partition->startIndex + partition->count - 1;
+							m_group->swapGroupSlots(hole, last);
+							hole = last;
+							--partition->startIndex;
 						}
 
-						m_group->reorderGroup(newOrder);
-						m_isDirty = false;
+						if (it->count == 0)
+							m_partitions.erase(it);
 					}
 
 					/**
@@ -814,52 +1111,94 @@ namespace parallax::ecs {
 				private:
 					Group* m_group; ///< Pointer to the group.
 					EntityKeyExtractor<KeyType> m_keyExtractor; ///< Function to extract a key from an entity.
-					std::vector<Partition<KeyType>> m_partitions; ///< Vector of partitions.
-					bool m_isDirty = true; ///< Flag indicating if partitions need rebuilding.
+					std::vector<Partition<KeyType>> m_partitions; ///< Partitions, ordered by start index.
 			};
 
 			/**
-			* @brief Reorders the group entities based on a new order.
+			* @brief Registers a new partition storage.
 			*
-			* @param newOrder New order of entities.
+			* @tparam KeyType Key type.
+			* @param partitionId Identifier of the partitioning.
+			* @param keyExtractor Function to extract the key from an entity.
+			* @return PartitionHandle<KeyType> Handle to the new partitioning.
 			*/
-			void reorderGroup(const std::vector<Entity>& newOrder)
+			template<typename KeyType>
+			PartitionHandle<KeyType> registerPartition(const std::string& partitionId, EntityKeyExtractor<KeyType> keyExtractor)
 			{
-				std::apply([&](auto&&... arrays) {
-					((reorderArray(arrays, newOrder)), ...);
-				}, m_ownedArrays);
+				const size_t index = m_partitionStorages.size();
+				m_partitionStorages.push_back(std::make_unique<PartitionStorage<KeyType>>(this, std::move(keyExtractor)));
+				m_partitionIds.emplace(partitionId, index);
+				return PartitionHandle<KeyType>{index};
 			}
 
 			/**
-			* @brief Reorders a single component array based on the new entity order.
+			* @brief Slots the entities appended to the group region into the ordered partitioning.
 			*
-			* @tparam ArrayPtr Type of the component array pointer.
-			* @param array Component array pointer.
-			* @param newOrder New order of entities.
+			* @param previousSize Size of the group before the insertion.
 			*/
-			template<typename ArrayPtr>
-			void reorderArray(ArrayPtr array, const std::vector<Entity>& newOrder) const
+			void partitionEntitiesAdded(const size_t previousSize)
 			{
-				size_t groupSize = array->groupSize();
-				if (newOrder.size() != groupSize)
-					THROW_EXCEPTION(InternalError, "New order size doesn't match group size");
+				if (m_orderedPartition == NO_ORDERED_PARTITION)
+					return;
+
+				IPartitionStorage* storage = m_partitionStorages[m_orderedPartition].get();
+				auto drivingArray = std::get<0>(m_ownedArrays);
+				for (size_t i = previousSize; i < drivingArray->groupSize(); ++i)
+					storage->entityAdded(drivingArray->getEntityAtIndex(i), i);
+			}
 
-				if (groupSize == 0)
+			/**
+			* @brief Moves an entity about to leave the group out of the ordered partitioning.
+			*
+			* @param e Entity being removed.
+			*/
+			void partitionEntityRemoved(const Entity e)
+			{
+				if (m_orderedPartition == NO_ORDERED_PARTITION)
 					return;
 
-				// Create a temporary storage for components
-				using CompType = typename std::decay_t<decltype(*array)>::component_type;
-				std::vector<CompType> tempComponents;
-				tempComponents.reserve(groupSize);
+				auto drivingArray = std::get<0>(m_ownedArrays);
+				const size_t index = drivingArray->getDenseIndex(e);
+				if (index >= drivingArray->groupSize())
+					return;
+				m_partitionStorages[m_orderedPartition]->entityRemoved(index);
+			}
 
-				for (Entity e : newOrder)
-					tempComponents.push_back(array->get(e)); //Maybe we should not push back, does it make a copy ?
+			/**
+			* @brief Swaps two slots of the group region in every owned array.
+			*
+			* @param index1 First index in the group.
+			* @param index2 Second index in the group.
+			*/
+			void swapGroupSlots(const size_t index1, const size_t index2)
+			{
+				std::apply([index1, index2](auto&&... arrays) {
+					((arrays->swapComponents(index1, index2)), ...);
+				}, m_ownedArrays);
+			}
 
-				for (size_t i = 0; i < groupSize; i++) {
-					Entity e = newOrder[i];
-					array->forceSetComponentAt(i, e, std::move(tempComponents[i]));
-				}
-		}
+			/**
+			* @brief Turns sorted (key, source index) pairs into a permutation of the group slots.
+			*
+			* @param items Sorted pairs, the second member being the slot each item came from.
+			* @return std::vector<size_t> Source slot of each destination slot, or an empty vector
+			* if the group is already in order.
+			*/
+			template<typename Key>
+			static std::vector<size_t> toOrder(const std::vector<std::pair<Key, std::uint32_t>>& items)
+			{
+				bool identity = true;
+				for (size_t i = 0; i < items.size() && identity; i++)
+					identity = items[i].second == i;
+				if (identity)
+					return {};
+
+				std::vector<size_t> order;
+				order.reserve(items.size());
+				for (const auto& item : items)
+					order.push_back(item.second);
+				return order;
+			}
 
 			/**
 			 * @brief Helper to dereference an entity and its components by index.
@@ -936,6 +1275,51 @@ namespace parallax::ecs {
 				func(e, (std::get<I>(m_ownedArrays)->get(e))..., (std::get<J>(m_nonOwnedArrays)->get(e))...);
 			}
 
+			/**
+			 * @brief Returns the change tick of a component of an entity in the group.
+			 *
+			 * @tparam T Component type.
+			 * @param e Entity.
+			 * @param index Index of the entity in the group.
+			 * @return Tick Last change tick of the component.
+			 */
+			template<typename T>
+			Tick getChangeTickOf(Entity e, size_t index) const
+			{
+				if constexpr (tuple_contains_component_v<T, OwnedTuple>)
+					return getOwnedImpl<T>()->getChangeTickAt(index);
+				else if constexpr (tuple_contains_component_v<T, NonOwnedTuple>)
+					return getNonOwnedImpl<T>()->getChangeTick(e);
+				else
+					static_assert(dependent_false<T>::value, "Watched component type not found in group");
+			}
+
+			/**
+			 * @brief Checks whether the watched components of an entity changed after a given tick.
+			 *
+			 * @tparam Watched Component types to check, every group component when empty.
+			 * @param e Entity.
+			 * @param index Index of the entity in the group.
+			 * @param since Reference tick.
+			 * @return true if at least one watched component changed after since.
+			 */
+			template<typename... Watched>
+			bool isChangedSince(Entity e, size_t index, const Tick since) const
+			{
+				if constexpr (sizeof...(Watched) > 0) {
+					return ((getChangeTickOf<Watched>(e, index) > since) || ...);
+				} else {
+					const bool ownedChanged = std::apply([index, since](auto&&... arrays) {
+						return ((arrays->getChangeTickAt(index) > since) || ...);
+					}, m_ownedArrays);
+					if (ownedChanged)
+						return true;
+					return std::apply([e, since](auto&&... arrays) {
+						return ((arrays->getChangeTick(e) > since) || ...);
+					}, m_nonOwnedArrays);
+				}
+			}
+
 			/**
 			* @brief Defines the direction for sorting operations
 			*/
@@ -951,7 +1335,10 @@ namespace parallax::ecs {
 		    Signature      m_allSignature{};   ///< Combined signature for all components.
 			bool m_sortingInvalidated = true;    ///< Flag indicating if sorting is invalidated.
 			SortingOrder m_sortingOrder = SortingOrder::ASCENDING;
-   			std::unordered_map<std::string, std::unique_ptr<IPartitionStorage>> m_partitionStorageMap; ///< Map storing partition data by ID.
+			static constexpr size_t NO_ORDERED_PARTITION = std::numeric_limits<size_t>::max();
+			std::vector<std::unique_ptr<IPartitionStorage>> m_partitionStorages; ///< Registered partitionings, indexed by handle.
+			std::unordered_map<std::string, size_t> m_partitionIds; ///< Partitioning index by ID.
+			size_t m_orderedPartition = NO_ORDERED_PARTITION; ///< Partitioning the group region is currently ordered by.
 
 	};
 }
@@ -123,26 +123,84 @@ namespace parallax::ecs {
 					AccessType::Read;
 			};
 
+			/**
+			* @brief Reference type a component is handed out as, const unless Write access is specified
+			*
+			* @tparam T The component type
+			*/
+			template<typename T>
+			using AccessRef = std::conditional_t<GetComponentAccess<T>::accessType == AccessType::Write, T&, const T&>;
+
+			/**
+			* @brief Checks that a callable can be invoked with the access-qualified components of the group
+			*/
+			template<typename Func, typename OT, typename NOT>
+			struct RespectsAccess;
+
+			template<typename Func, typename... OT, typename... NOT>
+			struct RespectsAccess<Func, std::tuple<OT...>, std::tuple<NOT...>>
+				: std::is_invocable<Func&, Entity, AccessRef<OT>..., AccessRef<NOT>...> {};
+
+			/**
+			* @brief Raw pointers to every component array of the group, used for change tracking
+			*/
+			template<typename OT, typename NOT>
+			struct ArrayPointers;
+
+			template<typename... OT, typename... NOT>
+			struct ArrayPointers<std::tuple<OT...>, std::tuple<NOT...>> {
+				using Type = std::tuple<ComponentArray<OT>*..., ComponentArray<NOT>*...>;
+
+				static Type fetch()
+				{
+					return Type{coord->getComponentArray<OT>().get()..., coord->getComponentArray<NOT>().get()...};
+				}
+			};
+
 			/**
 			* @brief Access-controlled span wrapper for component arrays
 			*
 			* Provides enforced read-only or read-write access to components
 			* based on the access permissions specified in the system.
+			* Mutable accesses to Write components stamp the change tick of the
+			* underlying array so that change-filtered iterations can see them.
 			*
 			* @tparam T The component type
 			*/
 			template<typename T>
 			class ComponentSpan {
 				private:
+					static constexpr bool isWritable =
+						GetComponentAccess<std::remove_const_t<T>>::accessType == AccessType::Write;
+
 					std::span<T> m_span;
+					ComponentArray<std::remove_const_t<T>> *m_array = nullptr;
+
+					void markChanged([[maybe_unused]] const size_t index)
+					{
+						if constexpr (isWritable) {
+							if (m_array)
+								m_array->markChangedAt(index);
+						}
+					}
+
+					void markAllChanged()
+					{
+						if constexpr (isWritable) {
+							for (size_t i = 0; i < m_span.size(); ++i)
+								markChanged(i);
+						}
+					}
 
 				public:
 					/**
 					* @brief Constructs a ComponentSpan from a raw span
 					*
 					* @param span The underlying component data span
+					* @param array The component array owning the data, used for change tracking
 					*/
-					explicit ComponentSpan(std::span<T> span) : m_span(span) {}
+					explicit ComponentSpan(std::span<T> span, ComponentArray<std::remove_const_t<T>> *array = nullptr)
+						: m_span(span), m_array(array) {}
 
 					/**
 					* @brief Returns the number of components in the span
@@ -167,9 +225,10 @@ namespace parallax::ecs {
 																					const std::remove_const_t<U>&
 						>
 					{
-						if constexpr (GetComponentAccess<std::remove_const_t<U>>::accessType == AccessType::Write)
+						if constexpr (GetComponentAccess<std::remove_const_t<U>>::accessType == AccessType::Write) {
+							markChanged(index);
 							return const_cast<std::remove_const_t<U>&>(m_span[index]);
-						else
+						} else
 							return m_span[index];
 					}
 
@@ -189,9 +248,17 @@ namespace parallax::ecs {
 
 					/**
 					* @brief Returns an iterator to the beginning of the span
+					*
+					* Iterators give mutable access to the whole span, so every
+					* component is marked as changed for Write components.
+					*
 					* @return Iterator to the first element
 					*/
-					auto begin() { return m_span.begin(); }
+					auto begin()
+					{
+						markAllChanged();
+						return m_span.begin();
+					}
 
 					/**
 					* @brief Returns an iterator to the end of the span
@@ -264,7 +331,7 @@ namespace parallax::ecs {
 						GetComponentAccess<T>::accessType == AccessType::Read,
 						const T,
 						T
-					>>(baseSpan);
+					>>(baseSpan, coord->getComponentArray<T>().get());
 				} else {
 					// For non-owned components, return the component array itself
 					auto componentArray = m_group->template get<T>();
@@ -277,6 +344,34 @@ namespace parallax::ecs {
 				}
 			}
 
+			/**
+			* @brief Iterates over the group in parallel with access rights enforced
+			*
+			* Components are passed in the group order (owned, then non-owned). Read components are
+			* handed out as const references, so a callable taking one of them by mutable reference
+			* is rejected at compile time. Write components are marked as changed for each entity.
+			* The callable runs concurrently on several threads and must only touch the entity it receives.
+			*
+			* @tparam Func Callable type taking (Entity, components...)
+			* @param func Function to call for each entity
+			* @param grainSize Number of entities processed by a single job
+			*/
+			template<typename Func>
+			void eachParallel(Func func, const size_t grainSize = DEFAULT_GRAIN_SIZE)
+			{
+				static_assert(RespectsAccess<Func, OwnedTypes, NonOwnedTypes>::value,
+				              "eachParallel: Read components must be taken by const reference");
+
+				if (!m_group)
+					THROW_EXCEPTION(InternalError, "Group is null in GroupSystem");
+
+				const auto arrays = ArrayPointers<OwnedTypes, NonOwnedTypes>::fetch();
+				m_group->eachParallel([&func, &arrays](const Entity entity, auto&... components) {
+					(markIfWritten<std::remove_cvref_t<decltype(components)>>(arrays, entity), ...);
+					func(entity, static_cast<AccessRef<std::remove_cvref_t<decltype(components)>>>(components)...);
+				}, grainSize);
+			}
+
 			/**
 			* @brief Check if a component type is owned by this system
 			*
@@ -290,6 +385,16 @@ namespace parallax::ecs {
 				return OwnedTraitResult::found;
 			}
 
+			/**
+			* @brief Describes the components and singletons this system reads and writes
+			*
+			* @return SystemAccess Access declaration used by the SystemScheduler
+			*/
+			static SystemAccess getAccessDeclaration()
+			{
+				return SystemAccess::from<OwnedAccess, NonOwnedAccess, SingletonAccessTypes...>();
+			}
+
 	        /**
 	         * @brief Get all entities in this group
 	         *
@@ -307,6 +412,19 @@ namespace parallax::ecs {
 	        std::shared_ptr<ActualGroupType> m_group = nullptr;
 
 	    private:
+			/**
+			* @brief Stamps the component of an entity as changed if the system has Write access to it
+			*
+			* @tparam T The component type
+			* @param arrays Pointers to the component arrays of the group
+			* @param entity The entity whose component is handed out
+			*/
+			template<typename T, typename ArraysTuple>
+			static void markIfWritten(const ArraysTuple &arrays, const Entity entity)
+			{
+				if constexpr (GetComponentAccess<T>::accessType == AccessType::Write)
+					std::get<ComponentArray<T>*>(arrays)->markChanged(entity);
+			}
 
 #if defined(_MSC_VER)
     #pragma warning(push) // createGroupImpl
@@ -0,0 +1,259 @@
+//// Hierarchy.cpp ////////////////////////////////////////////////////////////
+//
+// ⢀⢀⢀⣤⣤⣤⡀⢀⢀⢀⢀⢀⢀⢠⣤⡄⢀⢀⢀⢀⣠⣤⣤⣤⣤⣤⣤⣤⣤⣤⡀⢀⢀⢀⢠⣤⣄⢀⢀⢀⢀⢀⢀⢀⣤⣤⢀⢀⢀⢀⢀⢀⢀⢀⣀⣄⢀⢀⢠⣄⣀⢀⢀⢀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⣿⣷⡀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡟⡛⡛⡛⡛⡛⡛⡛⢁⢀⢀⢀⢀⢻⣿⣦⢀⢀⢀⢀⢠⣾⡿⢃⢀⢀⢀⢀⢀⣠⣾⣿⢿⡟⢀⢀⡙⢿⢿⣿⣦⡀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⡛⣿⣷⡀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡙⣿⡷⢀⢀⣰⣿⡟⢁⢀⢀⢀⢀⢀⣾⣿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⣿⡆⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⡈⢿⣷⡄⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣇⣀⣀⣀⣀⣀⣀⣀⢀⢀⢀⢀⢀⢀⢀⡈⢀⢀⣼⣿⢏⢀⢀⢀⢀⢀⢀⣼⣿⡏⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡘⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⡈⢿⣿⡄⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣿⢿⢿⢿⢿⢿⢿⢿⢇⢀⢀⢀⢀⢀⢀⢀⢠⣾⣿⣧⡀⢀⢀⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⡈⢿⣿⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣰⣿⡟⡛⣿⣷⡄⢀⢀⢀⢀⢀⢿⣿⣇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⡈⢿⢀⢀⢸⣿⡇⢀⢀⢀⢀⡛⡟⢁⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⡟⢀⢀⡈⢿⣿⣄⢀⢀⢀⢀⡘⣿⣿⣄⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⢏⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⢀⣀⣀⣀⣀⣀⣀⣀⣀⣀⡀⢀⢀⢀⣠⣾⡿⢃⢀⢀⢀⢀⢀⢻⣿⣧⡀⢀⢀⢀⡈⢻⣿⣷⣦⣄⢀⢀⣠⣤⣶⣿⡿⢋⢀⢀⢀⢀
+// ⢀⢀⢀⢿⢿⢀⢀⢀⢀⢀⢀⢀⢀⢸⢿⢃⢀⢀⢀⢀⢻⢿⢿⢿⢿⢿⢿⢿⢿⢿⢃⢀⢀⢀⢿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⡗⢀⢀⢀⢀⢀⡈⡉⡛⡛⢀⢀⢹⡛⢋⢁⢀⢀⢀⢀⢀⢀
+//
+//  Author:      Parallax Engine Team
+//  Date:        16/10/2026
+//  Description: Source file for the flat, depth-first entity hierarchy store
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include "Hierarchy.hpp"
+#include "ECSExceptions.hpp"
+#include "Snapshot.hpp"
+
+#include <algorithm>
+
+namespace parallax::ecs {
+
+    void Hierarchy::setParent(const Entity entity, const Entity parent)
+    {
+        if (entity >= MAX_ENTITIES)
+            THROW_EXCEPTION(OutOfRange, entity);
+        if (parent != INVALID_ENTITY && parent >= MAX_ENTITIES)
+            THROW_EXCEPTION(OutOfRange, parent);
+        if (parent == entity)
+            THROW_EXCEPTION(HierarchyCycle, entity, parent);
+
+        std::uint32_t index = m_index.get(entity);
+        if (index == PagedSparseIndex::INVALID_INDEX)
+            index = insertRoot(entity);
+        const std::uint32_t count = m_subtreeSizes[index];
+
+        if (parent == INVALID_ENTITY) {
+            if (m_parents[index] == NO_PARENT)
+                return;
+            ++m_version;
+            addToAncestorSizes(m_parents[index], -static_cast<std::int64_t>(count));
+            m_parents[index] = NO_PARENT;
+            moveSubtree(index, static_cast<std::uint32_t>(m_entities.size()));
+            return;
+        }
+
+        std::uint32_t parentIndex = m_index.get(parent);
+        if (parentIndex == PagedSparseIndex::INVALID_INDEX)
+            parentIndex = insertRoot(parent);
+        if (parentIndex > index && parentIndex < index + count)
+            THROW_EXCEPTION(HierarchyCycle, entity, parent);
+        if (m_parents[index] == parentIndex)
+            return;
+        ++m_version;
+
+        // The insertion point is taken before the old ancestors shrink, the subtree may still lie inside the new parent
+        const std::uint32_t destination = parentIndex + m_subtreeSizes[parentIndex];
+        if (m_parents[index] != NO_PARENT)
+            addToAncestorSizes(m_parents[index], -static_cast<std::int64_t>(count));
+        m_parents[index] = parentIndex;
+        const std::uint32_t newIndex = moveSubtree(index, destination);
+        addToAncestorSizes(m_parents[newIndex], count);
+    }
+
+    void Hierarchy::remove(const Entity entity)
+    {
+        const std::uint32_t index = m_index.get(entity);
+        if (index == PagedSparseIndex::INVALID_INDEX)
+            return;
+
+        ++m_version;
+        const std::uint32_t parent = m_parents[index];
+        if (parent != NO_PARENT)
+            addToAncestorSizes(parent, -1);
+        // Children stay in place, right after the removed node, so the order remains depth-first
+        const std::uint32_t end = index + m_subtreeSizes[index];
+        for (std::uint32_t child = index + 1; child < end; child += m_subtreeSizes[child])
+            m_parents[child] = parent;
+        eraseRange(index, 1);
+    }
+
+    void Hierarchy::removeSubtree(const Entity entity)
+    {
+        const std::uint32_t index = m_index.get(entity);
+        if (index == PagedSparseIndex::INVALID_INDEX)
+            return;
+
+        ++m_version;
+        const std::uint32_t count = m_subtreeSizes[index];
+        if (m_parents[index] != NO_PARENT)
+            addToAncestorSizes(m_parents[index], -static_cast<std::int64_t>(count));
+        eraseRange(index, count);
+    }
+
+    void Hierarchy::clear()
+    {
+        for (const Entity entity : m_entities)
+            m_index.erase(entity);
+        m_entities.clear();
+        m_parents.clear();
+        m_subtreeSizes.clear();
+        ++m_version;
+    }
+
+    Entity Hierarchy::getParent(const Entity entity) const
+    {
+        const std::uint32_t index = m_index.get(entity);
+        if (index == PagedSparseIndex::INVALID_INDEX || m_parents[index] == NO_PARENT)
+            return INVALID_ENTITY;
+        return m_entities[m_parents[index]];
+    }
+
+    std::span<const Entity> Hierarchy::subtree(const Entity entity) const
+    {
+        const std::uint32_t index = m_index.get(entity);
+        if (index == PagedSparseIndex::INVALID_INDEX)
+            return {};
+        return {m_entities.data() + index, m_subtreeSizes[index]};
+    }
+
+    std::span<const Entity> Hierarchy::descendants(const Entity entity) const
+    {
+        const std::span<const Entity> nodes = subtree(entity);
+        return nodes.empty() ? nodes : nodes.subspan(1);
+    }
+
+    void Hierarchy::snapshot(SnapshotWriter &writer) const
+    {
+        writer.writeBlock(std::span<const Entity>(m_entities));
+        writer.writeBlock(std::span<const std::uint32_t>(m_parents));
+        writer.writeBlock(std::span<const std::uint32_t>(m_subtreeSizes));
+    }
+
+    void Hierarchy::restore(SnapshotReader &reader)
+    {
+        std::vector<Entity> entities;
+        std::vector<std::uint32_t> parents;
+        std::vector<std::uint32_t> subtreeSizes;
+        reader.readBlock(entities);
+        reader.readBlock(parents);
+        reader.readBlock(subtreeSizes);
+
+        const std::size_t count = entities.size();
+        if (parents.size() != count || subtreeSizes.size() != count)
+            THROW_EXCEPTION(InvalidSnapshot, "inconsistent hierarchy block");
+
+        // Replay the depth-first order with a stack of open subtrees: each node must be
+        // stored right after its parent's previous descendants and fit inside its range
+        PagedSparseIndex index;
+        std::vector<std::uint32_t> open;
+        std::vector<std::uint32_t> expectedSizes(count, 1);
+        for (std::uint32_t i = 0; i < count; ++i) {
+            if (entities[i] >= MAX_ENTITIES || index.contains(entities[i]))
+                THROW_EXCEPTION(InvalidSnapshot, "invalid or duplicated entity in the hierarchy");
+            index.set(entities[i], i);
+
+            while (!open.empty() && open.back() + subtreeSizes[open.back()] <= i)
+                open.pop_back();
+            const std::uint32_t expectedParent = open.empty() ? NO_PARENT : open.back();
+            const bool fits = subtreeSizes[i] >= 1 && subtreeSizes[i] <= count - i
+                && (open.empty() || i + subtreeSizes[i] <= open.back() + subtreeSizes[open.back()]);
+            if (parents[i] != expectedParent || !fits)
+                THROW_EXCEPTION(InvalidSnapshot, "hierarchy is not stored in depth-first order");
+            open.push_back(i);
+        }
+        for (std::size_t i = count; i-- > 0;) {
+            if (parents[i] != NO_PARENT)
+                expectedSizes[parents[i]] += expectedSizes[i];
+        }
+        if (expectedSizes != subtreeSizes)
+            THROW_EXCEPTION(InvalidSnapshot, "hierarchy subtree sizes are inconsistent");
+
+        m_entities = std::move(entities);
+        m_parents = std::move(parents);
+        m_subtreeSizes = std::move(subtreeSizes);
+        m_index = std::move(index);
+        ++m_version;
+    }
+
+    void Hierarchy::replaceWith(Hierarchy &&other)
+    {
+        const std::uint64_t version = std::max(m_version, other.m_version) + 1;
+        *this = std::move(other);
+        m_version = version;
+    }
+
+    std::uint32_t Hierarchy::insertRoot(const Entity entity)
+    {
+        const auto index = static_cast<std::uint32_t>(m_entities.size());
+        m_entities.push_back(entity);
+        m_parents.push_back(NO_PARENT);
+        m_subtreeSizes.push_back(1);
+        m_index.set(entity, index);
+        // Data indexed like the nodes no longer covers all of them
+        ++m_version;
+        return index;
+    }
+
+    void Hierarchy::addToAncestorSizes(std::uint32_t index, const std::int64_t delta)
+    {
+        for (; index != NO_PARENT; index = m_parents[index])
+            m_subtreeSizes[index] = static_cast<std::uint32_t>(m_subtreeSizes[index] + delta);
+    }
+
+    std::uint32_t Hierarchy::moveSubtree(const std::uint32_t start, const std::uint32_t destination)
+    {
+        const std::uint32_t end = start + m_subtreeSizes[start];
+        if (destination >= start && destination <= end)
+            return start;
+
+        // Rotating [lo, hi) around mid swaps the subtree with the block of nodes it jumps over
+        const bool backward = destination < start;
+        const std::uint32_t lo = backward ? destination : start;
+        const std::uint32_t mid = backward ? start : end;
+        const std::uint32_t hi = backward ? end : destination;
+        const auto remap = [&](const std::uint32_t oldIndex) {
+            return oldIndex < mid ? oldIndex + (hi - mid) : oldIndex - (mid - lo);
+        };
+
+        std::rotate(m_entities.begin() + lo, m_entities.begin() + mid, m_entities.begin() + hi);
+        std::rotate(m_parents.begin() + lo, m_parents.begin() + mid, m_parents.begin() + hi);
+        std::rotate(m_subtreeSizes.begin() + lo, m_subtreeSizes.begin() + mid, m_subtreeSizes.begin() + hi);
+
+        for (std::uint32_t i = lo; i < hi; ++i) {
+            m_index.set(m_entities[i], i);
+            if (m_parents[i] != NO_PARENT && m_parents[i] >= lo)
+                m_parents[i] = remap(m_parents[i]);
+        }
+        // Nodes after the rotated range whose parent moved are children of ancestors spanning hi:
+        // they are found by skipping from subtree to subtree until a parent lies before the range
+        for (std::uint32_t pos = hi; pos < m_entities.size(); pos += m_subtreeSizes[pos]) {
+            const std::uint32_t parent = m_parents[pos];
+            if (parent == NO_PARENT || parent < lo)
+                break;
+            m_parents[pos] = remap(parent);
+        }
+
+        return backward ? lo : hi - (end - start);
+    }
+
+    void Hierarchy::eraseRange(const std::uint32_t start, const std::uint32_t count)
+    {
+        for (std::uint32_t i = start; i < start + count; ++i)
+            m_index.erase(m_entities[i]);
+        m_entities.erase(m_entities.begin() + start, m_entities.begin() + start + count);
+        m_parents.erase(m_parents.begin() + start, m_parents.begin() + start + count);
+        m_subtreeSizes.erase(m_subtreeSizes.begin() + start, m_subtreeSizes.begin() + start + count);
+
+        for (std::uint32_t i = start; i < m_entities.size(); ++i) {
+            m_index.set(m_entities[i], i);
+            if (m_parents[i] != NO_PARENT && m_parents[i] >= start)
+                m_parents[i] -= count;
+        }
+    }
+}
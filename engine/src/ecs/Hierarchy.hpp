@@ -0,0 +1,242 @@
+//// Hierarchy.hpp ////////////////////////////////////////////////////////////
+//
+// ⢀⢀⢀⣤⣤⣤⡀⢀⢀⢀⢀⢀⢀⢠⣤⡄⢀⢀⢀⢀⣠⣤⣤⣤⣤⣤⣤⣤⣤⣤⡀⢀⢀⢀⢠⣤⣄⢀⢀⢀⢀⢀⢀⢀⣤⣤⢀⢀⢀⢀⢀⢀⢀⢀⣀⣄⢀⢀⢠⣄⣀⢀⢀⢀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⣿⣷⡀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡟⡛⡛⡛⡛⡛⡛⡛⢁⢀⢀⢀⢀⢻⣿⣦⢀⢀⢀⢀⢠⣾⡿⢃⢀⢀⢀⢀⢀⣠⣾⣿⢿⡟⢀⢀⡙⢿⢿⣿⣦⡀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⡛⣿⣷⡀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡙⣿⡷⢀⢀⣰⣿⡟⢁⢀⢀⢀⢀⢀⣾⣿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⣿⡆⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⡈⢿⣷⡄⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣇⣀⣀⣀⣀⣀⣀⣀⢀⢀⢀⢀⢀⢀⢀⡈⢀⢀⣼⣿⢏⢀⢀⢀⢀⢀⢀⣼⣿⡏⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡘⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⡈⢿⣿⡄⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣿⢿⢿⢿⢿⢿⢿⢿⢇⢀⢀⢀⢀⢀⢀⢀⢠⣾⣿⣧⡀⢀⢀⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⡈⢿⣿⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣰⣿⡟⡛⣿⣷⡄⢀⢀⢀⢀⢀⢿⣿⣇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⡈⢿⢀⢀⢸⣿⡇⢀⢀⢀⢀⡛⡟⢁⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⡟⢀⢀⡈⢿⣿⣄⢀⢀⢀⢀⡘⣿⣿⣄⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⢏⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⢀⣀⣀⣀⣀⣀⣀⣀⣀⣀⡀⢀⢀⢀⣠⣾⡿⢃⢀⢀⢀⢀⢀⢻⣿⣧⡀⢀⢀⢀⡈⢻⣿⣷⣦⣄⢀⢀⣠⣤⣶⣿⡿⢋⢀⢀⢀⢀
+// ⢀⢀⢀⢿⢿⢀⢀⢀⢀⢀⢀⢀⢀⢸⢿⢃⢀⢀⢀⢀⢻⢿⢿⢿⢿⢿⢿⢿⢿⢿⢃⢀⢀⢀⢿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⡗⢀⢀⢀⢀⢀⡈⡉⡛⡛⢀⢀⢹⡛⢋⢁⢀⢀⢀⢀⢀⢀
+//
+//  Author:      Parallax Engine Team
+//  Date:        16/10/2026
+//  Description: Header file for the flat, depth-first entity hierarchy store
+//
+///////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include "Definitions.hpp"
+#include "SparseIndex.hpp"
+
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <vector>
+
+namespace parallax::ecs {
+
+    class SnapshotWriter;
+    class SnapshotReader;
+
+    /**
+     * @class Hierarchy
+     * @brief Parent / child relationships stored as flat arrays in depth-first order
+     *
+     * Every tree is kept contiguous: a node is immediately followed by all of its
+     * descendants, and each node records the dense index of its parent and the size of
+     * its subtree. Parents therefore always come before their children, so world matrices
+     * can be propagated in a single forward pass indexing the parent's slot, without
+     * recursion nor per-node child lists.
+     *
+     * Only entities that take part in a parent / child relationship need to be stored.
+     *
+     * @note This class is not thread-safe.
+     */
+    class Hierarchy {
+        public:
+            /**
+             * @brief Parent index of a root node
+             */
+            static constexpr std::uint32_t NO_PARENT = std::numeric_limits<std::uint32_t>::max();
+
+            /**
+             * @brief Attaches an entity under a parent, or detaches it as a root
+             *
+             * Entities that are not stored yet are inserted. The whole subtree of the entity
+             * is spliced at the end of the subtree of its new parent, which costs the size of
+             * the moved subtree plus the nodes it jumps over, and never allocates once the
+             * arrays have grown.
+             *
+             * @param entity The entity to move
+             * @param parent The new parent, or INVALID_ENTITY to make the entity a root
+             * @throws OutOfRange if an entity ID exceeds MAX_ENTITIES
+             * @throws HierarchyCycle if parent is the entity itself or one of its descendants
+             */
+            void setParent(Entity entity, Entity parent);
+
+            /**
+             * @brief Removes a single node, its children are attached to its parent
+             *
+             * Does nothing if the entity is not stored.
+             *
+             * @param entity The entity to remove
+             */
+            void remove(Entity entity);
+
+            /**
+             * @brief Removes a node together with all of its descendants
+             *
+             * Does nothing if the entity is not stored.
+             *
+             * @param entity The root of the subtree to remove
+             */
+            void removeSubtree(Entity entity);
+
+            /**
+             * @brief Removes every node
+             */
+            void clear();
+
+            /**
+             * @brief Checks whether an entity is stored in the hierarchy
+             */
+            [[nodiscard]] bool contains(const Entity entity) const { return m_index.contains(entity); }
+
+            /**
+             * @brief Gets the parent of an entity
+             *
+             * @param entity The entity to look up
+             * @return The parent, or INVALID_ENTITY for roots and entities that are not stored
+             */
+            [[nodiscard]] Entity getParent(Entity entity) const;
+
+            /**
+             * @brief Gets an entity followed by all of its descendants, in depth-first order
+             *
+             * @param entity The root of the subtree
+             * @return The contiguous subtree, empty if the entity is not stored
+             */
+            [[nodiscard]] std::span<const Entity> subtree(Entity entity) const;
+
+            /**
+             * @brief Gets the descendants of an entity, in depth-first order
+             *
+             * @param entity The root of the subtree
+             * @return The contiguous descendants, empty if the entity is not stored or has no children
+             */
+            [[nodiscard]] std::span<const Entity> descendants(Entity entity) const;
+
+            /**
+             * @brief Calls a function for every direct child of an entity, in order
+             *
+             * Children are found by skipping over the subtree of each previous child.
+             *
+             * @param entity The parent entity
+             * @param func Function taking the child entity
+             */
+            template<typename Func>
+            void forEachChild(const Entity entity, Func &&func) const
+            {
+                const auto index = m_index.get(entity);
+                if (index == PagedSparseIndex::INVALID_INDEX)
+                    return;
+                const std::size_t end = index + m_subtreeSizes[index];
+                for (std::size_t child = index + 1; child < end; child += m_subtreeSizes[child])
+                    func(m_entities[child]);
+            }
+
+            /**
+             * @brief Gets the dense index of an entity
+             *
+             * @return The index in entities() / parents(), or PagedSparseIndex::INVALID_INDEX if not stored
+             */
+            [[nodiscard]] std::uint32_t indexOf(const Entity entity) const { return m_index.get(entity); }
+
+            /**
+             * @brief Gets every stored entity, in depth-first order
+             */
+            [[nodiscard]] std::span<const Entity> entities() const { return m_entities; }
+
+            /**
+             * @brief Gets the dense index of the parent of every node, NO_PARENT for roots
+             *
+             * Parents always have a smaller index than their children.
+             */
+            [[nodiscard]] std::span<const std::uint32_t> parents() const { return m_parents; }
+
+            /**
+             * @brief Gets the number of nodes of the subtree rooted at every node, itself included
+             */
+            [[nodiscard]] std::span<const std::uint32_t> subtreeSizes() const { return m_subtreeSizes; }
+
+            /**
+             * @brief Gets the number of stored entities
+             */
+            [[nodiscard]] std::size_t size() const { return m_entities.size(); }
+
+            /**
+             * @brief Gets a counter incremented every time a node is added, moved or removed
+             *
+             * Data indexed like entities() stays valid as long as the version does not change.
+             */
+            [[nodiscard]] std::uint64_t version() const { return m_version; }
+
+            /**
+             * @brief Writes the hierarchy to a snapshot
+             * @param writer Destination stream
+             */
+            void snapshot(SnapshotWriter &writer) const;
+
+            /**
+             * @brief Replaces the hierarchy with the content written by snapshot()
+             *
+             * The content is validated before anything is replaced.
+             *
+             * @param reader Source stream
+             * @throws InvalidSnapshot if the arrays do not describe a valid depth-first forest
+             */
+            void restore(SnapshotReader &reader);
+
+            /**
+             * @brief Moves the content of another hierarchy into this one
+             *
+             * Unlike move assignment, the version ends strictly above both previous versions, so data
+             * cached for either hierarchy is seen as stale.
+             *
+             * @param other Hierarchy whose content is taken, left empty
+             */
+            void replaceWith(Hierarchy &&other);
+
+        private:
+            // Entities in depth-first order.
+            std::vector<Entity> m_entities;
+            // Dense index of the parent of each node, NO_PARENT for roots.
+            std::vector<std::uint32_t> m_parents;
+            // Number of nodes in the subtree of each node, itself included.
+            std::vector<std::uint32_t> m_subtreeSizes;
+            // Maps entity IDs to their dense index.
+            PagedSparseIndex m_index;
+            // Incremented by every operation that adds, moves or removes nodes.
+            std::uint64_t m_version = 0;
+
+            /**
+             * @brief Appends an entity as a root and returns its index
+             */
+            std::uint32_t insertRoot(Entity entity);
+
+            /**
+             * @brief Adds a value to the subtree size of a node and of all of its ancestors
+             */
+            void addToAncestorSizes(std::uint32_t index, std::int64_t delta);
+
+            /**
+             * @brief Moves the subtree starting at start so that it begins at destination
+             *
+             * Rotates [start, destination) or [destination, start + count) and fixes the
+             * sparse index and the parent indices of the moved nodes and of the nodes whose
+             * parent moved.
+             *
+             * @param start Index of the subtree root
+             * @param destination Insertion point, outside of the subtree
+             * @return The new index of the subtree root
+             */
+            std::uint32_t moveSubtree(std::uint32_t start, std::uint32_t destination);
+
+            /**
+             * @brief Erases count nodes starting at start and shifts the following indices down
+             */
+            void eraseRange(std::uint32_t start, std::uint32_t count);
+    };
+}
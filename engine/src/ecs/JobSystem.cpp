@@ -0,0 +1,201 @@
+//// JobSystem.cpp ////////////////////////////////////////////////////////////
+//
+// ⢀⢀⢀⣤⣤⣤⡀⢀⢀⢀⢀⢀⢀⢠⣤⡄⢀⢀⢀⢀⣠⣤⣤⣤⣤⣤⣤⣤⣤⣤⡀⢀⢀⢀⢠⣤⣄⢀⢀⢀⢀⢀⢀⢀⣤⣤⢀⢀⢀⢀⢀⢀⢀⢀⣀⣄⢀⢀⢠⣄⣀⢀⢀⢀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⣿⣷⡀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡟⡛⡛⡛⡛⡛⡛⡛⢁⢀⢀⢀⢀⢻⣿⣦⢀⢀⢀⢀⢠⣾⡿⢃⢀⢀⢀⢀⢀⣠⣾⣿⢿⡟⢀⢀⡙⢿⢿⣿⣦⡀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⡛⣿⣷⡀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡙⣿⡷⢀⢀⣰⣿⡟⢁⢀⢀⢀⢀⢀⣾⣿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⣿⡆⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⡈⢿⣷⡄⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣇⣀⣀⣀⣀⣀⣀⣀⢀⢀⢀⢀⢀⢀⢀⡈⢀⢀⣼⣿⢏⢀⢀⢀⢀⢀⢀⣼⣿⡏⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡘⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⡈⢿⣿⡄⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣿⢿⢿⢿⢿⢿⢿⢿⢇⢀⢀⢀⢀⢀⢀⢀⢠⣾⣿⣧⡀⢀⢀⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⡈⢿⣿⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣰⣿⡟⡛⣿⣷⡄⢀⢀⢀⢀⢀⢿⣿⣇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⡈⢿⢀⢀⢸⣿⡇⢀⢀⢀⢀⡛⡟⢁⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⡟⢀⢀⡈⢿⣿⣄⢀⢀⢀⢀⡘⣿⣿⣄⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⢏⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⢀⣀⣀⣀⣀⣀⣀⣀⣀⣀⡀⢀⢀⢀⣠⣾⡿⢃⢀⢀⢀⢀⢀⢻⣿⣧⡀⢀⢀⢀⡈⢻⣿⣷⣦⣄⢀⢀⣠⣤⣶⣿⡿⢋⢀⢀⢀⢀
+// ⢀⢀⢀⢿⢿⢀⢀⢀⢀⢀⢀⢀⢀⢸⢿⢃⢀⢀⢀⢀⢻⢿⢿⢿⢿⢿⢿⢿⢿⢿⢃⢀⢀⢀⢿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⡗⢀⢀⢀⢀⢀⡈⡉⡛⡛⢀⢀⢹⡛⢋⢁⢀⢀⢀⢀⢀⢀
+//
+//  Author:      Parallax Engine Team
+//  Date:        16/10/2026
+//  Description: Source file for the engine-wide work-stealing job system
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include "JobSystem.hpp"
+
+#include <algorithm>
+#include <utility>
+
+namespace parallax::ecs {
+
+    namespace {
+        // Identifies the job system and queue owned by a worker thread
+        thread_local const JobSystem *t_owner = nullptr;
+        thread_local std::size_t t_queueIndex = 0;
+    }
+
+    JobSystem::JobSystem(const unsigned int workerCount)
+    {
+        m_queues.reserve(workerCount + 1);
+        for (unsigned int i = 0; i < workerCount + 1; ++i)
+            m_queues.push_back(std::make_unique<WorkQueue>());
+
+        m_workers.reserve(workerCount);
+        for (unsigned int i = 0; i < workerCount; ++i)
+            m_workers.emplace_back(&JobSystem::workerLoop, this, i + 1);
+    }
+
+    JobSystem::~JobSystem()
+    {
+        {
+            std::lock_guard lock(m_sleepMutex);
+            m_running = false;
+        }
+        m_wakeCondition.notify_all();
+        for (auto &worker : m_workers)
+            worker.join();
+    }
+
+    JobSystem &JobSystem::getInstance()
+    {
+        static JobSystem instance;
+        return instance;
+    }
+
+    unsigned int JobSystem::defaultWorkerCount()
+    {
+        const unsigned int hardwareThreads = std::thread::hardware_concurrency();
+        return hardwareThreads > 1 ? hardwareThreads - 1 : 0;
+    }
+
+    std::size_t JobSystem::currentQueueIndex() const
+    {
+        return t_owner == this ? t_queueIndex : 0;
+    }
+
+    void JobSystem::submit(Job job, JobCounter &counter)
+    {
+        counter.m_pending.fetch_add(1, std::memory_order_relaxed);
+
+        WorkQueue &queue = *m_queues[currentQueueIndex()];
+        {
+            std::lock_guard lock(queue.mutex);
+            queue.jobs.push_back({std::move(job), &counter});
+        }
+        m_queuedJobs.fetch_add(1, std::memory_order_release);
+
+        {
+            // Taking the lock guarantees a worker about to sleep sees the new job
+            std::lock_guard lock(m_sleepMutex);
+        }
+        m_wakeCondition.notify_one();
+    }
+
+    void JobSystem::wait(JobCounter &counter)
+    {
+        const std::size_t queueIndex = currentQueueIndex();
+        while (!counter.isDone()) {
+            if (!tryRunJob(queueIndex))
+                std::this_thread::yield();
+        }
+
+        std::exception_ptr exception;
+        {
+            std::lock_guard lock(counter.m_exceptionMutex);
+            exception = std::exchange(counter.m_exception, nullptr);
+        }
+        if (exception)
+            std::rethrow_exception(exception);
+    }
+
+    bool JobSystem::tryRunPendingJob()
+    {
+        return tryRunJob(currentQueueIndex());
+    }
+
+    void JobSystem::parallelFor(const std::size_t begin, const std::size_t end, std::size_t grainSize,
+                                const std::function<void(std::size_t, std::size_t)> &func)
+    {
+        if (begin >= end)
+            return;
+
+        grainSize = std::max<std::size_t>(grainSize, 1);
+        if (m_workers.empty() || end - begin <= grainSize) {
+            func(begin, end);
+            return;
+        }
+
+        JobCounter counter;
+        for (std::size_t chunkBegin = begin; chunkBegin < end; chunkBegin += grainSize) {
+            const std::size_t chunkEnd = std::min(chunkBegin + grainSize, end);
+            submit([&func, chunkBegin, chunkEnd] { func(chunkBegin, chunkEnd); }, counter);
+        }
+        wait(counter);
+    }
+
+    bool JobSystem::popJob(const std::size_t queueIndex, QueuedJob &job)
+    {
+        WorkQueue &queue = *m_queues[queueIndex];
+        std::lock_guard lock(queue.mutex);
+        if (queue.jobs.empty())
+            return false;
+        job = std::move(queue.jobs.back());
+        queue.jobs.pop_back();
+        return true;
+    }
+
+    bool JobSystem::stealJob(const std::size_t thiefIndex, QueuedJob &job)
+    {
+        const std::size_t queueCount = m_queues.size();
+        for (std::size_t offset = 1; offset < queueCount; ++offset) {
+            WorkQueue &queue = *m_queues[(thiefIndex + offset) % queueCount];
+            std::lock_guard lock(queue.mutex);
+            if (queue.jobs.empty())
+                continue;
+            job = std::move(queue.jobs.front());
+            queue.jobs.pop_front();
+            return true;
+        }
+        return false;
+    }
+
+    bool JobSystem::tryRunJob(const std::size_t queueIndex)
+    {
+        if (m_queuedJobs.load(std::memory_order_acquire) == 0)
+            return false;
+
+        QueuedJob job;
+        if (!popJob(queueIndex, job) && !stealJob(queueIndex, job))
+            return false;
+
+        m_queuedJobs.fetch_sub(1, std::memory_order_relaxed);
+        runJob(job);
+        return true;
+    }
+
+    void JobSystem::runJob(QueuedJob &job)
+    {
+        try {
+            job.job();
+        } catch (...) {
+            std::lock_guard lock(job.counter->m_exceptionMutex);
+            if (!job.counter->m_exception)
+                job.counter->m_exception = std::current_exception();
+        }
+        job.counter->m_pending.fetch_sub(1, std::memory_order_release);
+    }
+
+    void JobSystem::workerLoop(const std::size_t queueIndex)
+    {
+        t_owner = this;
+        t_queueIndex = queueIndex;
+
+        while (true) {
+            if (tryRunJob(queueIndex))
+                continue;
+
+            std::unique_lock lock(m_sleepMutex);
+            m_wakeCondition.wait(lock, [this] {
+                return !m_running || m_queuedJobs.load(std::memory_order_acquire) > 0;
+            });
+            if (!m_running)
+                return;
+        }
+    }
+
+}
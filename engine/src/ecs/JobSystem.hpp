@@ -0,0 +1,187 @@
+//// JobSystem.hpp ////////////////////////////////////////////////////////////
+//
+// ⢀⢀⢀⣤⣤⣤⡀⢀⢀⢀⢀⢀⢀⢠⣤⡄⢀⢀⢀⢀⣠⣤⣤⣤⣤⣤⣤⣤⣤⣤⡀⢀⢀⢀⢠⣤⣄⢀⢀⢀⢀⢀⢀⢀⣤⣤⢀⢀⢀⢀⢀⢀⢀⢀⣀⣄⢀⢀⢠⣄⣀⢀⢀⢀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⣿⣷⡀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡟⡛⡛⡛⡛⡛⡛⡛⢁⢀⢀⢀⢀⢻⣿⣦⢀⢀⢀⢀⢠⣾⡿⢃⢀⢀⢀⢀⢀⣠⣾⣿⢿⡟⢀⢀⡙⢿⢿⣿⣦⡀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⡛⣿⣷⡀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡙⣿⡷⢀⢀⣰⣿⡟⢁⢀⢀⢀⢀⢀⣾⣿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⣿⡆⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⡈⢿⣷⡄⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣇⣀⣀⣀⣀⣀⣀⣀⢀⢀⢀⢀⢀⢀⢀⡈⢀⢀⣼⣿⢏⢀⢀⢀⢀⢀⢀⣼⣿⡏⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡘⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⡈⢿⣿⡄⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣿⢿⢿⢿⢿⢿⢿⢿⢇⢀⢀⢀⢀⢀⢀⢀⢠⣾⣿⣧⡀⢀⢀⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⡈⢿⣿⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣰⣿⡟⡛⣿⣷⡄⢀⢀⢀⢀⢀⢿⣿⣇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⡈⢿⢀⢀⢸⣿⡇⢀⢀⢀⢀⡛⡟⢁⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⡟⢀⢀⡈⢿⣿⣄⢀⢀⢀⢀⡘⣿⣿⣄⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⢏⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⢀⣀⣀⣀⣀⣀⣀⣀⣀⣀⡀⢀⢀⢀⣠⣾⡿⢃⢀⢀⢀⢀⢀⢻⣿⣧⡀⢀⢀⢀⡈⢻⣿⣷⣦⣄⢀⢀⣠⣤⣶⣿⡿⢋⢀⢀⢀⢀
+// ⢀⢀⢀⢿⢿⢀⢀⢀⢀⢀⢀⢀⢀⢸⢿⢃⢀⢀⢀⢀⢻⢿⢿⢿⢿⢿⢿⢿⢿⢿⢃⢀⢀⢀⢿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⡗⢀⢀⢀⢀⢀⡈⡉⡛⡛⢀⢀⢹⡛⢋⢁⢀⢀⢀⢀⢀⢀
+//
+//  Author:      Parallax Engine Team
+//  Date:        16/10/2026
+//  Description: Header file for the engine-wide work-stealing job system
+//
+///////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace parallax::ecs {
+
+    /**
+     * @brief Unit of work executed by the job system
+     */
+    using Job = std::function<void()>;
+
+    /**
+     * @brief Default number of elements processed by a single job in parallel loops
+     */
+    constexpr std::size_t DEFAULT_GRAIN_SIZE = 256;
+
+    /**
+     * @class JobCounter
+     * @brief Tracks the completion of a batch of jobs
+     *
+     * Every job submitted with a counter increments it, and decrements it once done.
+     * The first exception thrown by a job of the batch is kept and rethrown by JobSystem::wait.
+     */
+    class JobCounter {
+        public:
+            /**
+             * @brief Checks whether every job of the batch has completed
+             *
+             * @return true if no job is pending
+             */
+            [[nodiscard]] bool isDone() const { return m_pending.load(std::memory_order_acquire) == 0; }
+
+        private:
+            friend class JobSystem;
+
+            std::atomic<std::size_t> m_pending{0};
+            std::mutex m_exceptionMutex;
+            std::exception_ptr m_exception = nullptr;
+    };
+
+    /**
+     * @class JobSystem
+     * @brief Engine-wide work-stealing thread pool
+     *
+     * Each worker owns a deque: it pops its own jobs from the back (most recent first, good for
+     * cache locality) and steals from the front of other deques when it runs dry.
+     * Threads that are not workers push to a shared submission deque.
+     * A thread waiting on a counter keeps executing jobs instead of blocking, so nested
+     * parallel loops cannot deadlock.
+     */
+    class JobSystem {
+        public:
+            /**
+             * @brief Creates the job system and starts its workers
+             *
+             * @param workerCount Number of worker threads, the calling thread always helps on top of them
+             */
+            explicit JobSystem(unsigned int workerCount = defaultWorkerCount());
+            ~JobSystem();
+
+            JobSystem(const JobSystem&) = delete;
+            JobSystem& operator=(const JobSystem&) = delete;
+            JobSystem(JobSystem&&) = delete;
+            JobSystem& operator=(JobSystem&&) = delete;
+
+            /**
+             * @brief Gets the job system shared by the whole engine
+             *
+             * Lazily created on first use with defaultWorkerCount() workers.
+             *
+             * @return Reference to the shared job system
+             */
+            static JobSystem &getInstance();
+
+            /**
+             * @brief Number of workers used by default, one less than the hardware threads
+             *
+             * @return Default worker count
+             */
+            static unsigned int defaultWorkerCount();
+
+            /**
+             * @brief Schedules a job
+             *
+             * @param job The job to run
+             * @param counter Counter tracking the batch the job belongs to
+             */
+            void submit(Job job, JobCounter &counter);
+
+            /**
+             * @brief Blocks until every job tracked by the counter has completed
+             *
+             * The calling thread executes pending jobs while waiting.
+             *
+             * @param counter Counter to wait on
+             * @throws Rethrows the first exception raised by a job of the batch
+             */
+            void wait(JobCounter &counter);
+
+            /**
+             * @brief Runs a single pending job on the calling thread, if any
+             *
+             * Lets a thread that waits on something else than a JobCounter keep helping the workers.
+             *
+             * @return true if a job was executed
+             */
+            bool tryRunPendingJob();
+
+            /**
+             * @brief Splits [begin, end) into chunks of grainSize elements and processes them in parallel
+             *
+             * Returns once every chunk is processed. Small ranges are run inline on the calling thread.
+             *
+             * @param begin First index of the range
+             * @param end One past the last index of the range
+             * @param grainSize Maximum number of elements handed to a single job
+             * @param func Callable receiving the [chunkBegin, chunkEnd) bounds of a chunk
+             */
+            void parallelFor(std::size_t begin, std::size_t end, std::size_t grainSize,
+                             const std::function<void(std::size_t, std::size_t)> &func);
+
+            /**
+             * @brief Gets the number of worker threads
+             *
+             * @return Worker count, 0 meaning every job runs on the waiting thread
+             */
+            [[nodiscard]] unsigned int getWorkerCount() const { return static_cast<unsigned int>(m_workers.size()); }
+
+        private:
+            struct QueuedJob {
+                Job job;
+                JobCounter *counter = nullptr;
+            };
+
+            struct WorkQueue {
+                std::mutex mutex;
+                std::deque<QueuedJob> jobs;
+            };
+
+            /**
+             * @brief Index of the queue owned by the calling thread, the submission queue for non-workers
+             */
+            [[nodiscard]] std::size_t currentQueueIndex() const;
+
+            bool popJob(std::size_t queueIndex, QueuedJob &job);
+            bool stealJob(std::size_t thiefIndex, QueuedJob &job);
+            bool tryRunJob(std::size_t queueIndex);
+            static void runJob(QueuedJob &job);
+            void workerLoop(std::size_t queueIndex);
+
+            // Queue 0 receives jobs from non-worker threads, queue i + 1 belongs to worker i
+            std::vector<std::unique_ptr<WorkQueue>> m_queues;
+            std::vector<std::thread> m_workers;
+
+            std::mutex m_sleepMutex;
+            std::condition_variable m_wakeCondition;
+            std::atomic<std::size_t> m_queuedJobs{0};
+            std::atomic<bool> m_running{true};
+    };
+
+}
@@ -23,9 +23,14 @@
 #include "Access.hpp"
 #include "ComponentArray.hpp"
 #include "Coordinator.hpp"
+#include "JobSystem.hpp"
 #include "SingletonComponentMixin.hpp"
+#include <array>
+#include <memory>
+#include <span>
+#include <tuple>
 #include <type_traits>
-#include <unordered_map>
+#include <utility>
 
 namespace parallax::ecs {
     /**
@@ -118,6 +123,33 @@ namespace parallax::ecs {
 				return HasReadAccess<T, Components...>::value;
 			}
 
+			/**
+			* @brief Tuple of the regular (non-singleton) access specifiers, in declaration order
+			*/
+			using RegularAccess = decltype(std::tuple_cat(std::declval<
+				std::conditional_t<IsSingleton<Components>::value, std::tuple<>, std::tuple<Components>>>()...));
+
+			/**
+			* @brief Tuple of typed component arrays, parallel to RegularAccess
+			*/
+			using ComponentArrays = decltype(std::tuple_cat(std::declval<
+				std::conditional_t<IsSingleton<Components>::value, std::tuple<>,
+					std::tuple<std::shared_ptr<ComponentArray<typename Components::ComponentType>>>>>()...));
+
+			static constexpr size_t REGULAR_COMPONENT_COUNT = std::tuple_size_v<RegularAccess>;
+
+			/**
+			* @brief Checks whether T is one of the regular components of the query
+			*
+			* @tparam T The component type to check
+			* @return true if T is queried through Read<T> or Write<T>
+			*/
+			template<typename T>
+			static constexpr bool queriesComponent()
+			{
+				return ((!IsSingleton<Components>::value && std::is_same_v<typename Components::ComponentType, T>) || ...);
+			}
+
 	    public:
 			/**
 			* @brief Constructs a new QuerySystem
@@ -136,8 +168,8 @@ namespace parallax::ecs {
 				// Set system signature based on required components (ignore singleton components)
 				(setComponentSignatureIfRegular<Components>(m_signature), ...);
 
-				// Cache component arrays for faster access (ignore singleton components)
-				(cacheComponentArrayIfRegular<Components>(), ...);
+				// Cache typed component arrays so lookups skip any type dispatch (ignore singleton components)
+				cacheComponentArrays(std::make_index_sequence<REGULAR_COMPONENT_COUNT>{});
 
 				// Initialize singleton components
 				this->initializeSingletonComponents();
@@ -153,20 +185,106 @@ namespace parallax::ecs {
 			template<typename T>
 			std::conditional_t<hasReadAccess<T>(), const T&, T&> getComponent(Entity entity)
 			{
-				const ComponentType typeIndex = getUniqueComponentTypeID<T>();
-				const auto it = m_componentArrays.find(typeIndex);
+				static_assert(queriesComponent<T>(), "Component is not part of this QuerySystem");
+				ComponentArray<T> &componentArray = *std::get<std::shared_ptr<ComponentArray<T>>>(m_componentArrays);
 
-				if (it == m_componentArrays.end())
-					THROW_EXCEPTION(InternalError, "Component array not found");
+				const PagedSparseIndex::Index index = componentArray.getDenseIndex(entity);
+				if (index == PagedSparseIndex::INVALID_INDEX)
+					THROW_EXCEPTION(InternalError, "Entity doesn't have requested component");
+				if constexpr (!hasReadAccess<T>())
+					componentArray.markChangedAt(index);
+				return componentArray.getAt(index);
+			}
 
-				auto componentArray = std::static_pointer_cast<ComponentArray<T>>(it->second);
+			/**
+			* @brief Calls func with every entity of the system and references to its components
+			*
+			* func receives the entity followed by one reference per regular component, in the
+			* order they are listed in the system's template arguments. Read components are passed
+			* as const references and Write components are stamped as changed.
+			*
+			* Iteration walks the dense entity list of the smallest component array, so each
+			* remaining component costs a single sparse lookup and no type dispatch. func must not
+			* add or remove components; record structural changes in a command buffer instead.
+			*
+			* @tparam Func Callable taking (Entity, C1&, const C2&, ...)
+			* @param func Function to call for each entity
+			*/
+			template<typename Func>
+			void forEach(Func func)
+			{
+				static_assert(REGULAR_COMPONENT_COUNT > 0, "forEach requires at least one regular component");
+				forEachImpl(func, std::make_index_sequence<REGULAR_COMPONENT_COUNT>{});
+			}
 
-				if (!componentArray)
-					THROW_EXCEPTION(InternalError, "Failed to cast component array");
+			/**
+			* @brief Iterates over the entities whose components changed after a given tick
+			*
+			* With an empty watch list, an entity is visited if any of the system's
+			* regular components changed.
+			*
+			* @tparam Watched Component types to check for changes
+			* @tparam Func Callable taking an Entity
+			* @param filter Change filter holding the reference tick
+			* @param func Function to call for each changed entity
+			*/
+			template<typename... Watched, typename Func>
+			void each(const ChangedSince<Watched...> filter, Func func)
+			{
+				for (const Entity entity : entities) {
+					if (isChangedSince<Watched...>(entity, filter.tick))
+						func(entity);
+				}
+			}
 
-				if (!componentArray->hasComponent(entity))
-					THROW_EXCEPTION(InternalError, "Entity doesn't have requested component");
-				return componentArray->get(entity);
+			/**
+			* @brief Calls func for every entity of the system, spreading the work across the job system
+			*
+			* The callable runs concurrently on several threads. Components fetched through
+			* getComponent keep their Read/Write constness, and func must only write to the
+			* components of the entity it receives.
+			*
+			* @tparam Func Callable taking an Entity
+			* @param func Function to call for each entity
+			* @param grainSize Number of entities processed by a single job
+			*/
+			template<typename Func>
+			void eachParallel(Func func, const size_t grainSize = DEFAULT_GRAIN_SIZE)
+			{
+				const std::vector<Entity> &dense = entities.getDense();
+				JobSystem::getInstance().parallelFor(0, dense.size(), grainSize,
+					[&dense, &func](const size_t start, const size_t end) {
+						for (size_t i = start; i < end; ++i)
+							func(dense[i]);
+					});
+			}
+
+			/**
+			* @brief Parallel variant of each(ChangedSince, func)
+			*
+			* @tparam Watched Component types to check for changes
+			* @tparam Func Callable taking an Entity
+			* @param filter Change filter holding the reference tick
+			* @param func Function to call for each changed entity
+			* @param grainSize Number of entities processed by a single job
+			*/
+			template<typename... Watched, typename Func>
+			void eachParallel(const ChangedSince<Watched...> filter, Func func, const size_t grainSize = DEFAULT_GRAIN_SIZE)
+			{
+				eachParallel([this, filter, &func](const Entity entity) {
+					if (isChangedSince<Watched...>(entity, filter.tick))
+						func(entity);
+				}, grainSize);
+			}
+
+			/**
+			* @brief Describes the components and singletons this system reads and writes
+			*
+			* @return SystemAccess Access declaration used by the SystemScheduler
+			*/
+			static SystemAccess getAccessDeclaration()
+			{
+				return SystemAccess::from<Components...>();
 			}
 
 			/**
@@ -185,20 +303,35 @@ namespace parallax::ecs {
 
 	    protected:
 	        /**
-	         * @brief Caches component arrays for faster access (only for regular components)
+	         * @brief Checks whether the watched components of an entity changed after a given tick
 	         *
-	         * @tparam ComponentAccessType The component access type to cache
+	         * @tparam Watched Component types to check, every regular component when empty
+	         * @param entity The entity to check
+	         * @param since Reference tick
+	         * @return true if at least one watched component changed after since
 	         */
-			template<typename ComponentAccessType>
-			void cacheComponentArrayIfRegular()
+			template<typename... Watched>
+			bool isChangedSince(const Entity entity, const Tick since) const
 			{
-				if constexpr (!IsSingleton<ComponentAccessType>::value) {
-					using T = typename ComponentAccessType::ComponentType;
-					auto componentArray = coord->getComponentArray<T>();
-					m_componentArrays[getUniqueComponentTypeID<T>()] = componentArray;
+				if constexpr (sizeof...(Watched) > 0) {
+					return ((std::get<std::shared_ptr<ComponentArray<Watched>>>(m_componentArrays)->getChangeTick(entity) > since) || ...);
+				} else {
+					return std::apply([entity, since](const auto &...componentArrays) {
+						return ((componentArrays->getChangeTick(entity) > since) || ...);
+					}, m_componentArrays);
 				}
 			}
 
+	        /**
+	         * @brief Caches the typed component arrays of the regular components
+	         */
+			template<size_t... I>
+			void cacheComponentArrays(std::index_sequence<I...>)
+			{
+				((std::get<I>(m_componentArrays) =
+					coord->getComponentArray<typename std::tuple_element_t<I, RegularAccess>::ComponentType>()), ...);
+			}
+
 	        /**
 	         * @brief Sets the component bit in the system signature (only for regular components)
 	         *
@@ -215,8 +348,53 @@ namespace parallax::ecs {
 			}
 
 		private:
-			// Cache of component arrays for faster access
-			std::unordered_map<ComponentType, std::shared_ptr<IComponentArray>> m_componentArrays;
+			/**
+			* @brief Gets the component at a dense index with the constness of its access specifier
+			*
+			* @tparam I Position of the component in RegularAccess
+			* @param index Dense index of the component in its array
+			* @return Const reference for Read access, mutable reference (stamped as changed) for Write access
+			*/
+			template<size_t I>
+			decltype(auto) accessAt(const size_t index)
+			{
+				auto &componentArray = *std::get<I>(m_componentArrays);
+				if constexpr (std::tuple_element_t<I, RegularAccess>::accessType == AccessType::Read) {
+					return std::as_const(componentArray.getAt(index));
+				} else {
+					componentArray.markChangedAt(index);
+					return (componentArray.getAt(index));
+				}
+			}
+
+			template<typename Func, size_t... I>
+			void forEachImpl(Func &func, std::index_sequence<I...>)
+			{
+				const std::array<std::span<const Entity>, REGULAR_COMPONENT_COUNT> candidates{
+					std::get<I>(m_componentArrays)->entities()...
+				};
+				size_t driver = 0;
+				for (size_t i = 1; i < candidates.size(); ++i) {
+					if (candidates[i].size() < candidates[driver].size())
+						driver = i;
+				}
+
+				const std::span<const Entity> driverEntities = candidates[driver];
+				for (size_t position = 0; position < driverEntities.size(); ++position) {
+					const Entity entity = driverEntities[position];
+					// The driving array already knows its own index, the others need one lookup each
+					const std::array<PagedSparseIndex::Index, REGULAR_COMPONENT_COUNT> indices{
+						(I == driver ? static_cast<PagedSparseIndex::Index>(position)
+									 : std::get<I>(m_componentArrays)->getDenseIndex(entity))...
+					};
+					if (((indices[I] == PagedSparseIndex::INVALID_INDEX) || ...))
+						continue;
+					func(entity, accessAt<I>(indices[I])...);
+				}
+			}
+
+			/// Typed component arrays of the regular components, in declaration order
+			ComponentArrays m_componentArrays;
 
 			/// Component signature defining required components for this system
 			Signature m_signature;
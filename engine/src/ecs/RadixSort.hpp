@@ -0,0 +1,159 @@
+//// RadixSort.hpp ////////////////////////////////////////////////////////////
+//
+// ⢀⢀⢀⣤⣤⣤⡀⢀⢀⢀⢀⢀⢀⢠⣤⡄⢀⢀⢀⢀⣠⣤⣤⣤⣤⣤⣤⣤⣤⣤⡀⢀⢀⢀⢠⣤⣄⢀⢀⢀⢀⢀⢀⢀⣤⣤⢀⢀⢀⢀⢀⢀⢀⢀⣀⣄⢀⢀⢠⣄⣀⢀⢀⢀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⣿⣷⡀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡟⡛⡛⡛⡛⡛⡛⡛⢁⢀⢀⢀⢀⢻⣿⣦⢀⢀⢀⢀⢠⣾⡿⢃⢀⢀⢀⢀⢀⣠⣾⣿⢿⡟⢀⢀⡙⢿⢿⣿⣦⡀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⡛⣿⣷⡀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡙⣿⡷⢀⢀⣰⣿⡟⢁⢀⢀⢀⢀⢀⣾⣿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⣿⡆⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⡈⢿⣷⡄⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣇⣀⣀⣀⣀⣀⣀⣀⢀⢀⢀⢀⢀⢀⢀⡈⢀⢀⣼⣿⢏⢀⢀⢀⢀⢀⢀⣼⣿⡏⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡘⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⡈⢿⣿⡄⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣿⢿⢿⢿⢿⢿⢿⢿⢇⢀⢀⢀⢀⢀⢀⢀⢠⣾⣿⣧⡀⢀⢀⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⡈⢿⣿⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣰⣿⡟⡛⣿⣷⡄⢀⢀⢀⢀⢀⢿⣿⣇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⡈⢿⢀⢀⢸⣿⡇⢀⢀⢀⢀⡛⡟⢁⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⡟⢀⢀⡈⢿⣿⣄⢀⢀⢀⢀⡘⣿⣿⣄⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⢏⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⢀⣀⣀⣀⣀⣀⣀⣀⣀⣀⡀⢀⢀⢀⣠⣾⡿⢃⢀⢀⢀⢀⢀⢻⣿⣧⡀⢀⢀⢀⡈⢻⣿⣷⣦⣄⢀⢀⣠⣤⣶⣿⡿⢋⢀⢀⢀⢀
+// ⢀⢀⢀⢿⢿⢀⢀⢀⢀⢀⢀⢀⢀⢸⢿⢃⢀⢀⢀⢀⢻⢿⢿⢿⢿⢿⢿⢿⢿⢿⢃⢀⢀⢀⢿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⡗⢀⢀⢀⢀⢀⡈⡉⡛⡛⢀⢀⢹⡛⢋⢁⢀⢀⢀⢀⢀⢀
+//
+//  Author:      Parallax Engine Team
+//  Date:        16/10/2026
+//  Description: Header file for the radix sort helpers used to sort groups
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace parallax::ecs {
+
+	/**
+	 * @brief Key types that can be sorted with radix passes
+	 *
+	 * Arithmetic and enum types up to 64 bits can be mapped to an unsigned integer that
+	 * preserves their ordering, which is all an LSD radix sort needs.
+	 */
+	template<typename T>
+	concept RadixSortable = (std::is_arithmetic_v<T> || std::is_enum_v<T>) && sizeof(T) <= 8;
+
+	/**
+	 * @brief Unsigned integer type holding the radix key of T
+	 */
+	template<RadixSortable T>
+	using RadixKey = std::conditional_t<sizeof(T) <= 4, std::uint32_t, std::uint64_t>;
+
+	/**
+	 * @brief Maps a value to an unsigned integer with the same ordering
+	 *
+	 * Signed integers get their sign bit flipped. Floats get their sign bit flipped when
+	 * positive and all their bits flipped when negative, so that comparing the results as
+	 * unsigned integers matches comparing the floats. Both zeros map to the same key.
+	 *
+	 * @tparam T Key type
+	 * @param value Value to map
+	 * @return RadixKey<T> Order-preserving unsigned key
+	 */
+	template<RadixSortable T>
+	constexpr RadixKey<T> toRadixKey(const T value)
+	{
+		if constexpr (std::is_enum_v<T>) {
+			return static_cast<RadixKey<T>>(toRadixKey(static_cast<std::underlying_type_t<T>>(value)));
+		} else if constexpr (std::is_same_v<T, bool>) {
+			return value ? 1 : 0;
+		} else if constexpr (std::is_floating_point_v<T>) {
+			using Bits = std::conditional_t<sizeof(T) == 4, std::uint32_t, std::uint64_t>;
+			constexpr Bits signBit = Bits{1} << (sizeof(T) * 8 - 1);
+			// -0 and +0 compare equal and must get the same key
+			const auto bits = value == T{0} ? Bits{0} : std::bit_cast<Bits>(value);
+			return (bits & signBit) ? static_cast<Bits>(~bits) : static_cast<Bits>(bits | signBit);
+		} else if constexpr (std::is_signed_v<T>) {
+			using Unsigned = std::make_unsigned_t<T>;
+			constexpr auto signBit = static_cast<Unsigned>(Unsigned{1} << (sizeof(T) * 8 - 1));
+			return static_cast<RadixKey<T>>(static_cast<Unsigned>(static_cast<Unsigned>(value) ^ signBit));
+		} else {
+			return static_cast<RadixKey<T>>(value);
+		}
+	}
+
+	/**
+	 * @brief Stable LSD radix sort of (key, payload) pairs, 8 bits per pass
+	 *
+	 * Passes where every key shares the same digit are skipped, so small key ranges
+	 * only pay for the bytes that actually differ.
+	 *
+	 * @tparam Key Unsigned integer key type
+	 * @tparam Payload Value carried along with each key
+	 * @param items Pairs to sort by ascending key
+	 */
+	template<typename Key, typename Payload>
+		requires std::is_unsigned_v<Key>
+	void radixSort(std::vector<std::pair<Key, Payload>>& items)
+	{
+		if (items.size() < 2)
+			return;
+
+		std::vector<std::pair<Key, Payload>> buffer(items.size());
+		auto* source = &items;
+		auto* destination = &buffer;
+
+		for (unsigned int shift = 0; shift < sizeof(Key) * 8; shift += 8) {
+			std::array<size_t, 256> offsets{};
+			for (const auto& item : *source)
+				++offsets[(item.first >> shift) & 0xFF];
+
+			if (offsets[(source->front().first >> shift) & 0xFF] == source->size())
+				continue;
+
+			size_t offset = 0;
+			for (size_t& bucket : offsets) {
+				const size_t count = bucket;
+				bucket = offset;
+				offset += count;
+			}
+			for (const auto& item : *source)
+				(*destination)[offsets[(item.first >> shift) & 0xFF]++] = item;
+			std::swap(source, destination);
+		}
+
+		if (source != &items)
+			items.swap(buffer);
+	}
+
+	/**
+	 * @brief Stable insertion sort that gives up after a number of element moves
+	 *
+	 * Meant for data that is already almost in order, such as keys that barely change
+	 * between two frames. When the budget runs out the items are left as a partially
+	 * sorted permutation of the input.
+	 *
+	 * @tparam Item Element type
+	 * @tparam Less Strict weak ordering on Item
+	 * @param items Elements to sort
+	 * @param moveBudget Maximum number of element shifts
+	 * @param less Comparison function
+	 * @return true if the items are sorted, false if the budget ran out
+	 */
+	template<typename Item, typename Less>
+	bool boundedInsertionSort(std::vector<Item>& items, size_t moveBudget, Less less)
+	{
+		for (size_t i = 1; i < items.size(); ++i) {
+			if (!less(items[i], items[i - 1]))
+				continue;
+
+			Item item = std::move(items[i]);
+			size_t j = i;
+			do {
+				if (moveBudget == 0) {
+					items[j] = std::move(item);
+					return false;
+				}
+				--moveBudget;
+				items[j] = std::move(items[j - 1]);
+				--j;
+			} while (j > 0 && less(item, items[j - 1]));
+			items[j] = std::move(item);
+		}
+		return true;
+	}
+}
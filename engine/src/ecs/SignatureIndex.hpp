@@ -0,0 +1,121 @@
+//// SignatureIndex.hpp ///////////////////////////////////////////////////////
+//
+// ⢀⢀⢀⣤⣤⣤⡀⢀⢀⢀⢀⢀⢀⢠⣤⡄⢀⢀⢀⢀⣠⣤⣤⣤⣤⣤⣤⣤⣤⣤⡀⢀⢀⢀⢠⣤⣄⢀⢀⢀⢀⢀⢀⢀⣤⣤⢀⢀⢀⢀⢀⢀⢀⢀⣀⣄⢀⢀⢠⣄⣀⢀⢀⢀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⣿⣷⡀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡟⡛⡛⡛⡛⡛⡛⡛⢁⢀⢀⢀⢀⢻⣿⣦⢀⢀⢀⢀⢠⣾⡿⢃⢀⢀⢀⢀⢀⣠⣾⣿⢿⡟⢀⢀⡙⢿⢿⣿⣦⡀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⡛⣿⣷⡀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡙⣿⡷⢀⢀⣰⣿⡟⢁⢀⢀⢀⢀⢀⣾⣿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⣿⡆⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⡈⢿⣷⡄⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣇⣀⣀⣀⣀⣀⣀⣀⢀⢀⢀⢀⢀⢀⢀⡈⢀⢀⣼⣿⢏⢀⢀⢀⢀⢀⢀⣼⣿⡏⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡘⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⡈⢿⣿⡄⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣿⢿⢿⢿⢿⢿⢿⢿⢇⢀⢀⢀⢀⢀⢀⢀⢠⣾⣿⣧⡀⢀⢀⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⡈⢿⣿⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣰⣿⡟⡛⣿⣷⡄⢀⢀⢀⢀⢀⢿⣿⣇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⡈⢿⢀⢀⢸⣿⡇⢀⢀⢀⢀⡛⡟⢁⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⡟⢀⢀⡈⢿⣿⣄⢀⢀⢀⢀⡘⣿⣿⣄⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⢏⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⢀⣀⣀⣀⣀⣀⣀⣀⣀⣀⡀⢀⢀⢀⣠⣾⡿⢃⢀⢀⢀⢀⢀⢻⣿⣧⡀⢀⢀⢀⡈⢻⣿⣷⣦⣄⢀⢀⣠⣤⣶⣿⡿⢋⢀⢀⢀⢀
+// ⢀⢀⢀⢿⢿⢀⢀⢀⢀⢀⢀⢀⢀⢸⢿⢃⢀⢀⢀⢀⢻⢿⢿⢿⢿⢿⢿⢿⢿⢿⢃⢀⢀⢀⢿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⡗⢀⢀⢀⢀⢀⡈⡉⡛⡛⢀⢀⢹⡛⢋⢁⢀⢀⢀⢀⢀⢀
+//
+//  Author:      Parallax Engine Team
+//  Date:        16/10/2026
+//  Description: Header file for the component-to-signature inverted index
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "Definitions.hpp"
+
+#include <array>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+namespace parallax::ecs {
+
+	/**
+	 * @brief Number of signature tests performed while dispatching structural changes
+	 *
+	 * Every time a system or group signature is compared against the old and new signature
+	 * of an entity (or of a batch of entities sharing the same change), the matching
+	 * counter is incremented.
+	 */
+	struct SignatureEvaluationStats {
+		std::size_t querySystemEvaluations = 0; ///< Query system signatures tested
+		std::size_t groupEvaluations = 0;       ///< Group signatures tested
+
+		[[nodiscard]] std::size_t total() const { return querySystemEvaluations + groupEvaluations; }
+	};
+
+	/**
+	 * @class SignatureIndex
+	 * @brief Inverted index from component types to the entries whose signature includes them
+	 *
+	 * Used to dispatch an entity signature change only to the systems or groups that reference
+	 * one of the component types that actually changed, instead of testing every registered one.
+	 *
+	 * @tparam Entry Value stored alongside each signature (typically a shared pointer)
+	 */
+	template<typename Entry>
+	class SignatureIndex {
+		public:
+			/**
+			 * @brief Adds an entry to the index
+			 *
+			 * Entries with an empty signature are stored but never visited since no change
+			 * can affect whether an entity matches them.
+			 *
+			 * @param signature Component signature of the entry
+			 * @param entry Value to store
+			 */
+			void insert(const Signature &signature, Entry entry)
+			{
+				const std::size_t index = m_entries.size();
+				m_entries.emplace_back(signature, std::move(entry));
+				for (ComponentType type = 0; type < MAX_COMPONENT_TYPE; ++type) {
+					if (signature.test(type))
+						m_byComponent[type].push_back(index);
+				}
+			}
+
+			/**
+			 * @brief Removes every entry from the index
+			 */
+			void clear()
+			{
+				m_entries.clear();
+				for (auto &entries : m_byComponent)
+					entries.clear();
+			}
+
+			/**
+			 * @brief Calls func(signature, entry) once for every entry referencing a changed component
+			 *
+			 * @tparam Func Callable taking (const Signature &, const Entry &)
+			 * @param changed Component types that changed, usually oldSignature ^ newSignature
+			 * @param func Function to call for each affected entry
+			 */
+			template<typename Func>
+			void forEachReferencing(const Signature &changed, Func &&func) const
+			{
+				Signature visited;
+				for (ComponentType type = 0; type < MAX_COMPONENT_TYPE; ++type) {
+					if (!changed.test(type))
+						continue;
+					for (const std::size_t index : m_byComponent[type]) {
+						const auto &[signature, entry] = m_entries[index];
+						// Entries that also reference an earlier changed type were already visited
+						if ((signature & visited).none())
+							func(signature, entry);
+					}
+					visited.set(type);
+				}
+			}
+
+			/**
+			 * @brief Gets the number of entries in the index
+			 *
+			 * @return std::size_t Entry count
+			 */
+			[[nodiscard]] std::size_t size() const { return m_entries.size(); }
+
+		private:
+			std::vector<std::pair<Signature, Entry>> m_entries;
+			std::array<std::vector<std::size_t>, MAX_COMPONENT_TYPE> m_byComponent{};
+	};
+
+}
@@ -0,0 +1,163 @@
+//// Snapshot.hpp /////////////////////////////////////////////////////////////
+//
+// ⢀⢀⢀⣤⣤⣤⡀⢀⢀⢀⢀⢀⢀⢠⣤⡄⢀⢀⢀⢀⣠⣤⣤⣤⣤⣤⣤⣤⣤⣤⡀⢀⢀⢀⢠⣤⣄⢀⢀⢀⢀⢀⢀⢀⣤⣤⢀⢀⢀⢀⢀⢀⢀⢀⣀⣄⢀⢀⢠⣄⣀⢀⢀⢀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⣿⣷⡀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡟⡛⡛⡛⡛⡛⡛⡛⢁⢀⢀⢀⢀⢻⣿⣦⢀⢀⢀⢀⢠⣾⡿⢃⢀⢀⢀⢀⢀⣠⣾⣿⢿⡟⢀⢀⡙⢿⢿⣿⣦⡀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⡛⣿⣷⡀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡙⣿⡷⢀⢀⣰⣿⡟⢁⢀⢀⢀⢀⢀⣾⣿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⣿⡆⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⡈⢿⣷⡄⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣇⣀⣀⣀⣀⣀⣀⣀⢀⢀⢀⢀⢀⢀⢀⡈⢀⢀⣼⣿⢏⢀⢀⢀⢀⢀⢀⣼⣿⡏⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡘⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⡈⢿⣿⡄⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣿⢿⢿⢿⢿⢿⢿⢿⢇⢀⢀⢀⢀⢀⢀⢀⢠⣾⣿⣧⡀⢀⢀⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⡈⢿⣿⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣰⣿⡟⡛⣿⣷⡄⢀⢀⢀⢀⢀⢿⣿⣇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⡈⢿⢀⢀⢸⣿⡇⢀⢀⢀⢀⡛⡟⢁⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⡟⢀⢀⡈⢿⣿⣄⢀⢀⢀⢀⡘⣿⣿⣄⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⢏⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⢀⣀⣀⣀⣀⣀⣀⣀⣀⣀⡀⢀⢀⢀⣠⣾⡿⢃⢀⢀⢀⢀⢀⢻⣿⣧⡀⢀⢀⢀⡈⢻⣿⣷⣦⣄⢀⢀⣠⣤⣶⣿⡿⢋⢀⢀⢀⢀
+// ⢀⢀⢀⢿⢿⢀⢀⢀⢀⢀⢀⢀⢀⢸⢿⢃⢀⢀⢀⢀⢻⢿⢿⢿⢿⢿⢿⢿⢿⢿⢃⢀⢀⢀⢿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⡗⢀⢀⢀⢀⢀⡈⡉⡛⡛⢀⢀⢹⡛⢋⢁⢀⢀⢀⢀⢀⢀
+//
+//  Author:      Parallax Engine Team
+//  Date:        16/10/2026
+//  Description: Header file for the binary world snapshot streams
+//
+///////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include "Definitions.hpp"
+#include "ECSExceptions.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+namespace parallax::ecs {
+
+	/**
+	 * @brief Tag written at the start of every world snapshot ("PXSN")
+	 */
+	constexpr std::uint32_t SNAPSHOT_MAGIC = 0x4E535850;
+
+	/**
+	 * @brief Format version, bumped whenever the snapshot layout changes
+	 */
+	constexpr std::uint32_t SNAPSHOT_VERSION = 2;
+
+	/**
+	 * @brief Binary image of an ECS world produced by Coordinator::snapshot()
+	 *
+	 * The buffer holds the entity manager state followed by every component array as
+	 * contiguous blocks. It can be kept in memory (play mode, undo) or written to disk as is.
+	 */
+	struct WorldSnapshot {
+		std::vector<std::byte> data;
+	};
+
+	/**
+	 * @class SnapshotWriter
+	 * @brief Appends plain values and contiguous blocks to a snapshot buffer
+	 */
+	class SnapshotWriter {
+		public:
+			explicit SnapshotWriter(std::vector<std::byte> &buffer) : m_buffer(buffer) {}
+
+			void writeBytes(const void *data, const std::size_t size)
+			{
+				if (size == 0)
+					return;
+				const std::size_t offset = m_buffer.size();
+				m_buffer.resize(offset + size);
+				std::memcpy(m_buffer.data() + offset, data, size);
+			}
+
+			template<typename T>
+			requires std::is_trivially_copyable_v<T>
+			void write(const T &value)
+			{
+				writeBytes(&value, sizeof(T));
+			}
+
+			/**
+			 * @brief Writes the element count followed by the elements in a single copy
+			 */
+			template<typename T>
+			requires std::is_trivially_copyable_v<T>
+			void writeBlock(const std::span<const T> values)
+			{
+				write<std::uint64_t>(values.size());
+				writeBytes(values.data(), values.size_bytes());
+			}
+
+			/**
+			 * @brief Grows the buffer ahead of a sequence of writes
+			 */
+			void reserve(const std::size_t additionalBytes)
+			{
+				m_buffer.reserve(m_buffer.size() + additionalBytes);
+			}
+
+		private:
+			std::vector<std::byte> &m_buffer;
+	};
+
+	/**
+	 * @class SnapshotReader
+	 * @brief Reads back what a SnapshotWriter produced, in the same order
+	 *
+	 * Every read is bounds-checked, a truncated or foreign buffer throws InvalidSnapshot.
+	 */
+	class SnapshotReader {
+		public:
+			explicit SnapshotReader(const std::span<const std::byte> data) : m_data(data) {}
+
+			void readBytes(void *destination, const std::size_t size)
+			{
+				if (size > m_data.size() - m_offset)
+					THROW_EXCEPTION(InvalidSnapshot, "unexpected end of data");
+				if (size == 0)
+					return;
+				std::memcpy(destination, m_data.data() + m_offset, size);
+				m_offset += size;
+			}
+
+			template<typename T>
+			requires std::is_trivially_copyable_v<T>
+			T read()
+			{
+				T value;
+				readBytes(&value, sizeof(T));
+				return value;
+			}
+
+			/**
+			 * @brief Reads a block written by SnapshotWriter::writeBlock, replacing the content of values
+			 */
+			template<typename T>
+			requires std::is_trivially_copyable_v<T>
+			void readBlock(std::vector<T> &values)
+			{
+				const auto count = read<std::uint64_t>();
+				if (count > (m_data.size() - m_offset) / sizeof(T))
+					THROW_EXCEPTION(InvalidSnapshot, "block larger than the remaining data");
+				values.resize(static_cast<std::size_t>(count));
+				readBytes(values.data(), values.size() * sizeof(T));
+			}
+
+			[[nodiscard]] bool atEnd() const { return m_offset == m_data.size(); }
+
+		private:
+			std::span<const std::byte> m_data;
+			std::size_t m_offset = 0;
+	};
+
+	/**
+	 * @brief Per-component callbacks used to snapshot component types that are not trivially copyable
+	 *
+	 * Trivially copyable components are copied with a single memcpy per array and never need one.
+	 *
+	 * @tparam T Component type
+	 */
+	template<typename T>
+	struct ComponentSerializer {
+		std::function<void(SnapshotWriter &, const T &)> write;
+		std::function<T(SnapshotReader &)> read;
+	};
+
+}
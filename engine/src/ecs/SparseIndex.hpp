@@ -0,0 +1,184 @@
+//// SparseIndex.hpp //////////////////////////////////////////////////////////
+//
+// ⢀⢀⢀⣤⣤⣤⡀⢀⢀⢀⢀⢀⢀⢠⣤⡄⢀⢀⢀⢀⣠⣤⣤⣤⣤⣤⣤⣤⣤⣤⡀⢀⢀⢀⢠⣤⣄⢀⢀⢀⢀⢀⢀⢀⣤⣤⢀⢀⢀⢀⢀⢀⢀⢀⣀⣄⢀⢀⢠⣄⣀⢀⢀⢀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⣿⣷⡀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡟⡛⡛⡛⡛⡛⡛⡛⢁⢀⢀⢀⢀⢻⣿⣦⢀⢀⢀⢀⢠⣾⡿⢃⢀⢀⢀⢀⢀⣠⣾⣿⢿⡟⢀⢀⡙⢿⢿⣿⣦⡀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⡛⣿⣷⡀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡙⣿⡷⢀⢀⣰⣿⡟⢁⢀⢀⢀⢀⢀⣾⣿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⣿⡆⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⡈⢿⣷⡄⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣇⣀⣀⣀⣀⣀⣀⣀⢀⢀⢀⢀⢀⢀⢀⡈⢀⢀⣼⣿⢏⢀⢀⢀⢀⢀⢀⣼⣿⡏⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡘⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⡈⢿⣿⡄⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣿⢿⢿⢿⢿⢿⢿⢿⢇⢀⢀⢀⢀⢀⢀⢀⢠⣾⣿⣧⡀⢀⢀⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⡈⢿⣿⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣰⣿⡟⡛⣿⣷⡄⢀⢀⢀⢀⢀⢿⣿⣇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⡈⢿⢀⢀⢸⣿⡇⢀⢀⢀⢀⡛⡟⢁⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⡟⢀⢀⡈⢿⣿⣄⢀⢀⢀⢀⡘⣿⣿⣄⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⢏⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⢀⣀⣀⣀⣀⣀⣀⣀⣀⣀⡀⢀⢀⢀⣠⣾⡿⢃⢀⢀⢀⢀⢀⢻⣿⣧⡀⢀⢀⢀⡈⢻⣿⣷⣦⣄⢀⢀⣠⣤⣶⣿⡿⢋⢀⢀⢀⢀
+// ⢀⢀⢀⢿⢿⢀⢀⢀⢀⢀⢀⢀⢀⢸⢿⢃⢀⢀⢀⢀⢻⢿⢿⢿⢿⢿⢿⢿⢿⢿⢃⢀⢀⢀⢿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⡗⢀⢀⢀⢀⢀⡈⡉⡛⡛⢀⢀⢹⡛⢋⢁⢀⢀⢀⢀⢀⢀
+//
+//  Author:      Parallax Engine Team
+//  Date:        16/10/2026
+//  Description: Header file for the paged sparse index of component arrays
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "Definitions.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <vector>
+
+namespace parallax::ecs {
+
+    /**
+     * @class PagedSparseIndex
+     * @brief Maps entity IDs to dense indices using fixed-size pages allocated on demand
+     *
+     * A flat sparse array costs one slot per entity ID up to the highest ID seen, even for a
+     * component held by a handful of entities. Here the ID space is split in pages of PAGE_SIZE
+     * 32-bit slots; a page only exists while at least one of its entities is mapped.
+     */
+    class PagedSparseIndex {
+        public:
+            using Index = std::uint32_t;
+
+            /**
+             * @brief Value returned for entities that are not mapped
+             */
+            static constexpr Index INVALID_INDEX = std::numeric_limits<Index>::max();
+
+            /**
+             * @brief Number of entity IDs covered by one page, must be a power of two
+             */
+            static constexpr std::size_t PAGE_SIZE = 4096;
+            static_assert((PAGE_SIZE & (PAGE_SIZE - 1)) == 0, "PAGE_SIZE must be a power of two");
+            static_assert(MAX_ENTITIES < INVALID_INDEX, "Dense indices must fit in 32 bits");
+
+            /**
+             * @brief Gets the dense index of an entity
+             *
+             * @param entity The entity to look up
+             * @return Index The dense index, or INVALID_INDEX if the entity is not mapped
+             */
+            [[nodiscard]] Index get(const Entity entity) const
+            {
+                const std::size_t page = pageOf(entity);
+                if (page >= m_pages.size() || !m_pages[page])
+                    return INVALID_INDEX;
+                return m_pages[page][offsetOf(entity)];
+            }
+
+            /**
+             * @brief Checks whether an entity is mapped
+             *
+             * @param entity The entity to look up
+             * @return true if the entity has a dense index
+             */
+            [[nodiscard]] bool contains(const Entity entity) const
+            {
+                return get(entity) != INVALID_INDEX;
+            }
+
+            /**
+             * @brief Gets the dense index of an entity known to be mapped, without bounds checks
+             *
+             * @param entity A mapped entity
+             * @return Index The dense index of the entity
+             */
+            [[nodiscard]] Index operator[](const Entity entity) const
+            {
+                return m_pages[pageOf(entity)][offsetOf(entity)];
+            }
+
+            /**
+             * @brief Maps an entity to a dense index, allocating its page if needed
+             *
+             * @param entity The entity to map
+             * @param index The dense index of the entity
+             */
+            void set(const Entity entity, const std::size_t index)
+            {
+                const std::size_t page = pageOf(entity);
+                if (page >= m_pages.size()) {
+                    m_pages.resize(page + 1);
+                    m_pageCounts.resize(page + 1, 0);
+                }
+                if (!m_pages[page]) {
+                    m_pages[page] = std::make_unique_for_overwrite<Index[]>(PAGE_SIZE);
+                    std::fill_n(m_pages[page].get(), PAGE_SIZE, INVALID_INDEX);
+                    ++m_allocatedPages;
+                }
+
+                Index &slot = m_pages[page][offsetOf(entity)];
+                if (slot == INVALID_INDEX)
+                    ++m_pageCounts[page];
+                slot = static_cast<Index>(index);
+            }
+
+            /**
+             * @brief Unmaps an entity, releasing its page once it no longer maps any entity
+             *
+             * @param entity The entity to unmap
+             */
+            void erase(const Entity entity)
+            {
+                const std::size_t page = pageOf(entity);
+                if (page >= m_pages.size() || !m_pages[page])
+                    return;
+
+                Index &slot = m_pages[page][offsetOf(entity)];
+                if (slot == INVALID_INDEX)
+                    return;
+                slot = INVALID_INDEX;
+                if (--m_pageCounts[page] == 0) {
+                    m_pages[page].reset();
+                    --m_allocatedPages;
+                }
+            }
+
+            /**
+             * @brief Grows the page table so that entities up to maxEntity can be mapped without reallocating it
+             *
+             * @param maxEntity Highest entity ID about to be mapped
+             */
+            void reserve(const Entity maxEntity)
+            {
+                const std::size_t pageCount = pageOf(maxEntity) + 1;
+                if (pageCount > m_pages.size()) {
+                    m_pages.resize(pageCount);
+                    m_pageCounts.resize(pageCount, 0);
+                }
+            }
+
+            /**
+             * @brief Gets the number of pages currently allocated
+             */
+            [[nodiscard]] std::size_t allocatedPages() const { return m_allocatedPages; }
+
+            /**
+             * @brief Gets the memory held by the allocated pages, in bytes
+             */
+            [[nodiscard]] std::size_t pageMemory() const
+            {
+                return m_allocatedPages * PAGE_SIZE * sizeof(Index);
+            }
+
+            /**
+             * @brief Gets the memory held by the page table and the per-page entity counts, in bytes
+             */
+            [[nodiscard]] std::size_t overheadMemory() const
+            {
+                return m_pages.capacity() * sizeof(std::unique_ptr<Index[]>)
+                     + m_pageCounts.capacity() * sizeof(std::uint32_t);
+            }
+
+        private:
+            static constexpr std::size_t pageOf(const Entity entity) { return entity / PAGE_SIZE; }
+            static constexpr std::size_t offsetOf(const Entity entity) { return entity & (PAGE_SIZE - 1); }
+
+            std::vector<std::unique_ptr<Index[]>> m_pages;
+            // Number of mapped entities in each page
+            std::vector<std::uint32_t> m_pageCounts;
+            std::size_t m_allocatedPages = 0;
+    };
+
+}
@@ -34,6 +34,14 @@ namespace parallax::ecs {
         dense.push_back(entity);
     }
 
+    void SparseSet::insert(const std::span<const Entity> entities)
+    {
+        dense.reserve(dense.size() + entities.size());
+        sparse.reserve(sparse.size() + entities.size());
+        for (const Entity entity : entities)
+            insert(entity);
+    }
+
     void SparseSet::erase(Entity entity)
     {
         if (!contains(entity))
@@ -52,20 +60,68 @@ namespace parallax::ecs {
         sparse.erase(entity);
     }
 
+    void SystemManager::refreshQuerySystemIndex() const
+    {
+        if (!m_querySystemIndexDirty)
+            return;
+
+        m_querySystemIndex.clear();
+        for (const auto& system : std::ranges::views::values(m_querySystems))
+            m_querySystemIndex.insert(system->getSignature(), system);
+        m_querySystemIndexDirty = false;
+    }
+
+    std::shared_ptr<EntityQuery> SystemManager::getQuery(const Signature required, const Signature excluded) const
+    {
+        const auto it = m_queries.find({required, excluded});
+        return it != m_queries.end() ? it->second : nullptr;
+    }
+
+    std::shared_ptr<EntityQuery> SystemManager::registerQuery(const Signature required, const Signature excluded,
+                                                              const std::span<const Entity> matchingEntities)
+    {
+        // Entities without any component are never dispatched, an empty requirement could not be kept up to date
+        if (required.none())
+            THROW_EXCEPTION(InvalidQuerySignature);
+
+        auto [it, inserted] = m_queries.try_emplace({required, excluded}, nullptr);
+        if (inserted) {
+            it->second = std::make_shared<EntityQuery>(required, excluded);
+            it->second->m_entities.insert(matchingEntities);
+            m_queryIndex.insert(required | excluded, it->second);
+        }
+        return it->second;
+    }
+
+    void SystemManager::clearEntities() const
+    {
+        for (const auto& system : std::ranges::views::values(m_querySystems))
+            system->entities.clear();
+        for (const auto& query : std::ranges::views::values(m_queries))
+            query->m_entities.clear();
+    }
+
     void SystemManager::entityDestroyed(const Entity entity, const Signature signature) const
     {
-        for (const auto& system : std::ranges::views::values(m_querySystems)) {
-            if (const Signature &systemSignature = system->getSignature(); (signature & systemSignature) == systemSignature)
+        refreshQuerySystemIndex();
+        m_querySystemIndex.forEachReferencing(signature, [&](const Signature &systemSignature, const auto &system) {
+            ++m_signatureEvaluations;
+            if ((signature & systemSignature) == systemSignature)
                 system->entities.erase(entity);
-        }
+        });
+        m_queryIndex.forEachReferencing(signature, [&](const Signature &, const auto &query) {
+            if (query->matches(signature))
+                query->m_entities.erase(entity);
+        });
     }
 
     void SystemManager::entitySignatureChanged(const Entity entity,
                                                  const Signature oldSignature,
                                                  const Signature newSignature)
     {
-        for (const auto& system : std::ranges::views::values(m_querySystems)) {
-            const Signature systemSignature = system->getSignature();
+        refreshQuerySystemIndex();
+        m_querySystemIndex.forEachReferencing(oldSignature ^ newSignature, [&](const Signature &systemSignature, const auto &system) {
+            ++m_signatureEvaluations;
             // Check if entity qualifies now but did not qualify before.
             if (((oldSignature & systemSignature) != systemSignature) &&
                 ((newSignature & systemSignature) == systemSignature)) {
@@ -76,6 +132,43 @@ namespace parallax::ecs {
                      ((newSignature & systemSignature) != systemSignature)) {
                 system->entities.erase(entity);
             }
-        }
+        });
+        m_queryIndex.forEachReferencing(oldSignature ^ newSignature, [&](const Signature &, const auto &query) {
+            const bool matchedBefore = query->matches(oldSignature);
+            const bool matchesNow = query->matches(newSignature);
+            if (!matchedBefore && matchesNow)
+                query->m_entities.insert(entity);
+            else if (matchedBefore && !matchesNow)
+                query->m_entities.erase(entity);
+        });
+    }
+
+    void SystemManager::entitiesSignatureChanged(const std::span<const Entity> entities,
+                                                   const Signature oldSignature,
+                                                   const Signature newSignature)
+    {
+        refreshQuerySystemIndex();
+        m_querySystemIndex.forEachReferencing(oldSignature ^ newSignature, [&](const Signature &systemSignature, const auto &system) {
+            ++m_signatureEvaluations;
+            if (((oldSignature & systemSignature) != systemSignature) &&
+                ((newSignature & systemSignature) == systemSignature)) {
+                system->entities.insert(entities);
+            }
+            else if (((oldSignature & systemSignature) == systemSignature) &&
+                     ((newSignature & systemSignature) != systemSignature)) {
+                for (const Entity entity : entities)
+                    system->entities.erase(entity);
+            }
+        });
+        m_queryIndex.forEachReferencing(oldSignature ^ newSignature, [&](const Signature &, const auto &query) {
+            const bool matchedBefore = query->matches(oldSignature);
+            const bool matchesNow = query->matches(newSignature);
+            if (!matchedBefore && matchesNow)
+                query->m_entities.insert(entities);
+            else if (matchedBefore && !matchesNow) {
+                for (const Entity entity : entities)
+                    query->m_entities.erase(entity);
+            }
+        });
     }
 }
@@ -21,10 +21,12 @@
 #include <unordered_map>
 #include <typeindex>
 #include <memory>
+#include <span>
 
 #include "Definitions.hpp"
 #include "Logger.hpp"
 #include "ECSExceptions.hpp"
+#include "SignatureIndex.hpp"
 
 namespace parallax::ecs {
     class Coordinator;
@@ -50,6 +52,13 @@ namespace parallax::ecs {
 	         */
 	        void insert(Entity entity);
 
+	        /**
+	         * @brief Insert several entities into the set, growing the storage once
+	         *
+	         * @param entities The entities to insert
+	         */
+	        void insert(std::span<const Entity> entities);
+
 	        /**
 	         * @brief Remove an entity from the set
 	         *
@@ -64,6 +73,15 @@ namespace parallax::ecs {
 	         */
 	        bool empty() const { return dense.empty(); }
 
+	        /**
+	         * @brief Remove every entity from the set
+	         */
+	        void clear()
+	        {
+	            dense.clear();
+	            sparse.clear();
+	        }
+
 	        /**
 	         * @brief Check if an entity exists in the set
 	         *
@@ -154,6 +172,51 @@ namespace parallax::ecs {
         ~AGroupSystem() override = default;
     };
 
+    /**
+     * @class EntityQuery
+     * @brief Cached result of an ad hoc entity query
+     *
+     * Holds every entity whose signature contains the required components and none of the
+     * excluded ones. The SystemManager keeps it up to date on signature changes, so reading
+     * the result does not scan the living entities.
+     */
+    class EntityQuery {
+    public:
+        EntityQuery(const Signature required, const Signature excluded)
+            : m_required(required), m_excluded(excluded) {}
+
+        /**
+         * @brief Checks whether a signature satisfies the query
+         *
+         * @param signature The signature to test
+         * @return true if all required components are present and no excluded one is
+         */
+        [[nodiscard]] bool matches(const Signature signature) const
+        {
+            return (signature & m_required) == m_required && (signature & m_excluded).none();
+        }
+
+        [[nodiscard]] Signature getRequired() const { return m_required; }
+        [[nodiscard]] Signature getExcluded() const { return m_excluded; }
+
+        /**
+         * @brief Entities currently matching the query
+         *
+         * @return Span over the cached entities, invalidated by the next structural change
+         */
+        [[nodiscard]] std::span<const Entity> entities() const { return m_entities.getDense(); }
+
+        [[nodiscard]] size_t size() const { return m_entities.size(); }
+        [[nodiscard]] bool contains(const Entity entity) const { return m_entities.contains(entity); }
+
+    private:
+        friend class SystemManager;
+
+        Signature m_required;
+        Signature m_excluded;
+        SparseSet m_entities;
+    };
+
     /**
     * @class SystemManager
     *
@@ -161,6 +224,8 @@ namespace parallax::ecs {
     *
     * This class is responsible for registering systems, setting their signatures,
     * and updating systems with relevant entities based on entity signature changes.
+    * Query systems are indexed by the component types of their signature, so a signature
+    * change is only tested against the systems that reference one of the changed components.
     */
     class SystemManager {
         public:
@@ -184,6 +249,7 @@ namespace parallax::ecs {
 
                 auto system = std::make_shared<T>(std::forward<Args>(args)...);
                 m_querySystems.insert({typeName, system});
+                m_querySystemIndexDirty = true;
                 return system;
             }
 
@@ -225,8 +291,38 @@ namespace parallax::ecs {
                 std::type_index typeName(typeid(T));
 
                 m_signatures.insert({typeName, signature});
+                m_querySystemIndexDirty = true;
             }
 
+            /**
+            * @brief Gets the cached query for a required/excluded signature pair.
+            *
+            * @param required - Components the entities must have.
+            * @param excluded - Components the entities must not have.
+            * @return std::shared_ptr<EntityQuery> - The cached query, or nullptr if none was registered.
+            */
+            [[nodiscard]] std::shared_ptr<EntityQuery> getQuery(Signature required, Signature excluded) const;
+
+            /**
+            * @brief Caches a query so that its result is maintained on every signature change.
+            *
+            * Returns the existing query if one was already registered for the same signatures.
+            * @param required - Components the entities must have, at least one.
+            * @param excluded - Components the entities must not have.
+            * @param matchingEntities - Entities currently matching the query, used to seed a new cache.
+            * @return std::shared_ptr<EntityQuery> - The cached query.
+            */
+            std::shared_ptr<EntityQuery> registerQuery(Signature required, Signature excluded,
+                                                       std::span<const Entity> matchingEntities);
+
+            /**
+            * @brief Empties the entity sets of every query system and cached query.
+            *
+            * Used when the world is replaced wholesale, the entities are then dispatched again
+            * with entitiesSignatureChanged from an empty signature.
+            */
+            void clearEntities() const;
+
             /**
             * @brief Handles the destruction of an entity by removing it from all systems.
             *
@@ -244,7 +340,36 @@ namespace parallax::ecs {
             * @param newSignature - The new signature of the entity.
             */
             void entitySignatureChanged(Entity entity, Signature oldSignature, Signature newSignature);
+
+            /**
+            * @brief Updates the systems with a batch of entities going through the same signature change.
+            *
+            * Each system signature is tested once for the whole batch.
+            * @param entities - The IDs of the entities whose signature has changed.
+            * @param oldSignature - The old signature shared by the entities.
+            * @param newSignature - The new signature shared by the entities.
+            */
+            void entitiesSignatureChanged(std::span<const Entity> entities, Signature oldSignature, Signature newSignature);
+
+            /**
+            * @brief Gets the number of system signatures tested since the last reset.
+            *
+            * @return std::size_t Signature evaluation count.
+            */
+            [[nodiscard]] std::size_t getSignatureEvaluationCount() const { return m_signatureEvaluations; }
+
+            /**
+            * @brief Resets the signature evaluation counter, typically once per frame.
+            */
+            void resetSignatureEvaluationCount() { m_signatureEvaluations = 0; }
         private:
+            /**
+            * @brief Rebuilds the query system index if a system or signature was registered since the last dispatch.
+            *
+            * Done lazily because systems may finish setting up their signature after registration.
+            */
+            void refreshQuerySystemIndex() const;
+
 	        /**
 	         * @brief Map of system type to component signature
 	         */
@@ -259,5 +384,37 @@ namespace parallax::ecs {
 	         * @brief Map of group system type to system instance
 	         */
 	        std::unordered_map<std::type_index, std::shared_ptr<AGroupSystem>> m_groupSystems{};
+
+	        /**
+	         * @brief Query systems indexed by the component types of their signature
+	         */
+	        mutable SignatureIndex<std::shared_ptr<AQuerySystem>> m_querySystemIndex{};
+	        mutable bool m_querySystemIndexDirty = false;
+
+	        struct QueryKey {
+	            Signature required;
+	            Signature excluded;
+
+	            bool operator==(const QueryKey &other) const = default;
+	        };
+
+	        struct QueryKeyHash {
+	            size_t operator()(const QueryKey &key) const
+	            {
+	                const std::hash<Signature> hash;
+	                return hash(key.required) ^ (hash(key.excluded) * 31);
+	            }
+	        };
+
+	        /**
+	         * @brief Cached queries by required/excluded signature, and indexed by every component they reference
+	         */
+	        std::unordered_map<QueryKey, std::shared_ptr<EntityQuery>, QueryKeyHash> m_queries{};
+	        SignatureIndex<std::shared_ptr<EntityQuery>> m_queryIndex{};
+
+	        /**
+	         * @brief Number of system signatures tested since the last reset
+	         */
+	        mutable std::size_t m_signatureEvaluations = 0;
     };
 }
@@ -0,0 +1,233 @@
+//// SystemScheduler.cpp //////////////////////////////////////////////////////
+//
+// ⢀⢀⢀⣤⣤⣤⡀⢀⢀⢀⢀⢀⢀⢠⣤⡄⢀⢀⢀⢀⣠⣤⣤⣤⣤⣤⣤⣤⣤⣤⡀⢀⢀⢀⢠⣤⣄⢀⢀⢀⢀⢀⢀⢀⣤⣤⢀⢀⢀⢀⢀⢀⢀⢀⣀⣄⢀⢀⢠⣄⣀⢀⢀⢀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⣿⣷⡀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡟⡛⡛⡛⡛⡛⡛⡛⢁⢀⢀⢀⢀⢻⣿⣦⢀⢀⢀⢀⢠⣾⡿⢃⢀⢀⢀⢀⢀⣠⣾⣿⢿⡟⢀⢀⡙⢿⢿⣿⣦⡀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⡛⣿⣷⡀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡙⣿⡷⢀⢀⣰⣿⡟⢁⢀⢀⢀⢀⢀⣾⣿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⣿⡆⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⡈⢿⣷⡄⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣇⣀⣀⣀⣀⣀⣀⣀⢀⢀⢀⢀⢀⢀⢀⡈⢀⢀⣼⣿⢏⢀⢀⢀⢀⢀⢀⣼⣿⡏⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡘⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⡈⢿⣿⡄⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣿⢿⢿⢿⢿⢿⢿⢿⢇⢀⢀⢀⢀⢀⢀⢀⢠⣾⣿⣧⡀⢀⢀⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⡈⢿⣿⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣰⣿⡟⡛⣿⣷⡄⢀⢀⢀⢀⢀⢿⣿⣇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⡈⢿⢀⢀⢸⣿⡇⢀⢀⢀⢀⡛⡟⢁⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⡟⢀⢀⡈⢿⣿⣄⢀⢀⢀⢀⡘⣿⣿⣄⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⢏⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⢀⣀⣀⣀⣀⣀⣀⣀⣀⣀⡀⢀⢀⢀⣠⣾⡿⢃⢀⢀⢀⢀⢀⢻⣿⣧⡀⢀⢀⢀⡈⢻⣿⣷⣦⣄⢀⢀⣠⣤⣶⣿⡿⢋⢀⢀⢀⢀
+// ⢀⢀⢀⢿⢿⢀⢀⢀⢀⢀⢀⢀⢀⢸⢿⢃⢀⢀⢀⢀⢻⢿⢿⢿⢿⢿⢿⢿⢿⢿⢃⢀⢀⢀⢿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⡗⢀⢀⢀⢀⢀⡈⡉⡛⡛⢀⢀⢹⡛⢋⢁⢀⢀⢀⢀⢀⢀
+//
+//  Author:      Parallax Engine Team
+//  Date:        16/10/2026
+//  Description: Source file for the access-driven system scheduler
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include "SystemScheduler.hpp"
+#include "ECSExceptions.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <mutex>
+#include <optional>
+#include <sstream>
+#include <thread>
+
+namespace parallax::ecs {
+
+    SystemScheduler::SystemId SystemScheduler::addSystem(const std::string &name, const SystemAccess &access,
+                                                         std::function<void()> update, const SystemThread thread)
+    {
+        m_nodes.push_back({name, access, std::move(update), thread, {}, {}, 0});
+        m_dirty = true;
+        return m_nodes.size() - 1;
+    }
+
+    void SystemScheduler::addDependency(const SystemId before, const SystemId after)
+    {
+        if (before >= m_nodes.size())
+            THROW_EXCEPTION(OutOfRange, before);
+        if (after >= m_nodes.size())
+            THROW_EXCEPTION(OutOfRange, after);
+        if (before >= after)
+            THROW_EXCEPTION(InvalidSystemDependency, m_nodes[before].name, m_nodes[after].name);
+
+        m_explicitDependencies.emplace_back(before, after);
+        m_dirty = true;
+    }
+
+    void SystemScheduler::build()
+    {
+        const std::size_t count = m_nodes.size();
+
+        // Edges only go from a system to a later one, so the registration order is a topological order
+        std::vector<std::vector<bool>> edges(count, std::vector<bool>(count, false));
+        for (SystemId after = 0; after < count; ++after) {
+            for (SystemId before = 0; before < after; ++before) {
+                if (m_nodes[before].access.conflictsWith(m_nodes[after].access))
+                    edges[before][after] = true;
+            }
+        }
+        for (const auto &[before, after] : m_explicitDependencies)
+            edges[before][after] = true;
+
+        // ancestors[i][j] is true when system j must complete before system i starts
+        std::vector<std::vector<bool>> ancestors(count, std::vector<bool>(count, false));
+        for (SystemId after = 0; after < count; ++after) {
+            for (SystemId before = 0; before < after; ++before) {
+                if (!edges[before][after])
+                    continue;
+                ancestors[after][before] = true;
+                for (SystemId k = 0; k < before; ++k)
+                    if (ancestors[before][k])
+                        ancestors[after][k] = true;
+            }
+        }
+
+        for (Node &node : m_nodes) {
+            node.predecessors.clear();
+            node.successors.clear();
+            node.stage = 0;
+        }
+
+        // Keep only the direct dependencies: an edge is redundant if another dependency already implies it
+        for (SystemId after = 0; after < count; ++after) {
+            for (SystemId before = 0; before < after; ++before) {
+                if (!edges[before][after])
+                    continue;
+                bool redundant = false;
+                for (SystemId middle = before + 1; middle < after && !redundant; ++middle)
+                    redundant = edges[middle][after] && ancestors[middle][before];
+                if (redundant)
+                    continue;
+                m_nodes[after].predecessors.push_back(before);
+                m_nodes[before].successors.push_back(after);
+                m_nodes[after].stage = std::max(m_nodes[after].stage, m_nodes[before].stage + 1);
+            }
+        }
+
+        m_stages.clear();
+        for (SystemId id = 0; id < count; ++id) {
+            if (m_stages.size() <= m_nodes[id].stage)
+                m_stages.resize(m_nodes[id].stage + 1);
+            m_stages[m_nodes[id].stage].push_back(id);
+        }
+        m_dirty = false;
+    }
+
+    const std::vector<std::vector<SystemScheduler::SystemId>> &SystemScheduler::getStages()
+    {
+        if (m_dirty)
+            build();
+        return m_stages;
+    }
+
+    const std::vector<SystemScheduler::SystemId> &SystemScheduler::getDependencies(const SystemId id)
+    {
+        if (m_dirty)
+            build();
+        return m_nodes.at(id).predecessors;
+    }
+
+    std::string SystemScheduler::describeSchedule()
+    {
+        if (m_dirty)
+            build();
+
+        std::ostringstream out;
+        out << "Frame schedule: " << m_nodes.size() << " systems in " << m_stages.size() << " stages\n";
+        for (std::size_t stage = 0; stage < m_stages.size(); ++stage) {
+            out << "  Stage " << stage << ":";
+            for (const SystemId id : m_stages[stage]) {
+                out << " " << m_nodes[id].name;
+                if (m_nodes[id].thread == SystemThread::Main)
+                    out << " [main thread]";
+            }
+            out << "\n";
+        }
+        for (const Node &node : m_nodes) {
+            if (node.predecessors.empty())
+                continue;
+            out << "  " << node.name << " waits on";
+            for (const SystemId id : node.predecessors)
+                out << " " << m_nodes[id].name;
+            out << "\n";
+        }
+        return out.str();
+    }
+
+    void SystemScheduler::run(JobSystem &jobSystem)
+    {
+        if (m_dirty)
+            build();
+
+        const std::size_t count = m_nodes.size();
+        if (count == 0)
+            return;
+
+        const auto remaining = std::make_unique<std::atomic<std::size_t>[]>(count);
+        std::size_t mainThreadSystems = 0;
+        for (SystemId id = 0; id < count; ++id) {
+            remaining[id].store(m_nodes[id].predecessors.size(), std::memory_order_relaxed);
+            if (m_nodes[id].thread == SystemThread::Main)
+                ++mainThreadSystems;
+        }
+
+        JobCounter counter;
+        std::mutex mainQueueMutex;
+        std::vector<SystemId> mainQueue;
+        std::atomic<std::size_t> mainPending = mainThreadSystems;
+
+        std::mutex exceptionMutex;
+        std::exception_ptr exception = nullptr;
+        std::atomic<bool> failed = false;
+
+        std::function<void(SystemId)> schedule;
+        const auto execute = [&](const SystemId id) {
+            // Once a system failed, the remaining ones are only released so that the frame completes
+            if (!failed.load(std::memory_order_acquire)) {
+                try {
+                    m_nodes[id].update();
+                } catch (...) {
+                    std::lock_guard lock(exceptionMutex);
+                    if (!exception)
+                        exception = std::current_exception();
+                    failed = true;
+                }
+            }
+            for (const SystemId successor : m_nodes[id].successors) {
+                if (remaining[successor].fetch_sub(1, std::memory_order_acq_rel) == 1)
+                    schedule(successor);
+            }
+        };
+        schedule = [&](const SystemId id) {
+            if (m_nodes[id].thread == SystemThread::Main) {
+                std::lock_guard lock(mainQueueMutex);
+                mainQueue.push_back(id);
+            } else {
+                jobSystem.submit([&execute, id] { execute(id); }, counter);
+            }
+        };
+
+        for (SystemId id = 0; id < count; ++id) {
+            if (m_nodes[id].predecessors.empty())
+                schedule(id);
+        }
+
+        while (mainPending.load(std::memory_order_acquire) > 0 || !counter.isDone()) {
+            std::optional<SystemId> mainSystem;
+            {
+                std::lock_guard lock(mainQueueMutex);
+                if (!mainQueue.empty()) {
+                    mainSystem = mainQueue.back();
+                    mainQueue.pop_back();
+                }
+            }
+            if (mainSystem) {
+                execute(*mainSystem);
+                mainPending.fetch_sub(1, std::memory_order_acq_rel);
+                continue;
+            }
+            if (!jobSystem.tryRunPendingJob())
+                std::this_thread::yield();
+        }
+
+        if (exception)
+            std::rethrow_exception(exception);
+    }
+
+}
@@ -0,0 +1,162 @@
+//// SystemScheduler.hpp //////////////////////////////////////////////////////
+//
+// ⢀⢀⢀⣤⣤⣤⡀⢀⢀⢀⢀⢀⢀⢠⣤⡄⢀⢀⢀⢀⣠⣤⣤⣤⣤⣤⣤⣤⣤⣤⡀⢀⢀⢀⢠⣤⣄⢀⢀⢀⢀⢀⢀⢀⣤⣤⢀⢀⢀⢀⢀⢀⢀⢀⣀⣄⢀⢀⢠⣄⣀⢀⢀⢀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⣿⣷⡀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡟⡛⡛⡛⡛⡛⡛⡛⢁⢀⢀⢀⢀⢻⣿⣦⢀⢀⢀⢀⢠⣾⡿⢃⢀⢀⢀⢀⢀⣠⣾⣿⢿⡟⢀⢀⡙⢿⢿⣿⣦⡀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⡛⣿⣷⡀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡙⣿⡷⢀⢀⣰⣿⡟⢁⢀⢀⢀⢀⢀⣾⣿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⣿⡆⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⡈⢿⣷⡄⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣇⣀⣀⣀⣀⣀⣀⣀⢀⢀⢀⢀⢀⢀⢀⡈⢀⢀⣼⣿⢏⢀⢀⢀⢀⢀⢀⣼⣿⡏⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡘⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⡈⢿⣿⡄⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣿⢿⢿⢿⢿⢿⢿⢿⢇⢀⢀⢀⢀⢀⢀⢀⢠⣾⣿⣧⡀⢀⢀⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⡈⢿⣿⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣰⣿⡟⡛⣿⣷⡄⢀⢀⢀⢀⢀⢿⣿⣇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⡈⢿⢀⢀⢸⣿⡇⢀⢀⢀⢀⡛⡟⢁⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⡟⢀⢀⡈⢿⣿⣄⢀⢀⢀⢀⡘⣿⣿⣄⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⢏⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⢀⣀⣀⣀⣀⣀⣀⣀⣀⣀⡀⢀⢀⢀⣠⣾⡿⢃⢀⢀⢀⢀⢀⢻⣿⣧⡀⢀⢀⢀⡈⢻⣿⣷⣦⣄⢀⢀⣠⣤⣶⣿⡿⢋⢀⢀⢀⢀
+// ⢀⢀⢀⢿⢿⢀⢀⢀⢀⢀⢀⢀⢀⢸⢿⢃⢀⢀⢀⢀⢻⢿⢿⢿⢿⢿⢿⢿⢿⢿⢃⢀⢀⢀⢿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⡗⢀⢀⢀⢀⢀⡈⡉⡛⡛⢀⢀⢹⡛⢋⢁⢀⢀⢀⢀⢀⢀
+//
+//  Author:      Parallax Engine Team
+//  Date:        16/10/2026
+//  Description: Header file for the access-driven system scheduler
+//
+///////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include "Access.hpp"
+#include "JobSystem.hpp"
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace parallax::ecs {
+
+    /**
+     * @brief Thread a scheduled system is allowed to run on
+     */
+    enum class SystemThread {
+        Any,  ///< Any worker of the job system
+        Main  ///< Only the thread calling SystemScheduler::run (e.g. systems issuing graphics calls)
+    };
+
+    /**
+     * @class SystemScheduler
+     * @brief Runs systems concurrently while respecting their declared component access
+     *
+     * Systems are added in their logical order. Whenever two systems touch the same component or
+     * singleton and at least one of them writes it, the one added first runs first. Every other
+     * pair is independent, so the resulting dependency graph lets non-conflicting systems run at
+     * the same time on the job system.
+     */
+    class SystemScheduler {
+        public:
+            using SystemId = std::size_t;
+
+            /**
+             * @brief Adds a system described by an explicit access declaration
+             *
+             * @param name Name displayed in the schedule
+             * @param access Components and singletons read and written by the system
+             * @param update Function running the system for one frame
+             * @param thread Thread the system is allowed to run on
+             * @return SystemId Identifier of the system in this scheduler
+             */
+            SystemId addSystem(const std::string &name, const SystemAccess &access,
+                               std::function<void()> update, SystemThread thread = SystemThread::Any);
+
+            /**
+             * @brief Adds a QuerySystem or GroupSystem, reading its access markers
+             *
+             * @tparam SystemType System type exposing getAccessDeclaration() and update()
+             * @param name Name displayed in the schedule
+             * @param system The system to run each frame
+             * @param thread Thread the system is allowed to run on
+             * @return SystemId Identifier of the system in this scheduler
+             */
+            template<typename SystemType>
+            SystemId addSystem(const std::string &name, const std::shared_ptr<SystemType> &system,
+                               const SystemThread thread = SystemThread::Any)
+            {
+                return addSystem(name, SystemType::getAccessDeclaration(), [system] { system->update(); }, thread);
+            }
+
+            /**
+             * @brief Forces a system to run before another one, on top of the access-based ordering
+             *
+             * @param before System running first
+             * @param after System running second
+             * @throws InvalidSystemDependency if before was added after the other system
+             */
+            void addDependency(SystemId before, SystemId after);
+
+            /**
+             * @brief Runs every system once, in dependency order
+             *
+             * Returns when all the systems have completed. Main thread systems run on the calling thread,
+             * which also helps with the other jobs while waiting.
+             *
+             * @param jobSystem Job system running the systems
+             * @throws Rethrows the first exception thrown by a system, once the others have stopped
+             */
+            void run(JobSystem &jobSystem = JobSystem::getInstance());
+
+            /**
+             * @brief Gets the systems grouped by stage
+             *
+             * A system of stage N only depends on systems of earlier stages, so all the systems of
+             * a stage may run concurrently.
+             *
+             * @return Systems ids of each stage
+             */
+            [[nodiscard]] const std::vector<std::vector<SystemId>> &getStages();
+
+            /**
+             * @brief Gets the systems a system directly waits on
+             *
+             * @param id The system
+             * @return Ids of the direct dependencies, transitive ones excluded
+             */
+            [[nodiscard]] const std::vector<SystemId> &getDependencies(SystemId id);
+
+            /**
+             * @brief Formats the per-frame schedule, one line per stage followed by the dependencies
+             *
+             * @return Human readable schedule
+             */
+            [[nodiscard]] std::string describeSchedule();
+
+            /**
+             * @brief Gets the name of a system
+             *
+             * @param id The system
+             * @return Name given when the system was added
+             */
+            [[nodiscard]] const std::string &getName(const SystemId id) const { return m_nodes.at(id).name; }
+
+            /**
+             * @brief Gets the number of scheduled systems
+             *
+             * @return System count
+             */
+            [[nodiscard]] std::size_t size() const { return m_nodes.size(); }
+
+        private:
+            struct Node {
+                std::string name;
+                SystemAccess access;
+                std::function<void()> update;
+                SystemThread thread = SystemThread::Any;
+                std::vector<SystemId> predecessors;  ///< Direct dependencies, transitive ones removed
+                std::vector<SystemId> successors;
+                std::size_t stage = 0;
+            };
+
+            /**
+             * @brief Rebuilds the dependency graph and the stages after a change
+             */
+            void build();
+
+            std::vector<Node> m_nodes;
+            std::vector<std::pair<SystemId, SystemId>> m_explicitDependencies;
+            std::vector<std::vector<SystemId>> m_stages;
+            bool m_dirty = true;
+    };
+
+}
@@ -41,7 +41,9 @@ namespace parallax::renderer {
        	NxRenderCommand::clear();
         renderTarget->clearAttachment<int>(1, -1);
         NxRenderer3D::get().bindTextures();
-        const std::vector<DrawCommand> &drawCommands = pipeline.getDrawCommands();
+        NxRenderer3D::get().bindMaterials();
+        NxRenderer3D::get().bindInstances();
+        const std::pmr::vector<DrawCommand> &drawCommands = pipeline.getDrawCommands();
         for (const auto &cmd : drawCommands) {
             if (cmd.filterMask & F_FORWARD_PASS)
                 cmd.execute();
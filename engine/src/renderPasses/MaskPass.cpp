@@ -45,7 +45,8 @@ namespace parallax::renderer {
         //IMPORTANT: Bind textures after binding the framebuffer, since binding can trigger a resize and invalidate the
         // current texture slots
         renderer::NxRenderer3D::get().bindTextures();
-        const std::vector<DrawCommand> &drawCommands = pipeline.getDrawCommands();
+        renderer::NxRenderer3D::get().bindMaterials();
+        const std::pmr::vector<DrawCommand> &drawCommands = pipeline.getDrawCommands();
         for (const auto &cmd : drawCommands) {
             if (cmd.filterMask & F_OUTLINE_MASK)
                 cmd.execute();
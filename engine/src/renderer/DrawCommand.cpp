@@ -20,6 +20,8 @@
 #include "RenderCommand.hpp"
 
 namespace parallax::renderer {
+    static DrawStats s_stats;
+
     void DrawCommand::execute() const
     {
         static unsigned int currentShader = 0;
@@ -29,6 +31,9 @@ namespace parallax::renderer {
         if (shader && currentShader != shader->getProgramId()) {
             shader->bind();
             currentShader = shader->getProgramId();
+            ++s_stats.shaderBinds;
+        } else if (shader) {
+            ++s_stats.shaderBindsSkipped;
         }
 
         // Bind VAO for mesh, or use full-screen quad
@@ -37,23 +42,45 @@ namespace parallax::renderer {
             for (const auto &vbo : vao->getVertexBuffers())
                 vbo->bind();
             currentVAO = vao->getId();
+            ++s_stats.vaoBinds;
+        } else if (type == CommandType::MESH && vao) {
+            ++s_stats.vaoBindsSkipped;
         } else if (type == CommandType::FULL_SCREEN) {
             auto quad = getFullscreenQuad();
             quad->bind();
             currentVAO = quad->getId();
+            ++s_stats.vaoBinds;
         }
 
         // Set uniforms
         if (shader) {
-            for (auto const& [name, val] : uniforms) {
-                std::visit([&](auto&& v){ shader->setUniform(name, v); }, val);
-            }
+            for (const auto &[location, value] : uniforms)
+                shader->setUniformAt(location, value);
         }
 
-        if (type == CommandType::MESH && vao) {
+        if (type == CommandType::MESH && vao && instanceCount > 1) {
+            NxRenderCommand::drawIndexedInstanced(vao, vao->getIndexBuffer()->getCount(), instanceCount);
+            ++s_stats.drawCalls;
+            ++s_stats.instancedDrawCalls;
+            s_stats.instances += instanceCount;
+        } else if (type == CommandType::MESH && vao) {
             NxRenderCommand::drawIndexed(vao, vao->getIndexBuffer()->getCount());
+            ++s_stats.drawCalls;
+            ++s_stats.instances;
         } else if (type == CommandType::FULL_SCREEN) {
             NxRenderCommand::drawUnIndexed(6);
+            ++s_stats.drawCalls;
+            ++s_stats.instances;
         }
     }
+
+    const DrawStats &DrawCommand::getStats()
+    {
+        return s_stats;
+    }
+
+    void DrawCommand::resetStats()
+    {
+        s_stats = {};
+    }
 }
@@ -19,8 +19,14 @@
 
 #include "Shader.hpp"
 #include "UniformCache.hpp"
+#include "UniformRegistry.hpp"
 #include "VertexArray.hpp"
 
+#include <cstddef>
+#include <glm/glm.hpp>
+#include <memory_resource>
+#include <vector>
+
 namespace parallax::renderer {
 
     // Function to get the quad, initializing it on first use
@@ -55,16 +61,96 @@ namespace parallax::renderer {
         FULL_SCREEN,
     };
 
+    /**
+     * @brief A uniform already resolved against the shader of its command
+     *
+     * The alternative held by the value is the type of the uniform.
+     */
+    struct UniformEntry {
+        int location = -1;
+        UniformValue value;
+    };
+
+    /**
+     * @brief State changes issued by the draw commands and the ones skipped because the state was already bound
+     *
+     * Accumulated by every executed command until resetStats is called, which RenderPipeline::execute
+     * does before running its passes.
+     */
+    struct DrawStats {
+        std::size_t drawCalls = 0;
+        std::size_t instancedDrawCalls = 0;
+        std::size_t instances = 0;
+        std::size_t shaderBinds = 0;
+        std::size_t shaderBindsSkipped = 0;
+        std::size_t vaoBinds = 0;
+        std::size_t vaoBindsSkipped = 0;
+    };
+
+    /**
+     * @brief A draw call recorded for the frame
+     *
+     * Commands are allocator-aware: built with the frame arena and stored in std::pmr containers
+     * using it, their uniforms never touch the heap.
+     */
     struct DrawCommand {
+        using allocator_type = std::pmr::polymorphic_allocator<>;
+
+        DrawCommand() = default;
+        explicit DrawCommand(const allocator_type &allocator) : uniforms(allocator) {}
+        DrawCommand(const DrawCommand &other, const allocator_type &allocator)
+            : type(other.type), vao(other.vao), shader(other.shader), uniforms(other.uniforms, allocator),
+              filterMask(other.filterMask), isOpaque(other.isOpaque), materialIndex(other.materialIndex),
+              worldPosition(other.worldPosition), instanceCount(other.instanceCount) {}
+        DrawCommand(DrawCommand &&other, const allocator_type &allocator)
+            : type(other.type), vao(std::move(other.vao)), shader(std::move(other.shader)),
+              uniforms(std::move(other.uniforms), allocator), filterMask(other.filterMask), isOpaque(other.isOpaque),
+              materialIndex(other.materialIndex), worldPosition(other.worldPosition), instanceCount(other.instanceCount) {}
+        DrawCommand(const DrawCommand &other) = default;
+        DrawCommand(DrawCommand &&other) noexcept = default;
+        DrawCommand &operator=(const DrawCommand &other) = default;
+        DrawCommand &operator=(DrawCommand &&other) noexcept = default;
+
         CommandType type = CommandType::MESH;
 
         std::shared_ptr<NxVertexArray> vao;
         std::shared_ptr<NxShader> shader;
-        std::unordered_map<std::string, UniformValue> uniforms;
+        // Flat array uploaded in order, filled through setUniform once the shader is set
+        std::pmr::vector<UniformEntry> uniforms;
 
         uint32_t filterMask = 0xFFFFFFFF;
         bool isOpaque = true;
 
+        // Inputs of the sort key, the key itself is built by the pipeline once the camera is known
+        uint32_t materialIndex = 0;
+        glm::vec3 worldPosition{0.0f};
+
+        // Mesh commands with more than one instance are drawn with a single instanced draw call
+        uint32_t instanceCount = 1;
+
+        /**
+         * @brief Records a uniform of the command
+         *
+         * The location is looked up once here, uniforms the shader does not use are dropped.
+         * Each uniform is expected to be set once per command.
+         *
+         * @param handle Interned name of the uniform
+         * @param value Value of the uniform
+         */
+        void setUniform(const UniformHandle handle, const UniformValue &value)
+        {
+            if (!shader)
+                return;
+            if (const int location = shader->getUniformLocation(handle); location != -1)
+                uniforms.push_back({location, value});
+        }
+
         void execute() const;
+
+        /**
+         * @brief Gets the state changes accumulated since the last resetStats
+         */
+        static const DrawStats &getStats();
+        static void resetStats();
     };
 }
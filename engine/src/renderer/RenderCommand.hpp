@@ -128,6 +128,20 @@ namespace parallax::renderer {
                 _rendererApi->drawIndexed(vertexArray, indexCount);
             }
 
+            /**
+             * @brief Draws several instances of indexed geometry with a single draw call.
+             *
+             * @param vertexArray A shared pointer to the vertex array containing the geometry data.
+             * @param indexCount The number of indices to draw per instance. If set to 0, the method will use
+             *                   the total index count from the bound index buffer.
+             * @param instanceCount The number of instances to draw.
+             */
+            static void drawIndexedInstanced(const std::shared_ptr<NxVertexArray> &vertexArray,
+                                             const size_t indexCount, const size_t instanceCount)
+            {
+                _rendererApi->drawIndexedInstanced(vertexArray, indexCount, instanceCount);
+            }
+
             static void drawUnIndexed(const size_t verticesCount)
             {
                 _rendererApi->drawUnIndexed(verticesCount);
@@ -21,6 +21,9 @@
 #include "RenderCommand.hpp"
 #include "RendererExceptions.hpp"
 #include "Renderer3D.hpp"
+#include "SortKey.hpp"
+#include <algorithm>
+#include <bit>
 #include <functional>
 #include <set>
 #include <utility>
@@ -230,27 +233,77 @@ namespace parallax::renderer {
         if (!m_renderTarget)
             THROW_EXCEPTION(NxPipelineRenderTargetNotSetException);
 
+        sortDrawCommands();
+        // Draw calls and binds are counted per pipeline, the caller reads them back after execute
+        DrawCommand::resetStats();
+
+        for (const UniformBlock &block : m_frameData.uniformBlocks)
+            NxRenderer3D::get().uploadUniformBlock(block.binding, m_frameData.uniformBlockData.data() + block.offset, block.size);
+
         for (PassId id : m_plan) {
             if (passes.contains(id))
                 passes[id]->execute(*this);
         }
-        m_drawCommands.clear();
+        // Drop the storage too, it belongs to the frame arena and does not survive its reset
+        m_frameData = FrameData();
+    }
+
+    void RenderPipeline::sortDrawCommands()
+    {
+        auto &commands = m_frameData.commands;
+        if (commands.size() < 2)
+            return;
+
+        std::pmr::vector<SortEntry> entries(&FrameArena::getInstance());
+        entries.reserve(commands.size());
+        for (std::uint32_t i = 0; i < commands.size(); ++i) {
+            const DrawCommand &cmd = commands[i];
+            const glm::vec3 offset = cmd.worldPosition - m_cameraPosition;
+            entries.push_back({makeSortKey(
+                static_cast<unsigned int>(std::countr_zero(cmd.filterMask)),
+                cmd.isOpaque,
+                cmd.shader ? cmd.shader->getProgramId() : 0,
+                cmd.materialIndex,
+                cmd.vao ? cmd.vao->getId() : 0,
+                glm::dot(offset, offset)), i});
+        }
+        std::pmr::vector<SortEntry> scratch(entries.size(), &FrameArena::getInstance());
+        radixSort(entries, scratch);
+
+        std::pmr::vector<DrawCommand> sorted(&FrameArena::getInstance());
+        sorted.reserve(commands.size());
+        for (const SortEntry &entry : entries)
+            sorted.push_back(std::move(commands[entry.index]));
+        commands = std::move(sorted);
     }
 
-    void RenderPipeline::addDrawCommands(const std::vector<DrawCommand>& drawCommands)
+    void RenderPipeline::addDrawCommands(const std::span<const DrawCommand> drawCommands)
     {
-        m_drawCommands.reserve(m_drawCommands.size() + drawCommands.size());
-        m_drawCommands.insert(m_drawCommands.end(), drawCommands.begin(), drawCommands.end());
+        m_frameData.commands.reserve(m_frameData.commands.size() + drawCommands.size());
+        m_frameData.commands.insert(m_frameData.commands.end(), drawCommands.begin(), drawCommands.end());
     }
 
     void RenderPipeline::addDrawCommand(const DrawCommand& drawCommand)
     {
-        m_drawCommands.push_back(drawCommand);
+        m_frameData.commands.push_back(drawCommand);
     }
 
-    const std::vector<DrawCommand>& RenderPipeline::getDrawCommands() const
+    const std::pmr::vector<DrawCommand>& RenderPipeline::getDrawCommands() const
     {
-        return m_drawCommands;
+        return m_frameData.commands;
+    }
+
+    void RenderPipeline::setUniformBlock(const unsigned int binding, const std::span<const std::byte> data)
+    {
+        const auto it = std::ranges::find(m_frameData.uniformBlocks, binding, &UniformBlock::binding);
+        if (it != m_frameData.uniformBlocks.end() && it->size == data.size()) {
+            std::ranges::copy(data, m_frameData.uniformBlockData.begin() + static_cast<std::ptrdiff_t>(it->offset));
+            return;
+        }
+        if (it != m_frameData.uniformBlocks.end())
+            m_frameData.uniformBlocks.erase(it);
+        m_frameData.uniformBlocks.push_back({binding, m_frameData.uniformBlockData.size(), data.size()});
+        m_frameData.uniformBlockData.insert(m_frameData.uniformBlockData.end(), data.begin(), data.end());
     }
 
     void RenderPipeline::setCameraClearColor(const glm::vec4& clearColor)
@@ -263,6 +316,16 @@ namespace parallax::renderer {
         return m_cameraClearColor;
     }
 
+    void RenderPipeline::setCameraPosition(const glm::vec3& cameraPosition)
+    {
+        m_cameraPosition = cameraPosition;
+    }
+
+    const glm::vec3& RenderPipeline::getCameraPosition() const
+    {
+        return m_cameraPosition;
+    }
+
     void RenderPipeline::resize(const unsigned int width, const unsigned int height) const
     {
         if (!m_renderTarget)
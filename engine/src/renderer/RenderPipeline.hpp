@@ -19,6 +19,10 @@
 #include "Framebuffer.hpp"
 #include "RenderPass.hpp"
 #include "DrawCommand.hpp"
+#include "FrameArena.hpp"
+#include <cstddef>
+#include <memory_resource>
+#include <span>
 #include <vector>
 #include <unordered_map>
 #include <memory>
@@ -72,18 +76,56 @@ namespace parallax::renderer {
             // Check if a pass has effects
             bool hasEffects(PassId id) const;
 
-            void addDrawCommands(const std::vector<DrawCommand> &drawCommands);
+            // Draw commands are stored in the frame arena, they must be executed before the frame ends
+            void addDrawCommands(std::span<const DrawCommand> drawCommands);
             void addDrawCommand(const DrawCommand &drawCommand);
-            const std::vector<DrawCommand> &getDrawCommands() const;
+            const std::pmr::vector<DrawCommand> &getDrawCommands() const;
+
+            // Uniform block data shared by every draw of the frame, uploaded once when the pipeline executes.
+            // Setting a block twice in the same frame keeps the last data
+            void setUniformBlock(unsigned int binding, std::span<const std::byte> data);
 
             void setCameraClearColor(const glm::vec4 &clearColor);
             const glm::vec4 &getCameraClearColor() const;
 
+            // Position the depth of the sort keys is measured from
+            void setCameraPosition(const glm::vec3 &cameraPosition);
+            const glm::vec3 &getCameraPosition() const;
+
             void resize(unsigned int width, unsigned int height) const;
 
         private:
-            std::vector<DrawCommand> m_drawCommands;
+            // Orders the commands by sort key so that each pass runs them grouped by state, opaque draws front
+            // to back and translucent draws back to front
+            void sortDrawCommands();
+
+            // Location of a uniform block inside the frame's block data
+            struct UniformBlock {
+                unsigned int binding;
+                size_t offset;
+                size_t size;
+            };
+
+            // Keeps the commands and uniform blocks in the frame arena when the pipeline is copied, a pmr
+            // container would otherwise fall back to the default resource
+            struct FrameData {
+                FrameData() = default;
+                FrameData(const FrameData &other)
+                    : commands(other.commands, &FrameArena::getInstance()),
+                      uniformBlocks(other.uniformBlocks, &FrameArena::getInstance()),
+                      uniformBlockData(other.uniformBlockData, &FrameArena::getInstance()) {}
+                FrameData(FrameData &&other) noexcept = default;
+                FrameData &operator=(const FrameData &other) = default;
+                FrameData &operator=(FrameData &&other) noexcept = default;
+
+                std::pmr::vector<DrawCommand> commands{&FrameArena::getInstance()};
+                std::pmr::vector<UniformBlock> uniformBlocks{&FrameArena::getInstance()};
+                std::pmr::vector<std::byte> uniformBlockData{&FrameArena::getInstance()};
+            };
+
+            FrameData m_frameData;
             glm::vec4 m_cameraClearColor{};
+            glm::vec3 m_cameraPosition{};
             std::vector<PassId> m_plan{};
             bool m_isDirty = true;
 
@@ -19,6 +19,7 @@
 #include "ShaderLibrary.hpp"
 #define GLM_ENABLE_EXPERIMENTAL
 #include <glm/gtx/string_cast.hpp>
+#include <algorithm>
 #include <array>
 
 #include "Renderer3D.hpp"
@@ -199,6 +200,94 @@ namespace parallax::renderer {
         return textureIndex;
     }
 
+    void NxRenderer3D::uploadUniformBlock(const unsigned int binding, const void *data, const size_t size) const
+    {
+        if (!m_storage)
+            THROW_EXCEPTION(NxRendererNotInitialized, NxRendererType::RENDERER_3D);
+        if (binding >= NxRenderer3DStorage::maxUniformBlocks)
+            THROW_EXCEPTION(NxOutOfRangeException, binding, NxRenderer3DStorage::maxUniformBlocks);
+
+        auto &buffer = m_storage->uniformBuffers[binding];
+        if (!buffer || buffer->getSize() < size)
+            buffer = NxUniformBuffer::create(static_cast<unsigned int>(size));
+        buffer->setData(data, size);
+        buffer->bindBase(binding);
+    }
+
+    int NxRenderer3D::findMaterial(const void *key) const
+    {
+        const auto it = m_storage->materialIndices.find(key);
+        return it != m_storage->materialIndices.end() ? it->second : -1;
+    }
+
+    int NxRenderer3D::addMaterial(const void *key, const NxIndexedMaterial &material) const
+    {
+        const int index = static_cast<int>(m_storage->materials.size());
+        m_storage->materials.push_back(material);
+        m_storage->materialIndices.emplace(key, index);
+        m_storage->materialsDirty = true;
+        return index;
+    }
+
+    /**
+     * @brief Uploads the elements of a per-frame storage buffer if they changed since the last upload
+     *
+     * The buffer grows by doubling so that a few more elements do not reallocate it every frame.
+     */
+    template<typename T>
+    static void uploadStorage(std::vector<T> &elements, std::shared_ptr<NxShaderStorageBuffer> &buffer,
+                              size_t &capacity, bool &dirty)
+    {
+        if (!dirty)
+            return;
+        if (capacity < elements.size())
+        {
+            capacity = std::max(elements.size(), capacity * 2);
+            buffer = NxShaderStorageBuffer::create(static_cast<unsigned int>(capacity * sizeof(T)));
+        }
+        buffer->setData(elements.data(), elements.size() * sizeof(T));
+        dirty = false;
+    }
+
+    void NxRenderer3D::bindMaterials() const
+    {
+        if (m_storage->materials.empty())
+            return;
+        uploadStorage(m_storage->materials, m_storage->materialBuffer, m_storage->materialBufferCapacity,
+                      m_storage->materialsDirty);
+        m_storage->materialBuffer->bindBase(MATERIALS_BUFFER_BINDING);
+    }
+
+    void NxRenderer3D::resetMaterials() const
+    {
+        m_storage->materials.clear();
+        m_storage->materialIndices.clear();
+        m_storage->materialsDirty = false;
+    }
+
+    unsigned int NxRenderer3D::addInstances(const std::span<const NxInstanceData> instances) const
+    {
+        const auto offset = static_cast<unsigned int>(m_storage->instances.size());
+        m_storage->instances.insert(m_storage->instances.end(), instances.begin(), instances.end());
+        m_storage->instancesDirty = true;
+        return offset;
+    }
+
+    void NxRenderer3D::bindInstances() const
+    {
+        if (m_storage->instances.empty())
+            return;
+        uploadStorage(m_storage->instances, m_storage->instanceBuffer, m_storage->instanceBufferCapacity,
+                      m_storage->instancesDirty);
+        m_storage->instanceBuffer->bindBase(INSTANCES_BUFFER_BINDING);
+    }
+
+    void NxRenderer3D::resetInstances() const
+    {
+        m_storage->instances.clear();
+        m_storage->instancesDirty = false;
+    }
+
     void NxRenderer3D::setMaterialUniforms(const NxIndexedMaterial& material) const
     {
         if (!m_storage)
@@ -20,8 +20,14 @@
 #include "Shader.hpp"
 #include "VertexArray.hpp"
 #include "Texture.hpp"
+#include "ShaderStorageBuffer.hpp"
+#include "UniformBuffer.hpp"
 
 #include <array>
+#include <cstddef>
+#include <span>
+#include <unordered_map>
+#include <vector>
 #include <glm/glm.hpp>
 
 namespace parallax::renderer
@@ -37,13 +43,19 @@ namespace parallax::renderer
         int entityID;
     };
 
+    /**
+     * @brief Material as stored in the frame's material buffer
+     *
+     * Mirrors the Material struct of the shaders under the std430 layout rules,
+     * hence the 16 bytes alignment of the vector members.
+     */
     struct NxIndexedMaterial
     {
-        glm::vec4 albedoColor = glm::vec4(1.0f);
+        alignas(16) glm::vec4 albedoColor = glm::vec4(1.0f);
         int albedoTexIndex = 0; // Default: 0 (white texture)
-        glm::vec4 specularColor = glm::vec4(1.0f);
+        alignas(16) glm::vec4 specularColor = glm::vec4(1.0f);
         int specularTexIndex = 0; // Default: 0 (white texture)
-        glm::vec3 emissiveColor = glm::vec3(0.0f);
+        alignas(16) glm::vec3 emissiveColor = glm::vec3(0.0f);
         int emissiveTexIndex = 0; // Default: 0 (white texture)
         float roughness = 0.5f;
         int roughnessTexIndex = 0; // Default: 0 (white texture)
@@ -51,7 +63,37 @@ namespace parallax::renderer
         int metallicTexIndex = 0; // Default: 0 (white texture)
         float opacity = 1.0f;
         int opacityTexIndex = 0; // Default: 0 (white texture)
+        int normalTexIndex = 0; // Default: 0 (no normal map)
+        float normalStrength = 1.0f;
+    };
+    static_assert(offsetof(NxIndexedMaterial, specularColor) == 32);
+    static_assert(offsetof(NxIndexedMaterial, emissiveColor) == 64);
+    static_assert(offsetof(NxIndexedMaterial, roughness) == 80);
+    static_assert(offsetof(NxIndexedMaterial, normalStrength) == 108);
+    static_assert(sizeof(NxIndexedMaterial) == 112, "NxIndexedMaterial must match the std430 array stride of Material");
+
+    /**
+     * @brief Binding point of the material buffer, matches the MaterialsBlock declared by the shaders
+     */
+    constexpr unsigned int MATERIALS_BUFFER_BINDING = 2;
+
+    /**
+     * @brief Per-instance data of an instanced draw as stored in the frame's instance buffer
+     *
+     * Mirrors the Instance struct of the instanced shaders under the std430 layout rules.
+     */
+    struct NxInstanceData
+    {
+        glm::mat4 model{1.0f};
+        int entityId = -1;
+        int padding[3] = {0, 0, 0};
     };
+    static_assert(sizeof(NxInstanceData) == 80, "NxInstanceData must match the std430 array stride of Instance");
+
+    /**
+     * @brief Binding point of the instance buffer, matches the InstancesBlock declared by the instanced shaders
+     */
+    constexpr unsigned int INSTANCES_BUFFER_BINDING = 3;
 
     struct NxMaterial
     {
@@ -94,6 +136,9 @@ namespace parallax::renderer
      * - `textureSlots`: Array of texture slots for batching textures.
      * - `vertexBufferBase`, `indexBufferBase`: Base pointers for vertex and index data.
      * - `vertexBufferPtr`, `indexBufferPtr`: Current pointers for batching vertices and indices.
+     * - `uniformBuffers`: Uniform buffers of the per-frame uniform blocks, indexed by binding point.
+     * - `materials`, `materialIndices`, `materialBuffer`: Materials of the frame and the buffer the shaders index them from.
+     * - `instances`, `instanceBuffer`: Per-instance data of the frame's instanced draws and the buffer holding it.
      * - `stats`: Rendering statistics.
      */
     struct NxRenderer3DStorage
@@ -103,6 +148,7 @@ namespace parallax::renderer
         const unsigned int maxIndices = maxCubes * 36;
         static constexpr unsigned int maxTextureSlots = 32;
         static constexpr unsigned int maxTransforms = 1024;
+        static constexpr unsigned int maxUniformBlocks = 8;
 
         glm::vec3 cameraPosition;
 
@@ -121,6 +167,19 @@ namespace parallax::renderer
         std::array<std::shared_ptr<NxTexture2D>, maxTextureSlots> textureSlots;
         unsigned int textureSlotIndex = 1;
 
+        std::array<std::shared_ptr<NxUniformBuffer>, maxUniformBlocks> uniformBuffers;
+
+        std::vector<NxIndexedMaterial> materials;
+        std::unordered_map<const void *, int> materialIndices;
+        std::shared_ptr<NxShaderStorageBuffer> materialBuffer;
+        size_t materialBufferCapacity = 0;
+        bool materialsDirty = false;
+
+        std::vector<NxInstanceData> instances;
+        std::shared_ptr<NxShaderStorageBuffer> instanceBuffer;
+        size_t instanceBufferCapacity = 0;
+        bool instancesDirty = false;
+
         NxRenderer3DStats stats;
     };
 
@@ -258,6 +317,71 @@ namespace parallax::renderer
          * @return float The texture index.
          */
         [[nodiscard]] int getTextureIndex(const std::shared_ptr<NxTexture2D>& texture) const;
+
+        /**
+         * @brief Uploads the data of a uniform block and attaches its buffer to the binding point.
+         *
+         * The buffer of each binding point is created on first use and only reallocated when the data outgrows it.
+         *
+         * @param binding Binding point declared by the block in the shaders.
+         * @param data Block data, laid out with the std140 rules.
+         * @param size Size of the data in bytes.
+         *
+         * Throws:
+         * - NxRendererNotInitialized if the renderer is not initialized.
+         * - NxOutOfRangeException if the binding point exceeds maxUniformBlocks.
+         */
+        void uploadUniformBlock(unsigned int binding, const void *data, size_t size) const;
+
+        /**
+         * @brief Returns the index of a material already added to the frame's material buffer.
+         *
+         * @param key Identity of the material, usually the address of its asset.
+         * @return int The material index, or -1 if the material was not added this frame.
+         */
+        [[nodiscard]] int findMaterial(const void *key) const;
+
+        /**
+         * @brief Adds a material to the frame's material buffer.
+         *
+         * Draw commands reference the material through the returned index, which stays valid until resetMaterials().
+         *
+         * @param key Identity of the material, later lookups with findMaterial return the same index.
+         * @param material Material data, texture indices must come from getTextureIndex.
+         * @return int The material index.
+         */
+        int addMaterial(const void *key, const NxIndexedMaterial &material) const;
+
+        /**
+         * @brief Uploads the materials added since the last upload and binds the material buffer.
+         */
+        void bindMaterials() const;
+
+        /**
+         * @brief Clears the materials of the frame, invalidating every material index.
+         */
+        void resetMaterials() const;
+
+        /**
+         * @brief Appends the instances of an instanced draw to the frame's instance buffer.
+         *
+         * The instanced shaders read instance `gl_InstanceID` at the returned offset.
+         * The instances stay valid until resetInstances().
+         *
+         * @param instances Per-instance data of the draw.
+         * @return unsigned int Index of the first instance in the buffer.
+         */
+        unsigned int addInstances(std::span<const NxInstanceData> instances) const;
+
+        /**
+         * @brief Uploads the instances added since the last upload and binds the instance buffer.
+         */
+        void bindInstances() const;
+
+        /**
+         * @brief Clears the instances of the frame, invalidating every instance offset.
+         */
+        void resetInstances() const;
     private:
         std::shared_ptr<NxRenderer3DStorage> m_storage;
         bool m_renderingScene = false;
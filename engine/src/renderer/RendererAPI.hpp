@@ -143,6 +143,18 @@ namespace parallax::renderer {
             */
             virtual void drawIndexed(const std::shared_ptr<NxVertexArray> &vertexArray, size_t count = 0) = 0;
 
+            /**
+            * @brief Issues a single draw call rendering several instances of indexed geometry.
+            *
+            * @param vertexArray A shared pointer to the `NxVertexArray` containing vertex and index data.
+            * @param count The number of indices to draw per instance. If zero, all indices in the buffer are used.
+            * @param instanceCount The number of instances to draw.
+            *
+            * Must be implemented by subclasses.
+            */
+            virtual void drawIndexedInstanced(const std::shared_ptr<NxVertexArray> &vertexArray, size_t count,
+                                              size_t instanceCount) = 0;
+
             virtual void drawUnIndexed(size_t verticesCount) = 0;
 
             virtual void setStencilTest(bool enable) = 0;
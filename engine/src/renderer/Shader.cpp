@@ -19,7 +19,6 @@
 #include "Attributes.hpp"
 #include "renderer/RendererExceptions.hpp"
 #include "Logger.hpp"
-#include <variant>
 #ifdef NX_GRAPHICS_API_OPENGL
     #include "opengl/OpenGlShader.hpp"
 #endif
@@ -75,141 +74,104 @@ namespace parallax::renderer {
 
     bool NxShader::setUniformFloat(const std::string& name, const float value) const
     {
-        // Use uniform cache to avoid redundant state changes
-        if (!m_uniformCache.isDirty(name)) {
-            const auto optionalValue = m_uniformCache.getValue(name);
-            if (optionalValue.has_value() &&
-                std::holds_alternative<float>(*optionalValue) &&
-                std::get<float>(*optionalValue) == value) {
-                return true; // Value hasn't changed, skip the update
-            }
-        }
-
-        m_uniformCache.setFloat(name, value);
-        return false;
+        return setUniform(name, value);
     }
 
     bool NxShader::setUniformFloat2(const std::string& name, const glm::vec2& values) const
     {
-        if (!m_uniformCache.isDirty(name)) {
-            const auto optionalValue = m_uniformCache.getValue(name);
-            if (optionalValue.has_value() &&
-                std::holds_alternative<glm::vec2>(*optionalValue) &&
-                std::get<glm::vec2>(*optionalValue) == values) {
-                return true;
-            }
-        }
-
-        m_uniformCache.setFloat2(name, values);
-        return false;
+        return setUniform(name, values);
     }
 
     bool NxShader::setUniformFloat3(const std::string& name, const glm::vec3& values) const
     {
-        if (!m_uniformCache.isDirty(name)) {
-            const auto optionalValue = m_uniformCache.getValue(name);
-            if (optionalValue.has_value() &&
-                std::holds_alternative<glm::vec3>(*optionalValue) &&
-                std::get<glm::vec3>(*optionalValue) == values) {
-                return true;
-            }
-        }
-
-        m_uniformCache.setFloat3(name, values);
-        return false;
+        return setUniform(name, values);
     }
 
     bool NxShader::setUniformFloat4(const std::string& name, const glm::vec4& values) const
     {
-        if (!m_uniformCache.isDirty(name)) {
-            const auto optionalValue = m_uniformCache.getValue(name);
-            if (optionalValue.has_value() &&
-                std::holds_alternative<glm::vec4>(*optionalValue) &&
-                std::get<glm::vec4>(*optionalValue) == values) {
-                return true;
-            }
-        }
-
-        m_uniformCache.setFloat4(name, values);
-        return false;
+        return setUniform(name, values);
     }
 
     bool NxShader::setUniformMatrix(const std::string& name, const glm::mat4& matrix) const
     {
-        if (!m_uniformCache.isDirty(name)) {
-            const auto optionalValue = m_uniformCache.getValue(name);
-            if (optionalValue.has_value() &&
-                std::holds_alternative<glm::mat4>(*optionalValue) &&
-                std::get<glm::mat4>(*optionalValue) == matrix) {
-                return true;
-            }
-        }
+        return setUniform(name, matrix);
+    }
 
-        m_uniformCache.setMatrix(name, matrix);
-        return false;
+    bool NxShader::setUniformBool(const std::string& name, const bool value) const
+    {
+        return setUniform(name, value);
     }
 
-    bool NxShader::setUniformBool(const std::string& name, bool value) const
+    bool NxShader::setUniformInt(const std::string& name, const int value) const
     {
-        if (!m_uniformCache.isDirty(name)) {
-            const auto optionalValue = m_uniformCache.getValue(name);
-            if (optionalValue.has_value() &&
-                std::holds_alternative<bool>(*optionalValue) &&
-                std::get<bool>(*optionalValue) == value) {
-                return true;
-            }
-        }
+        return setUniform(name, value);
+    }
 
-        m_uniformCache.setBool(name, value);
-        return false;
+    bool NxShader::setUniformIntArray(const std::string& name, const int* values, const unsigned int count) const
+    {
+        const int location = getUniformLocation(UniformRegistry::getInstance().find(name));
+        if (location == -1)
+            return false;
+        // Arrays are not cached, they are always uploaded
+        uploadUniformIntArray(location, values, count);
+        return true;
     }
 
-    bool NxShader::setUniformInt(const std::string& name, int value) const
+    bool NxShader::setUniformFloat(const NxShaderUniforms uniform, const float value) const
     {
-        if (!m_uniformCache.isDirty(name)) {
-            const auto optionalValue = m_uniformCache.getValue(name);
-            if (optionalValue.has_value() &&
-                std::holds_alternative<int>(*optionalValue) &&
-                std::get<int>(*optionalValue) == value) {
-                return true;
-            }
-        }
+        return setUniform(ShaderUniformsName.at(uniform), value);
+    }
+
+    bool NxShader::setUniformFloat3(const NxShaderUniforms uniform, const glm::vec3& values) const
+    {
+        return setUniform(ShaderUniformsName.at(uniform), values);
+    }
+
+    bool NxShader::setUniformFloat4(const NxShaderUniforms uniform, const glm::vec4& values) const
+    {
+        return setUniform(ShaderUniformsName.at(uniform), values);
+    }
+
+    bool NxShader::setUniformMatrix(const NxShaderUniforms uniform, const glm::mat4& matrix) const
+    {
+        return setUniform(ShaderUniformsName.at(uniform), matrix);
+    }
+
+    bool NxShader::setUniformInt(const NxShaderUniforms uniform, const int value) const
+    {
+        return setUniform(ShaderUniformsName.at(uniform), value);
+    }
+
+    bool NxShader::setUniformIntArray(const NxShaderUniforms uniform, const int* values, const unsigned int count) const
+    {
+        return setUniformIntArray(ShaderUniformsName.at(uniform), values, count);
+    }
+
+    bool NxShader::setUniform(const std::string &name, const UniformValue& value) const
+    {
+        return setUniformAt(getUniformLocation(UniformRegistry::getInstance().find(name)), value);
+    }
+
+    bool NxShader::setUniformAt(const int location, const UniformValue& value) const
+    {
+        if (location == -1)
+            return false;
+        if (m_uniformCache.isCached(location, value))
+            return true; // Value hasn't changed, skip the update
+
+        uploadUniform(location, value);
+        m_uniformCache.store(location, value);
+        return true;
+    }
 
-        m_uniformCache.setInt(name, value);
-        return false;
-    }
-
-    bool NxShader::setUniformIntArray(
-        [[maybe_unused]] const std::string& name,
-        [[maybe_unused]] const int* values,
-        [[maybe_unused]] unsigned int count
-    ) const {
-        // Arrays are more complex for caching, so we'll always update them
-        // In a real implementation, you might want to cache arrays too
-        return false;
-    }
-
-    bool NxShader::setUniform(const std::string &name, UniformValue value) const
-    {
-        return std::visit([this, &name]<typename T>(T&& arg) -> bool {
-            using DecayedT = std::decay_t<T>;
-            if constexpr (std::is_same_v<DecayedT, float>)
-                return setUniformFloat(name, std::forward<T>(arg));
-            else if constexpr (std::is_same_v<DecayedT, glm::vec2>)
-                return setUniformFloat2(name, std::forward<T>(arg));
-            else if constexpr (std::is_same_v<DecayedT, glm::vec3>)
-                return setUniformFloat3(name, std::forward<T>(arg));
-            else if constexpr (std::is_same_v<DecayedT, glm::vec4>)
-                return setUniformFloat4(name, std::forward<T>(arg));
-            else if constexpr (std::is_same_v<DecayedT, int>)
-                return setUniformInt(name, std::forward<T>(arg));
-            else if constexpr (std::is_same_v<DecayedT, bool>)
-                return setUniformBool(name, std::forward<T>(arg));
-            else if constexpr (std::is_same_v<DecayedT, glm::mat4>)
-                return setUniformMatrix(name, std::forward<T>(arg));
-            else
-                return false;
-        }, value);
+    void NxShader::setupUniformHandles()
+    {
+        m_uniformLocations.clear();
+        for (const auto& [name, info] : m_uniformInfos) {
+            if (info.handle >= m_uniformLocations.size())
+                m_uniformLocations.resize(info.handle + 1, -1);
+            m_uniformLocations[info.handle] = info.location;
+        }
     }
 
     bool NxShader::hasUniform(const std::string& name) const
@@ -229,6 +191,6 @@ namespace parallax::renderer {
 
     void NxShader::resetCache()
     {
-        m_uniformCache.clearAllDirtyFlags();
+        m_uniformCache.clear();
     }
 }
@@ -26,6 +26,7 @@
 #include "ShaderStorageBuffer.hpp"
 #include "Attributes.hpp"
 #include "UniformCache.hpp"
+#include "UniformRegistry.hpp"
 
 namespace parallax::renderer
 {
@@ -64,6 +65,7 @@ namespace parallax::renderer
     struct UniformInfo
     {
         std::string name; // Name of the uniform
+        UniformHandle handle; // Interned name
         int location; // Location in the shader
         unsigned int type; // GL type (e.g., GL_FLOAT, GL_FLOAT_VEC3)
         int size; // Size (for arrays)
@@ -154,23 +156,47 @@ namespace parallax::renderer
         */
         virtual void unbind() const = 0;
 
-        virtual bool setUniformFloat(const std::string& name, float value) const;
-        virtual bool setUniformFloat2(const std::string& name, const glm::vec2& values) const;
-        virtual bool setUniformFloat3(const std::string& name, const glm::vec3& values) const;
-        virtual bool setUniformFloat4(const std::string& name, const glm::vec4& values) const;
-        virtual bool setUniformMatrix(const std::string& name, const glm::mat4& matrix) const;
-        virtual bool setUniformBool(const std::string& name, bool value) const;
-        virtual bool setUniformInt(const std::string& name, int value) const;
-        virtual bool setUniformIntArray(const std::string& name, const int* values, unsigned int count) const;
+        bool setUniformFloat(const std::string& name, float value) const;
+        bool setUniformFloat2(const std::string& name, const glm::vec2& values) const;
+        bool setUniformFloat3(const std::string& name, const glm::vec3& values) const;
+        bool setUniformFloat4(const std::string& name, const glm::vec4& values) const;
+        bool setUniformMatrix(const std::string& name, const glm::mat4& matrix) const;
+        bool setUniformBool(const std::string& name, bool value) const;
+        bool setUniformInt(const std::string& name, int value) const;
+        bool setUniformIntArray(const std::string& name, const int* values, unsigned int count) const;
 
-        virtual bool setUniformFloat(NxShaderUniforms uniform, float value) const = 0;
-        virtual bool setUniformFloat3(NxShaderUniforms uniform, const glm::vec3& values) const = 0;
-        virtual bool setUniformFloat4(NxShaderUniforms uniform, const glm::vec4& values) const = 0;
-        virtual bool setUniformMatrix(NxShaderUniforms uniform, const glm::mat4& matrix) const = 0;
-        virtual bool setUniformInt(NxShaderUniforms uniform, int value) const = 0;
-        virtual bool setUniformIntArray(NxShaderUniforms uniform, const int* values, unsigned int count) const = 0;
+        bool setUniformFloat(NxShaderUniforms uniform, float value) const;
+        bool setUniformFloat3(NxShaderUniforms uniform, const glm::vec3& values) const;
+        bool setUniformFloat4(NxShaderUniforms uniform, const glm::vec4& values) const;
+        bool setUniformMatrix(NxShaderUniforms uniform, const glm::mat4& matrix) const;
+        bool setUniformInt(NxShaderUniforms uniform, int value) const;
+        bool setUniformIntArray(NxShaderUniforms uniform, const int* values, unsigned int count) const;
 
-        bool setUniform(const std::string& name, UniformValue value) const;
+        bool setUniform(const std::string& name, const UniformValue& value) const;
+
+        /**
+        * @brief Resolves an interned uniform name to its location in this program.
+        *
+        * A plain array access, safe to call from several threads while no shader is being created.
+        *
+        * @param handle Handle from UniformRegistry.
+        * @return int Location of the uniform, or -1 if the program does not use it.
+        */
+        [[nodiscard]] int getUniformLocation(UniformHandle handle) const
+        {
+            return handle < m_uniformLocations.size() ? m_uniformLocations[handle] : -1;
+        }
+
+        /**
+        * @brief Sets a uniform from an already resolved location.
+        *
+        * The shader must be bound. Uploads are skipped when the location already holds the value.
+        *
+        * @param location Location returned by getUniformLocation.
+        * @param value Value of the uniform.
+        * @return true if the location is valid.
+        */
+        bool setUniformAt(int location, const UniformValue& value) const;
 
         void addStorageBuffer(const std::shared_ptr<NxShaderStorageBuffer>& buffer);
         void setStorageBufferData(size_t index, void* data, size_t size);
@@ -189,10 +215,27 @@ namespace parallax::renderer
         virtual unsigned int getProgramId() const = 0;
 
     protected:
+        /**
+        * @brief Uploads a value to a location of the bound program.
+        *
+        * Must be implemented by subclasses.
+        */
+        virtual void uploadUniform(int location, const UniformValue& value) const = 0;
+        virtual void uploadUniformIntArray(int location, const int* values, unsigned int count) const = 0;
+
+        /**
+        * @brief Builds the handle to location table from the reflected uniforms.
+        *
+        * Must be called by subclasses once m_uniformInfos is filled.
+        */
+        void setupUniformHandles();
+
         static std::string readFile(const std::string& filepath);
         std::vector<std::shared_ptr<NxShaderStorageBuffer>> m_storageBuffers;
         RequiredAttributes m_requiredAttributes;
         std::unordered_map<std::string, UniformInfo> m_uniformInfos;
+        // Location of every interned uniform, indexed by handle, -1 for the ones this program does not use
+        std::vector<int> m_uniformLocations;
         std::unordered_map<int, AttributeInfo> m_attributeInfos;
         mutable UniformCache m_uniformCache;
     };
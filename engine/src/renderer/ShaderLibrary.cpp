@@ -64,11 +64,14 @@ namespace parallax::renderer {
 
         // Load all required shaders with error handling
         safeLoadShader("Phong", "../resources/shaders/phong.glsl");
+        safeLoadShader("Phong instanced", "../resources/shaders/phong_instanced.glsl");
         safeLoadShader("Outline pulse flat", "../resources/shaders/outline_pulse_flat.glsl");
         safeLoadShader("Outline pulse transparent flat", "../resources/shaders/outline_pulse_transparent_flat.glsl");
         safeLoadShader("Albedo unshaded transparent", "../resources/shaders/albedo_unshaded_transparent.glsl");
         safeLoadShader("Grid shader", "../resources/shaders/grid_shader.glsl");
         safeLoadShader("Flat color", "../resources/shaders/flat_color.glsl");
+
+        addInstancedVariant("Phong", "Phong instanced");
     }
 
     void ShaderLibrary::add(const std::shared_ptr<NxShader> &shader)
@@ -112,4 +115,22 @@ namespace parallax::renderer {
         }
         return m_shaders.at(name);
     }
+
+    void ShaderLibrary::addInstancedVariant(const std::string &name, const std::string &instancedName)
+    {
+        const auto shader = m_shaders.find(name);
+        const auto instancedShader = m_shaders.find(instancedName);
+        if (shader == m_shaders.end() || instancedShader == m_shaders.end())
+        {
+            LOG(PARALLAX_WARN, "ShaderLibrary::addInstancedVariant: shader {} or {} not found", name, instancedName);
+            return;
+        }
+        m_instancedVariants[shader->second.get()] = instancedShader->second;
+    }
+
+    std::shared_ptr<NxShader> ShaderLibrary::getInstancedVariant(const NxShader *shader) const
+    {
+        const auto it = m_instancedVariants.find(shader);
+        return it != m_instancedVariants.end() ? it->second : nullptr;
+    }
 }
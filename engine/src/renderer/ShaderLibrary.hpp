@@ -22,17 +22,6 @@
 
 namespace parallax::renderer {
 
-    struct TransparentStringHasher {
-        using is_transparent = void;  // enable heterogeneous lookup
-
-        size_t operator()(std::string_view sv) const noexcept {
-            return std::hash<std::string_view>{}(sv);
-        }
-        size_t operator()(const std::string &s) const noexcept {
-            return operator()(std::string_view(s));
-        }
-    };
-
     class ShaderLibrary {
         private:
             // Singleton: private constructor and destructor
@@ -46,6 +35,25 @@ namespace parallax::renderer {
             std::shared_ptr<NxShader> load(const std::string &name, const std::string &vertexSource, const std::string &fragmentSource);
             std::shared_ptr<NxShader> get(const std::string &name) const;
 
+            /**
+             * @brief Registers the shader drawing many instances of what the given shader draws once
+             *
+             * Both shaders must already be in the library. Instanced variants read their model matrices
+             * and entity ids from the instance buffer instead of the per-draw uniforms.
+             *
+             * @param name Name of the regular shader
+             * @param instancedName Name of its instanced variant
+             */
+            void addInstancedVariant(const std::string &name, const std::string &instancedName);
+
+            /**
+             * @brief Gets the instanced variant of a shader
+             *
+             * @param shader The regular shader
+             * @return The instanced variant, or nullptr if the shader has none
+             */
+            std::shared_ptr<NxShader> getInstancedVariant(const NxShader *shader) const;
+
             static ShaderLibrary& getInstance()
             {
                 static ShaderLibrary instance;
@@ -61,5 +69,6 @@ namespace parallax::renderer {
                 TransparentStringHasher,
                 std::equal_to<>
             > m_shaders;
+            std::unordered_map<const NxShader *, std::shared_ptr<NxShader>> m_instancedVariants;
     };
 }
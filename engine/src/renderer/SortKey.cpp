@@ -0,0 +1,99 @@
+//// SortKey.cpp //////////////////////////////////////////////////////////////
+//
+// ⢀⢀⢀⣤⣤⣤⡀⢀⢀⢀⢀⢀⢀⢠⣤⡄⢀⢀⢀⢀⣠⣤⣤⣤⣤⣤⣤⣤⣤⣤⡀⢀⢀⢀⢠⣤⣄⢀⢀⢀⢀⢀⢀⢀⣤⣤⢀⢀⢀⢀⢀⢀⢀⢀⣀⣄⢀⢀⢠⣄⣀⢀⢀⢀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⣿⣷⡀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡟⡛⡛⡛⡛⡛⡛⡛⢁⢀⢀⢀⢀⢻⣿⣦⢀⢀⢀⢀⢠⣾⡿⢃⢀⢀⢀⢀⢀⣠⣾⣿⢿⡟⢀⢀⡙⢿⢿⣿⣦⡀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⡛⣿⣷⡀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡙⣿⡷⢀⢀⣰⣿⡟⢁⢀⢀⢀⢀⢀⣾⣿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⣿⡆⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⡈⢿⣷⡄⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣇⣀⣀⣀⣀⣀⣀⣀⢀⢀⢀⢀⢀⢀⢀⡈⢀⢀⣼⣿⢏⢀⢀⢀⢀⢀⢀⣼⣿⡏⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡘⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⡈⢿⣿⡄⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣿⢿⢿⢿⢿⢿⢿⢿⢇⢀⢀⢀⢀⢀⢀⢀⢠⣾⣿⣧⡀⢀⢀⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⡈⢿⣿⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣰⣿⡟⡛⣿⣷⡄⢀⢀⢀⢀⢀⢿⣿⣇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⡈⢿⢀⢀⢸⣿⡇⢀⢀⢀⢀⡛⡟⢁⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⡟⢀⢀⡈⢿⣿⣄⢀⢀⢀⢀⡘⣿⣿⣄⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⢏⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⢀⣀⣀⣀⣀⣀⣀⣀⣀⣀⡀⢀⢀⢀⣠⣾⡿⢃⢀⢀⢀⢀⢀⢻⣿⣧⡀⢀⢀⢀⡈⢻⣿⣷⣦⣄⢀⢀⣠⣤⣶⣿⡿⢋⢀⢀⢀⢀
+// ⢀⢀⢀⢿⢿⢀⢀⢀⢀⢀⢀⢀⢀⢸⢿⢃⢀⢀⢀⢀⢻⢿⢿⢿⢿⢿⢿⢿⢿⢿⢃⢀⢀⢀⢿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⡗⢀⢀⢀⢀⢀⡈⡉⡛⡛⢀⢀⢹⡛⢋⢁⢀⢀⢀⢀⢀⢀
+//
+//  Author:      Parallax Engine Team
+//  Date:        16/10/2026
+//  Description: Source file for the draw command sort keys
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include "SortKey.hpp"
+#include "RendererExceptions.hpp"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+
+namespace parallax::renderer {
+
+    constexpr unsigned int PASS_SHIFT = 60;
+    constexpr unsigned int TRANSLUCENT_SHIFT = 59;
+
+    constexpr std::uint64_t fieldMask(const unsigned int bits)
+    {
+        return (std::uint64_t{1} << bits) - 1;
+    }
+
+    // Positive floats compare like their bit patterns, the top bits are a logarithmic quantization
+    static std::uint64_t quantizeDepth(const float distanceSquared, const unsigned int bits)
+    {
+        const auto floatBits = std::bit_cast<std::uint32_t>(std::max(distanceSquared, 0.0f));
+        return floatBits >> (31 - bits);
+    }
+
+    SortKey makeSortKey(const unsigned int pass, const bool isOpaque, const unsigned int shaderId,
+                        const unsigned int materialIndex, const unsigned int vaoId, const float distanceSquared)
+    {
+        SortKey key = (pass & fieldMask(4)) << PASS_SHIFT;
+        if (isOpaque) {
+            key |= (shaderId & fieldMask(10)) << 49;
+            key |= (materialIndex & fieldMask(14)) << 35;
+            key |= (vaoId & fieldMask(14)) << 21;
+            key |= quantizeDepth(distanceSquared, 21);
+        } else {
+            key |= std::uint64_t{1} << TRANSLUCENT_SHIFT;
+            key |= (fieldMask(24) - quantizeDepth(distanceSquared, 24)) << 35;
+            key |= (shaderId & fieldMask(10)) << 25;
+            key |= (materialIndex & fieldMask(12)) << 13;
+            key |= vaoId & fieldMask(13);
+        }
+        return key;
+    }
+
+    void radixSort(std::span<SortEntry> entries, std::span<SortEntry> scratch)
+    {
+        if (scratch.size() < entries.size())
+            THROW_EXCEPTION(NxOutOfRangeException, entries.size(), scratch.size());
+        scratch = scratch.first(entries.size());
+        if (entries.size() < 2)
+            return;
+
+        constexpr unsigned int BYTE_COUNT = sizeof(SortKey);
+        std::array<std::array<std::uint32_t, 256>, BYTE_COUNT> histograms{};
+        for (const SortEntry &entry : entries) {
+            for (unsigned int byte = 0; byte < BYTE_COUNT; ++byte)
+                ++histograms[byte][(entry.key >> (byte * 8)) & 0xFF];
+        }
+
+        std::span<SortEntry> source = entries;
+        std::span<SortEntry> destination = scratch;
+        for (unsigned int byte = 0; byte < BYTE_COUNT; ++byte) {
+            auto &histogram = histograms[byte];
+            // Every key has the same value for this byte, the pass would not move anything
+            if (std::ranges::find(histogram, static_cast<std::uint32_t>(entries.size())) != histogram.end())
+                continue;
+
+            std::uint32_t offset = 0;
+            for (std::uint32_t &count : histogram) {
+                const std::uint32_t bucketSize = count;
+                count = offset;
+                offset += bucketSize;
+            }
+            for (const SortEntry &entry : source)
+                destination[histogram[(entry.key >> (byte * 8)) & 0xFF]++] = entry;
+            std::swap(source, destination);
+        }
+
+        if (source.data() != entries.data())
+            std::ranges::copy(source, entries.begin());
+    }
+}
@@ -0,0 +1,73 @@
+//// SortKey.hpp //////////////////////////////////////////////////////////////
+//
+// ⢀⢀⢀⣤⣤⣤⡀⢀⢀⢀⢀⢀⢀⢠⣤⡄⢀⢀⢀⢀⣠⣤⣤⣤⣤⣤⣤⣤⣤⣤⡀⢀⢀⢀⢠⣤⣄⢀⢀⢀⢀⢀⢀⢀⣤⣤⢀⢀⢀⢀⢀⢀⢀⢀⣀⣄⢀⢀⢠⣄⣀⢀⢀⢀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⣿⣷⡀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡟⡛⡛⡛⡛⡛⡛⡛⢁⢀⢀⢀⢀⢻⣿⣦⢀⢀⢀⢀⢠⣾⡿⢃⢀⢀⢀⢀⢀⣠⣾⣿⢿⡟⢀⢀⡙⢿⢿⣿⣦⡀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⡛⣿⣷⡀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡙⣿⡷⢀⢀⣰⣿⡟⢁⢀⢀⢀⢀⢀⣾⣿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⣿⡆⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⡈⢿⣷⡄⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣇⣀⣀⣀⣀⣀⣀⣀⢀⢀⢀⢀⢀⢀⢀⡈⢀⢀⣼⣿⢏⢀⢀⢀⢀⢀⢀⣼⣿⡏⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡘⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⡈⢿⣿⡄⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣿⢿⢿⢿⢿⢿⢿⢿⢇⢀⢀⢀⢀⢀⢀⢀⢠⣾⣿⣧⡀⢀⢀⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⡈⢿⣿⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣰⣿⡟⡛⣿⣷⡄⢀⢀⢀⢀⢀⢿⣿⣇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⡈⢿⢀⢀⢸⣿⡇⢀⢀⢀⢀⡛⡟⢁⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⡟⢀⢀⡈⢿⣿⣄⢀⢀⢀⢀⡘⣿⣿⣄⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⢏⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⢀⣀⣀⣀⣀⣀⣀⣀⣀⣀⡀⢀⢀⢀⣠⣾⡿⢃⢀⢀⢀⢀⢀⢻⣿⣧⡀⢀⢀⢀⡈⢻⣿⣷⣦⣄⢀⢀⣠⣤⣶⣿⡿⢋⢀⢀⢀⢀
+// ⢀⢀⢀⢿⢿⢀⢀⢀⢀⢀⢀⢀⢀⢸⢿⢃⢀⢀⢀⢀⢻⢿⢿⢿⢿⢿⢿⢿⢿⢿⢃⢀⢀⢀⢿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⡗⢀⢀⢀⢀⢀⡈⡉⡛⡛⢀⢀⢹⡛⢋⢁⢀⢀⢀⢀⢀⢀
+//
+//  Author:      Parallax Engine Team
+//  Date:        16/10/2026
+//  Description: Header file for the draw command sort keys
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <cstdint>
+#include <span>
+
+namespace parallax::renderer {
+
+    /**
+     * @brief 64 bits key ordering the draw commands of a pipeline
+     *
+     * From the most significant bits:
+     * - pass (4 bits): lowest bit of the filter mask, keeps the commands of a pass together
+     * - translucency (1 bit): opaque draws come first
+     * - opaque draws: shader (10), material (14), vertex array (14) then depth (21), nearest first
+     * - translucent draws: depth (24) farthest first, then shader (10), material (12), vertex array (13)
+     *
+     * Opaque draws are grouped by state and only then ordered front to back, translucent draws must
+     * blend back to front so their depth comes before the state. Identifiers wider than their field
+     * are truncated, which at worst interleaves unrelated states.
+     */
+    using SortKey = std::uint64_t;
+
+    /**
+     * @brief Builds the sort key of a draw command
+     *
+     * @param pass Index of the pass, usually the lowest bit set in the filter mask
+     * @param isOpaque Whether the draw writes opaque fragments
+     * @param shaderId Program id of the shader, 0 if none
+     * @param materialIndex Index of the material in the frame's material buffer
+     * @param vaoId Id of the vertex array, 0 if none
+     * @param distanceSquared Squared distance between the camera and the draw
+     * @return SortKey The key, smaller keys are drawn first
+     */
+    SortKey makeSortKey(unsigned int pass, bool isOpaque, unsigned int shaderId, unsigned int materialIndex,
+                        unsigned int vaoId, float distanceSquared);
+
+    /**
+     * @brief Index of a draw command paired with its sort key
+     */
+    struct SortEntry {
+        SortKey key;
+        std::uint32_t index;
+    };
+
+    /**
+     * @brief Sorts entries by key, equal keys keep their order
+     *
+     * LSD radix sort one byte at a time. The histograms of every byte are built in a single pass
+     * and the bytes shared by all keys are skipped, which is most of them for the pass and translucency bits.
+     *
+     * @param entries Entries to sort
+     * @param scratch Buffer of the same size as entries, its content is overwritten
+     */
+    void radixSort(std::span<SortEntry> entries, std::span<SortEntry> scratch);
+}
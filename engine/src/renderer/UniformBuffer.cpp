@@ -1,4 +1,4 @@
-//// TransformMatrixSystem ///////////////////////////////////////////////////////////////
+//// UniformBuffer.cpp ////////////////////////////////////////////////////////
 //
 // ⢀⢀⢀⣤⣤⣤⡀⢀⢀⢀⢀⢀⢀⢠⣤⡄⢀⢀⢀⢀⣠⣤⣤⣤⣤⣤⣤⣤⣤⣤⡀⢀⢀⢀⢠⣤⣄⢀⢀⢀⢀⢀⢀⢀⣤⣤⢀⢀⢀⢀⢀⢀⢀⢀⣀⣄⢀⢀⢠⣄⣀⢀⢀⢀⢀⢀⢀⢀
 // ⢀⢀⢀⣿⣿⣿⣷⡀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡟⡛⡛⡛⡛⡛⡛⡛⢁⢀⢀⢀⢀⢻⣿⣦⢀⢀⢀⢀⢠⣾⡿⢃⢀⢀⢀⢀⢀⣠⣾⣿⢿⡟⢀⢀⡙⢿⢿⣿⣦⡀⢀⢀⢀⢀
@@ -10,26 +10,28 @@
 // ⢀⢀⢀⣿⣿⢀⢀⢀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⢀⣀⣀⣀⣀⣀⣀⣀⣀⣀⡀⢀⢀⢀⣠⣾⡿⢃⢀⢀⢀⢀⢀⢻⣿⣧⡀⢀⢀⢀⡈⢻⣿⣷⣦⣄⢀⢀⣠⣤⣶⣿⡿⢋⢀⢀⢀⢀
 // ⢀⢀⢀⢿⢿⢀⢀⢀⢀⢀⢀⢀⢀⢸⢿⢃⢀⢀⢀⢀⢻⢿⢿⢿⢿⢿⢿⢿⢿⢿⢃⢀⢀⢀⢿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⡗⢀⢀⢀⢀⢀⡈⡉⡛⡛⢀⢀⢹⡛⢋⢁⢀⢀⢀⢀⢀⢀
 //
-//  Author:      Mehdy MORVAN
-//  Date:        01/06/2025
-//  Description: System responsible of updating the world matrix from the transfom component
+//  Author:      Parallax Engine Team
+//  Date:        16/10/2026
+//  Description: Source file for the uniform buffer objects
 //
 ///////////////////////////////////////////////////////////////////////////////
-#pragma once
 
-#include "ecs/QuerySystem.hpp"
-#include "components/Transform.hpp"
-#include "components/SceneComponents.hpp"
-#include "components/RenderContext.hpp"
+#include "UniformBuffer.hpp"
+#include "renderer/RendererExceptions.hpp"
+#include <memory>
+#ifdef NX_GRAPHICS_API_OPENGL
+    #include "opengl/OpenGlUniformBuffer.hpp"
+#endif
+
+namespace parallax::renderer {
+
+	std::shared_ptr<NxUniformBuffer> NxUniformBuffer::create(unsigned int size)
+	{
+  		#ifdef NX_GRAPHICS_API_OPENGL
+            return std::make_shared<NxOpenGlUniformBuffer>(size);
+	    #else
+	        THROW_EXCEPTION(NxUnknownGraphicsApi, "UNKNOWN");
+	    #endif
+	}
 
-namespace parallax::system {
-    class TransformMatrixSystem final : public ecs::QuerySystem<
-        ecs::Write<components::TransformComponent>,
-        ecs::Read<components::SceneTag>,
-        ecs::WriteSingleton<components::RenderContext>> {
-			public:
-               void update();
-           private:
-               static glm::mat4 createTransformMatrix(const components::TransformComponent &transform);
-	};
 }
@@ -1,4 +1,4 @@
-//// TransformMatrixSystem.cpp ///////////////////////////////////////////////////////////////
+//// UniformBuffer.hpp ////////////////////////////////////////////////////////
 //
 // ⢀⢀⢀⣤⣤⣤⡀⢀⢀⢀⢀⢀⢀⢠⣤⡄⢀⢀⢀⢀⣠⣤⣤⣤⣤⣤⣤⣤⣤⣤⡀⢀⢀⢀⢠⣤⣄⢀⢀⢀⢀⢀⢀⢀⣤⣤⢀⢀⢀⢀⢀⢀⢀⢀⣀⣄⢀⢀⢠⣄⣀⢀⢀⢀⢀⢀⢀⢀
 // ⢀⢀⢀⣿⣿⣿⣷⡀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡟⡛⡛⡛⡛⡛⡛⡛⢁⢀⢀⢀⢀⢻⣿⣦⢀⢀⢀⢀⢠⣾⡿⢃⢀⢀⢀⢀⢀⣠⣾⣿⢿⡟⢀⢀⡙⢿⢿⣿⣦⡀⢀⢀⢀⢀
@@ -10,41 +10,42 @@
 // ⢀⢀⢀⣿⣿⢀⢀⢀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⢀⣀⣀⣀⣀⣀⣀⣀⣀⣀⡀⢀⢀⢀⣠⣾⡿⢃⢀⢀⢀⢀⢀⢻⣿⣧⡀⢀⢀⢀⡈⢻⣿⣷⣦⣄⢀⢀⣠⣤⣶⣿⡿⢋⢀⢀⢀⢀
 // ⢀⢀⢀⢿⢿⢀⢀⢀⢀⢀⢀⢀⢀⢸⢿⢃⢀⢀⢀⢀⢻⢿⢿⢿⢿⢿⢿⢿⢿⢿⢃⢀⢀⢀⢿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⡗⢀⢀⢀⢀⢀⡈⡉⡛⡛⢀⢀⢹⡛⢋⢁⢀⢀⢀⢀⢀⢀
 //
-//  Author:      Mehdy MORVAN
-//  Date:        01/06/2025
-//  Description: Source file for the system responsible of updating the world matrixes
+//  Author:      Parallax Engine Team
+//  Date:        16/10/2026
+//  Description: Header file for the uniform buffer objects
 //
 ///////////////////////////////////////////////////////////////////////////////
 
-#include "TransformMatrixSystem.hpp"
-#include "components/Transform.hpp"
+#pragma once
 
-#define GLM_ENABLE_EXPERIMENTAL
-#include <glm/gtx/quaternion.hpp>
+#include <memory>
 
-namespace parallax::system {
-    void TransformMatrixSystem::update()
-    {
-        const auto &renderContext = getSingleton<components::RenderContext>();
-        if (renderContext.sceneRendered == -1)
-            return;
+namespace parallax::renderer {
 
-        const auto sceneRendered = static_cast<unsigned int>(renderContext.sceneRendered);
+	/**
+	 * @brief GPU buffer backing a uniform block shared by every shader declaring it
+	 *
+	 * The buffer is attached to a binding point with bindBase, shaders then read it through
+	 * a block declared with the same binding. The data layout must follow the std140 rules.
+	 */
+	class NxUniformBuffer {
+		public:
+			virtual ~NxUniformBuffer() = default;
 
-        for (const ecs::Entity entity : entities) {
-            auto &sceneTag = getComponent<components::SceneTag>(entity);
-			if (sceneTag.id != sceneRendered)
-				continue;
-            auto &transform = getComponent<components::TransformComponent>(entity);
-            transform.localMatrix = createTransformMatrix(transform);
-            transform.worldMatrix = transform.localMatrix;
-        }
-    }
+			static std::shared_ptr<NxUniformBuffer> create(unsigned int size);
 
-    glm::mat4 TransformMatrixSystem::createTransformMatrix(const components::TransformComponent &transform)
-    {
-        return glm::translate(glm::mat4(1.0f), transform.pos) *
-               glm::toMat4(transform.quat) *
-               glm::scale(glm::mat4(1.0f), transform.size);
-    }
+			virtual void bind() const = 0;
+			virtual void bindBase(unsigned int bindingLocation) const = 0;
+			virtual void unbind() const = 0;
+
+			/**
+			 * @brief Uploads the data at the start of the buffer
+			 *
+			 * @param data Data to upload.
+			 * @param size Size of the data in bytes, must not exceed the buffer size.
+			 */
+			virtual void setData(const void *data, size_t size) = 0;
+			[[nodiscard]] virtual unsigned int getSize() const = 0;
+			[[nodiscard]] virtual unsigned int getId() const = 0;
+	};
 }
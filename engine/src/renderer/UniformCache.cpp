@@ -20,95 +20,22 @@
 
 namespace parallax::renderer {
 
-    void UniformCache::setFloat(const std::string& name, float value)
+    bool UniformCache::isCached(const int location, const UniformValue& value) const
     {
-        const auto it = m_values.find(name);
-        if (it == m_values.end() || !std::holds_alternative<float>(it->second) || std::get<float>(it->second) != value) {
-            m_values[name] = value;
-            m_dirtyFlags[name] = true;
-        }
+        const auto index = static_cast<size_t>(location);
+        return index < m_values.size() && m_values[index].has_value() && *m_values[index] == value;
     }
 
-    void UniformCache::setFloat2(const std::string& name, const glm::vec2& value)
+    void UniformCache::store(const int location, const UniformValue& value)
     {
-        const auto it = m_values.find(name);
-        if (it == m_values.end() || !std::holds_alternative<glm::vec2>(it->second) || std::get<glm::vec2>(it->second) != value) {
-            m_values[name] = value;
-            m_dirtyFlags[name] = true;
-        }
+        const auto index = static_cast<size_t>(location);
+        if (index >= m_values.size())
+            m_values.resize(index + 1);
+        m_values[index] = value;
     }
 
-    void UniformCache::setFloat3(const std::string& name, const glm::vec3& value)
+    void UniformCache::clear()
     {
-        const auto it = m_values.find(name);
-        if (it == m_values.end() || !std::holds_alternative<glm::vec3>(it->second) || std::get<glm::vec3>(it->second) != value) {
-            m_values[name] = value;
-            m_dirtyFlags[name] = true;
-        }
-    }
-
-    void UniformCache::setFloat4(const std::string& name, const glm::vec4& value)
-    {
-        const auto it = m_values.find(name);
-        if (it == m_values.end() || !std::holds_alternative<glm::vec4>(it->second) || std::get<glm::vec4>(it->second) != value) {
-            m_values[name] = value;
-            m_dirtyFlags[name] = true;
-        }
-    }
-
-    void UniformCache::setInt(const std::string& name, int value)
-    {
-        const auto it = m_values.find(name);
-        if (it == m_values.end() || !std::holds_alternative<int>(it->second) || std::get<int>(it->second) != value) {
-            m_values[name] = value;
-            m_dirtyFlags[name] = true;
-        }
-    }
-
-    void UniformCache::setBool(const std::string& name, bool value)
-    {
-        const auto it = m_values.find(name);
-        if (it == m_values.end() || !std::holds_alternative<bool>(it->second) || std::get<bool>(it->second) != value) {
-            m_values[name] = value;
-            m_dirtyFlags[name] = true;
-        }
-    }
-
-    void UniformCache::setMatrix(const std::string& name, const glm::mat4& value)
-    {
-        const auto it = m_values.find(name);
-        if (it == m_values.end() || !std::holds_alternative<glm::mat4>(it->second) || std::get<glm::mat4>(it->second) != value) {
-            m_values[name] = value;
-            m_dirtyFlags[name] = true;
-        }
-    }
-
-    bool UniformCache::isDirty(const std::string& name) const
-    {
-        const auto it = m_dirtyFlags.find(name);
-        return it != m_dirtyFlags.end() && it->second;
-    }
-
-    bool UniformCache::hasValue(const std::string& name) const
-    {
-        return m_values.contains(name);
-    }
-
-    std::optional<UniformValue> UniformCache::getValue(const std::string& name) const
-    {
-        const auto it = m_values.find(name);
-        return (it != m_values.end()) ? std::optional<UniformValue>(it->second) : std::nullopt;
-    }
-
-    void UniformCache::clearDirtyFlag(const std::string& name)
-    {
-        m_dirtyFlags[name] = false;
-    }
-
-    void UniformCache::clearAllDirtyFlags()
-    {
-        for (auto& [name, dirty] : m_dirtyFlags) {
-            dirty = false;
-        }
+        m_values.clear();
     }
 }
@@ -17,8 +17,7 @@
 ///////////////////////////////////////////////////////////////////////////////
 #pragma once
 
-#include <string>
-#include <unordered_map>
+#include <vector>
 #include <variant>
 #include <glm/glm.hpp>
 #include <optional>
@@ -35,25 +34,35 @@ namespace parallax::renderer {
         glm::mat4
     >;
 
+    /**
+     * @class UniformCache
+     * @brief Last value uploaded to every uniform location of a shader program.
+     *
+     * Indexed by location, so that checking for a redundant upload is a plain array access.
+     */
     class UniformCache {
     public:
-        void setFloat(const std::string& name, float value);
-        void setFloat2(const std::string& name, const glm::vec2& value);
-        void setFloat3(const std::string& name, const glm::vec3& value);
-        void setFloat4(const std::string& name, const glm::vec4& value);
-        void setInt(const std::string& name, int value);
-        void setBool(const std::string& name, bool value);
-        void setMatrix(const std::string& name, const glm::mat4& value);
-
-        bool isDirty(const std::string& name) const;
-        bool hasValue(const std::string& name) const;
-        std::optional<UniformValue> getValue(const std::string& name) const;
-        void clearDirtyFlag(const std::string& name);
-        void clearAllDirtyFlags();
+        /**
+         * @brief Checks whether a location already holds a value
+         *
+         * @param location Location of the uniform in the program
+         * @param value Value about to be uploaded
+         * @return true if the exact same value was the last one uploaded, the upload can be skipped
+         */
+        bool isCached(int location, const UniformValue& value) const;
+
+        /**
+         * @brief Records the value just uploaded to a location
+         */
+        void store(int location, const UniformValue& value);
+
+        /**
+         * @brief Forgets every value, the next upload of each uniform goes through
+         */
+        void clear();
 
     private:
-        std::unordered_map<std::string, UniformValue> m_values;
-        std::unordered_map<std::string, bool> m_dirtyFlags;
+        std::vector<std::optional<UniformValue>> m_values;
     };
 
 }
@@ -0,0 +1,110 @@
+//// UniformRegistry.hpp //////////////////////////////////////////////////////
+//
+// ⢀⢀⢀⣤⣤⣤⡀⢀⢀⢀⢀⢀⢀⢠⣤⡄⢀⢀⢀⢀⣠⣤⣤⣤⣤⣤⣤⣤⣤⣤⡀⢀⢀⢀⢠⣤⣄⢀⢀⢀⢀⢀⢀⢀⣤⣤⢀⢀⢀⢀⢀⢀⢀⢀⣀⣄⢀⢀⢠⣄⣀⢀⢀⢀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⣿⣷⡀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡟⡛⡛⡛⡛⡛⡛⡛⢁⢀⢀⢀⢀⢻⣿⣦⢀⢀⢀⢀⢠⣾⡿⢃⢀⢀⢀⢀⢀⣠⣾⣿⢿⡟⢀⢀⡙⢿⢿⣿⣦⡀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⡛⣿⣷⡀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡙⣿⡷⢀⢀⣰⣿⡟⢁⢀⢀⢀⢀⢀⣾⣿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⣿⡆⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⡈⢿⣷⡄⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣇⣀⣀⣀⣀⣀⣀⣀⢀⢀⢀⢀⢀⢀⢀⡈⢀⢀⣼⣿⢏⢀⢀⢀⢀⢀⢀⣼⣿⡏⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡘⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⡈⢿⣿⡄⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣿⢿⢿⢿⢿⢿⢿⢿⢇⢀⢀⢀⢀⢀⢀⢀⢠⣾⣿⣧⡀⢀⢀⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⡈⢿⣿⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣰⣿⡟⡛⣿⣷⡄⢀⢀⢀⢀⢀⢿⣿⣇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⡈⢿⢀⢀⢸⣿⡇⢀⢀⢀⢀⡛⡟⢁⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⡟⢀⢀⡈⢿⣿⣄⢀⢀⢀⢀⡘⣿⣿⣄⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⢏⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⢀⣀⣀⣀⣀⣀⣀⣀⣀⣀⡀⢀⢀⢀⣠⣾⡿⢃⢀⢀⢀⢀⢀⢻⣿⣧⡀⢀⢀⢀⡈⢻⣿⣷⣦⣄⢀⢀⣠⣤⣶⣿⡿⢋⢀⢀⢀⢀
+// ⢀⢀⢀⢿⢿⢀⢀⢀⢀⢀⢀⢀⢀⢸⢿⢃⢀⢀⢀⢀⢻⢿⢿⢿⢿⢿⢿⢿⢿⢿⢃⢀⢀⢀⢿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⡗⢀⢀⢀⢀⢀⡈⡉⡛⡛⢀⢀⢹⡛⢋⢁⢀⢀⢀⢀⢀⢀
+//
+//  Author:      Parallax Engine Team
+//  Date:        16/10/2026
+//  Description: Header file for the interning table of uniform names
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <cstdint>
+#include <deque>
+#include <limits>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+namespace parallax::renderer {
+
+    struct TransparentStringHasher {
+        using is_transparent = void;  // enable heterogeneous lookup
+
+        size_t operator()(std::string_view sv) const noexcept {
+            return std::hash<std::string_view>{}(sv);
+        }
+        size_t operator()(const std::string &s) const noexcept {
+            return operator()(std::string_view(s));
+        }
+    };
+
+    /**
+     * @brief Integer identifier of an interned uniform name
+     *
+     * Handles are the same for every shader, each shader maps them to its own locations.
+     */
+    using UniformHandle = std::uint32_t;
+
+    /**
+     * @brief Special value representing a name that was never interned
+     */
+    constexpr UniformHandle INVALID_UNIFORM_HANDLE = std::numeric_limits<UniformHandle>::max();
+
+    /**
+     * @class UniformRegistry
+     * @brief Global table turning uniform names into dense integer handles.
+     *
+     * Every uniform found by shader reflection is interned, as are the names the render systems
+     * write, so that draw commands never carry or hash strings. Handles are never released.
+     * The registry is thread safe.
+     */
+    class UniformRegistry {
+        public:
+            static UniformRegistry &getInstance()
+            {
+                static UniformRegistry instance;
+                return instance;
+            }
+            UniformRegistry(UniformRegistry const&) = delete;
+            void operator=(UniformRegistry const&) = delete;
+
+            /**
+             * @brief Gets the handle of a name, interning it on first use
+             *
+             * @param name Full name of the uniform, as reported by reflection (e.g. "uPointLights[0].color")
+             * @return UniformHandle Handle of the name
+             */
+            UniformHandle intern(std::string_view name);
+
+            /**
+             * @brief Gets the handle of a name without interning it
+             *
+             * @param name Full name of the uniform
+             * @return UniformHandle Handle of the name, or INVALID_UNIFORM_HANDLE if it was never interned
+             */
+            UniformHandle find(std::string_view name) const;
+
+            /**
+             * @brief Gets the name behind a handle
+             *
+             * @param handle Handle returned by intern
+             * @return const std::string& Name of the uniform, valid for the whole program
+             */
+            const std::string &getName(UniformHandle handle) const;
+
+            /**
+             * @brief Gets the number of interned names, every handle is below it
+             */
+            size_t size() const;
+
+        private:
+            UniformRegistry() = default;
+            ~UniformRegistry() = default;
+
+            mutable std::shared_mutex m_mutex;
+            std::unordered_map<std::string, UniformHandle, TransparentStringHasher, std::equal_to<>> m_handles;
+            // Deque so that references returned by getName survive later insertions
+            std::deque<std::string> m_names;
+    };
+}
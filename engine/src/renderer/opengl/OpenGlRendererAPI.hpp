@@ -128,6 +128,23 @@ namespace parallax::renderer {
              */
             void drawIndexed(const std::shared_ptr<NxVertexArray> &vertexArray, size_t indexCount = 0) override;
 
+            /**
+             * @brief Draws several instances of indexed geometry with a single draw call.
+             *
+             * Issues a draw call rendering `instanceCount` instances of the geometry stored in the specified
+             * `NxVertexArray`. Shaders tell the instances apart with `gl_InstanceID`.
+             *
+             * @param vertexArray A shared pointer to the `NxVertexArray` containing vertex and index data.
+             * @param indexCount The number of indices to draw per instance. If zero, all indices in the buffer are used.
+             * @param instanceCount The number of instances to draw.
+             *
+             * Throws:
+             * - NxGraphicsApiNotInitialized if OpenGL is not initialized.
+             * - NxInvalidValue if the `vertexArray` is null.
+             */
+            void drawIndexedInstanced(const std::shared_ptr<NxVertexArray> &vertexArray, size_t indexCount,
+                                      size_t instanceCount) override;
+
             void drawUnIndexed(size_t verticesCount) override;
 
             void setStencilTest(bool enable) override;
@@ -123,6 +123,18 @@ namespace parallax::renderer {
         glDrawElements(GL_TRIANGLES, static_cast<int>(count), GL_UNSIGNED_INT, nullptr);
     }
 
+    void NxOpenGlRendererApi::drawIndexedInstanced(const std::shared_ptr<NxVertexArray> &vertexArray,
+                                                   const size_t indexCount, const size_t instanceCount)
+    {
+        if (!m_initialized)
+            THROW_EXCEPTION(NxGraphicsApiNotInitialized, "OPENGL");
+        if (!vertexArray)
+            THROW_EXCEPTION(NxInvalidValue, "OPENGL", "Vertex array cannot be null");
+        const size_t count = indexCount ? indexCount : vertexArray->getIndexBuffer()->getCount();
+        glDrawElementsInstanced(GL_TRIANGLES, static_cast<int>(count), GL_UNSIGNED_INT, nullptr,
+                                static_cast<int>(instanceCount));
+    }
+
     void NxOpenGlRendererApi::drawUnIndexed(size_t verticesCount)
     {
         if (!m_initialized)
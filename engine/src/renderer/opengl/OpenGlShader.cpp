@@ -24,6 +24,7 @@
 #include "OpenGlShaderReflection.hpp"
 
 #include <array>
+#include <variant>
 #include <vector>
 #include <glm/gtc/type_ptr.hpp>
 
@@ -188,6 +189,7 @@ namespace parallax::renderer {
     {
         m_uniformInfos = ShaderReflection::reflectUniforms(m_id);
         m_attributeInfos = ShaderReflection::reflectAttributes(m_id);
+        setupUniformHandles();
 
         static const std::unordered_map<std::string, std::function<void(RequiredAttributes&)>> attributeMappers = {
             {"aPos", [](RequiredAttributes& attrs) { attrs.bitsUnion.flags.position = true; }},
@@ -215,252 +217,29 @@ namespace parallax::renderer {
         glUseProgram(0);
     }
 
-    int NxOpenGlShader::getUniformLocation(const std::string& name) const {
-        const auto it = m_uniformInfos.find(name);
-        if (it != m_uniformInfos.end()) {
-            return it->second.location;
-        }
-        return glGetUniformLocation(m_id, name.c_str());
-    }
-
-    bool NxOpenGlShader::setUniformFloat(const std::string& name, const float value) const
-    {
-        if (!NxShader::hasUniform(name))
-            return false;
-        if (NxShader::setUniformFloat(name, value))
-            return true; // Value was cached, no need to update
-
-        const int location = getUniformLocation(name);
-        if (location == -1) {
-            LOG(PARALLAX_WARN, "For shader {}, uniform {} not found", m_name, name);
-            return false;
-        }
-        glUniform1f(location, value);
-        m_uniformCache.clearDirtyFlag(name);
-        return true;
-    }
-
-    bool NxOpenGlShader::setUniformFloat(const NxShaderUniforms uniform, const float value) const
+    void NxOpenGlShader::uploadUniform(const int location, const UniformValue &value) const
     {
-        const std::string &name = ShaderUniformsName.at(uniform);
-        if (!NxShader::hasUniform(name))
-            return false;
-        if (NxShader::setUniformFloat(name, value))
-            return true;
-
-        const int location = getUniformLocation(name);
-        if (location == -1) {
-            LOG(PARALLAX_WARN, "For shader {}, uniform {} not found", m_name, name);
-            return false;
-        }
-        glUniform1f(location, value);
-        m_uniformCache.clearDirtyFlag(name);
-        return true;
+        std::visit([location]<typename T>(const T &arg) {
+            if constexpr (std::is_same_v<T, float>)
+                glUniform1f(location, arg);
+            else if constexpr (std::is_same_v<T, glm::vec2>)
+                glUniform2f(location, arg.x, arg.y);
+            else if constexpr (std::is_same_v<T, glm::vec3>)
+                glUniform3f(location, arg.x, arg.y, arg.z);
+            else if constexpr (std::is_same_v<T, glm::vec4>)
+                glUniform4f(location, arg.x, arg.y, arg.z, arg.w);
+            else if constexpr (std::is_same_v<T, int>)
+                glUniform1i(location, arg);
+            else if constexpr (std::is_same_v<T, bool>)
+                glUniform1i(location, static_cast<int>(arg));
+            else if constexpr (std::is_same_v<T, glm::mat4>)
+                glUniformMatrix4fv(location, 1, GL_FALSE, &arg[0][0]);
+        }, value);
     }
 
-    bool NxOpenGlShader::setUniformFloat2(const std::string& name, const glm::vec2& values) const
+    void NxOpenGlShader::uploadUniformIntArray(const int location, const int *values, const unsigned int count) const
     {
-        if (!NxShader::hasUniform(name))
-            return false;
-        if (NxShader::setUniformFloat2(name, values))
-            return true;
-
-        const int location = getUniformLocation(name);
-        if (location == -1) {
-            LOG(PARALLAX_WARN, "For shader {}, uniform {} not found", m_name, name);
-            return false;
-        }
-        glUniform2f(location, values.x, values.y);
-        m_uniformCache.clearDirtyFlag(name);
-        return true;
-    }
-
-    bool NxOpenGlShader::setUniformFloat3(const std::string& name, const glm::vec3& values) const
-    {
-        if (!NxShader::hasUniform(name))
-            return false;
-        if (NxShader::setUniformFloat3(name, values))
-            return true;
-
-        const int location = getUniformLocation(name);
-        if (location == -1) {
-            LOG(PARALLAX_WARN, "For shader {}, uniform {} not found", m_name, name);
-            return false;
-        }
-        glUniform3f(location, values.x, values.y, values.z);
-        m_uniformCache.clearDirtyFlag(name);
-        return true;
-    }
-
-    bool NxOpenGlShader::setUniformFloat3(const NxShaderUniforms uniform, const glm::vec3 &values) const
-    {
-        const std::string &name = ShaderUniformsName.at(uniform);
-        if (!NxShader::hasUniform(name))
-            return false;
-        if (NxShader::setUniformFloat3(name, values))
-            return true;
-
-        const int location = getUniformLocation(name);
-        if (location == -1) {
-            LOG(PARALLAX_WARN, "For shader {}, uniform {} not found", m_name, name);
-            return false;
-        }
-        glUniform3f(location, values.x, values.y, values.z);
-        m_uniformCache.clearDirtyFlag(name);
-        return true;
-    }
-
-    bool NxOpenGlShader::setUniformFloat4(const std::string& name, const glm::vec4& values) const
-    {
-        if (!NxShader::hasUniform(name))
-            return false;
-        if (NxShader::setUniformFloat4(name, values))
-            return true;
-
-        const int location = getUniformLocation(name);
-        if (location == -1) {
-            LOG(PARALLAX_WARN, "For shader {}, uniform {} not found", m_name, name);
-            return false;
-        }
-        glUniform4f(location, values.x, values.y, values.z, values.w);
-        m_uniformCache.clearDirtyFlag(name);
-        return true;
-    }
-
-    bool NxOpenGlShader::setUniformFloat4(const NxShaderUniforms uniform, const glm::vec4 &values) const
-    {
-        const std::string &name = ShaderUniformsName.at(uniform);
-        if (!NxShader::hasUniform(name))
-            return false;
-        if (NxShader::setUniformFloat4(name, values))
-            return true;
-
-        const int location = getUniformLocation(name);
-        if (location == -1) {
-            LOG(PARALLAX_WARN, "For shader {}, uniform {} not found", m_name, name);
-            return false;
-        }
-        glUniform4f(location, values.x, values.y, values.z, values.w);
-        m_uniformCache.clearDirtyFlag(name);
-        return true;
-    }
-
-    bool NxOpenGlShader::setUniformMatrix(const std::string& name, const glm::mat4& matrix) const
-    {
-        if (!NxShader::hasUniform(name))
-            return false;
-        if (NxShader::setUniformMatrix(name, matrix))
-            return true;
-
-        const int location = getUniformLocation(name);
-        if (location == -1) {
-            LOG(PARALLAX_WARN, "For shader {}, uniform {} not found", m_name, name);
-            return false;
-        }
-        glUniformMatrix4fv(location, 1, GL_FALSE, &matrix[0][0]);
-        m_uniformCache.clearDirtyFlag(name);
-        return true;
-    }
-
-    bool NxOpenGlShader::setUniformMatrix(const NxShaderUniforms uniform, const glm::mat4 &matrix) const
-    {
-        const std::string &name = ShaderUniformsName.at(uniform);
-        if (!NxShader::hasUniform(name))
-            return false;
-        if (NxShader::setUniformMatrix(name, matrix))
-            return true;
-
-        const int location = getUniformLocation(name);
-        if (location == -1) {
-            LOG(PARALLAX_WARN, "For shader {}, uniform {} not found", m_name, name);
-            return false;
-        }
-        glUniformMatrix4fv(location, 1, GL_FALSE, &matrix[0][0]);
-        m_uniformCache.clearDirtyFlag(name);
-        return true;
-    }
-
-    bool NxOpenGlShader::setUniformInt(const std::string& name, int value) const
-    {
-        if (!NxShader::hasUniform(name))
-            return false;
-        if (NxShader::setUniformInt(name, value))
-            return true;
-
-        const int location = getUniformLocation(name);
-        if (location == -1) {
-            LOG(PARALLAX_WARN, "For shader {}, uniform {} not found", m_name, name);
-            return false;
-        }
-        glUniform1i(location, value);
-        m_uniformCache.clearDirtyFlag(name);
-        return true;
-    }
-
-    bool NxOpenGlShader::setUniformBool(const std::string& name, bool value) const
-    {
-        if (!NxShader::hasUniform(name))
-            return false;
-        if (NxShader::setUniformBool(name, value))
-            return true;
-
-        const int location = getUniformLocation(name);
-        if (location == -1) {
-            LOG(PARALLAX_WARN, "For shader {}, uniform {} not found", m_name, name);
-            return false;
-        }
-        glUniform1i(location, static_cast<int>(value));
-        m_uniformCache.clearDirtyFlag(name);
-        return true;
-    }
-
-    bool NxOpenGlShader::setUniformInt(const NxShaderUniforms uniform, const int value) const
-    {
-        const std::string &name = ShaderUniformsName.at(uniform);
-        if (!NxShader::hasUniform(name))
-            return false;
-        if (NxShader::setUniformInt(name, value))
-            return true;
-
-        const int location = getUniformLocation(name);
-        if (location == -1) {
-            LOG(PARALLAX_WARN, "For shader {}, uniform {} not found", m_name, name);
-            return false;
-        }
-        glUniform1i(location, value);
-        m_uniformCache.clearDirtyFlag(name);
-        return true;
-    }
-
-    bool NxOpenGlShader::setUniformIntArray(const std::string &name, const int *values, const unsigned int count) const
-    {
-        if (!NxShader::hasUniform(name))
-            return false;
-
-        const int location = getUniformLocation(name);
-        if (location == -1) {
-            LOG(PARALLAX_WARN, "For shader {}, uniform {} not found", m_name, name);
-            return false;
-        }
-
-        glUniform1iv(location, static_cast<int>(count), values);
-        return true;
-    }
-
-    bool NxOpenGlShader::setUniformIntArray(const NxShaderUniforms uniform, const int *values, const unsigned int count) const
-    {
-        const std::string &name = ShaderUniformsName.at(uniform);
-        if (!NxShader::hasUniform(name))
-            return false;
-
-        const int location = getUniformLocation(name);
-        if (location == -1) {
-            LOG(PARALLAX_WARN, "For shader {}, uniform {} not found", m_name, name);
-            return false;
-        }
-
         glUniform1iv(location, static_cast<int>(count), values);
-        return true;
     }
 
     void NxOpenGlShader::bindStorageBuffer(const unsigned int index) const
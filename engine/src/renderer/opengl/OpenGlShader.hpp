@@ -32,7 +32,7 @@ namespace parallax::renderer {
     *
     * Responsibilities:
     * - Compile and link shader programs using OpenGL.
-    * - Set uniform variables for rendering operations.
+    * - Upload uniform variables for rendering operations.
     * - Manage the lifecycle of OpenGL shader programs.
     */
     class NxOpenGlShader final : public NxShader {
@@ -61,22 +61,6 @@ namespace parallax::renderer {
             void bind() const override;
             void unbind() const override;
 
-            bool setUniformFloat(const std::string &name, float value) const override;
-            bool setUniformFloat2(const std::string &name, const glm::vec2 &values) const override;
-            bool setUniformFloat3(const std::string &name, const glm::vec3 &values) const override;
-            bool setUniformFloat4(const std::string &name, const glm::vec4 &values) const override;
-            bool setUniformMatrix(const std::string &name, const glm::mat4 &matrix) const override;
-            bool setUniformBool(const std::string &name, bool value) const override;
-            bool setUniformInt(const std::string &name, int value) const override;
-            bool setUniformIntArray(const std::string &name, const int *values, unsigned int count) const override;
-
-            bool setUniformFloat(NxShaderUniforms uniform, float value) const override;
-            bool setUniformFloat3(NxShaderUniforms uniform, const glm::vec3 &values) const override;
-            bool setUniformFloat4(NxShaderUniforms uniform, const glm::vec4 &values) const override;
-            bool setUniformMatrix(NxShaderUniforms uniform, const glm::mat4 &matrix) const override;
-            bool setUniformInt(NxShaderUniforms uniform, int value) const override;
-            bool setUniformIntArray(NxShaderUniforms uniform, const int *values, unsigned int count) const override;
-
             void bindStorageBuffer(unsigned int index) const override;
             void bindStorageBufferBase(unsigned int index, unsigned int bindingLocation) const override;
             void unbindStorageBuffer(unsigned int index) const override;
@@ -91,7 +75,9 @@ namespace parallax::renderer {
             static std::unordered_map<GLenum, std::string> preProcess(const std::string_view &src, const std::string &filePath);
             void compile(const std::unordered_map<GLenum, std::string> &shaderSources);
             void setupUniformLocations();
-            int getUniformLocation(const std::string& name) const;
+
+            void uploadUniform(int location, const UniformValue &value) const override;
+            void uploadUniformIntArray(int location, const int *values, unsigned int count) const override;
     };
 
 }
@@ -40,6 +40,7 @@ namespace parallax::renderer {
         glGetProgramiv(programId, GL_ACTIVE_UNIFORM_MAX_LENGTH, &maxNameLength);
 
         std::vector<char> nameBuffer(maxNameLength);
+        UniformRegistry &registry = UniformRegistry::getInstance();
 
         for (int i = 0; i < uniformCount; i++) {
             UniformInfo info;
@@ -48,6 +49,8 @@ namespace parallax::renderer {
 
             info.name = std::string(nameBuffer.data(), nameLength);
             info.location = glGetUniformLocation(programId, info.name.c_str());
+            // Interned here so that draw commands only ever deal with handles
+            info.handle = registry.intern(info.name);
 
             // Store the uniform with original name
             uniforms[info.name] = info;
@@ -63,6 +66,7 @@ namespace parallax::renderer {
                     // For arrays, the base name location is the same as the first element
                     UniformInfo baseInfo = info;
                     baseInfo.name = baseName;
+                    baseInfo.handle = registry.intern(baseName);
                     uniforms[baseName] = baseInfo;
                 }
             }
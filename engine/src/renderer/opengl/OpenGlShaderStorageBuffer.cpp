@@ -28,6 +28,11 @@ namespace parallax::renderer {
 		glBindBuffer(GL_SHADER_STORAGE_BUFFER, 0);
 	}
 
+	NxOpenGlShaderStorageBuffer::~NxOpenGlShaderStorageBuffer()
+	{
+		glDeleteBuffers(1, &m_id);
+	}
+
 	void NxOpenGlShaderStorageBuffer::bind() const
 	{
 		glBindBuffer(GL_SHADER_STORAGE_BUFFER, m_id);
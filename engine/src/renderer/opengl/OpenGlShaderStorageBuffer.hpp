@@ -23,7 +23,7 @@ namespace parallax::renderer {
 	class NxOpenGlShaderStorageBuffer final : public NxShaderStorageBuffer {
 	public:
 		explicit NxOpenGlShaderStorageBuffer(unsigned int size);
-		~NxOpenGlShaderStorageBuffer() override = default;
+		~NxOpenGlShaderStorageBuffer() override;
 
 		void bind() const override;
 		void bindBase(unsigned int bindingLocation) const override;
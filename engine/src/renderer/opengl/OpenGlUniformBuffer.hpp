@@ -1,4 +1,4 @@
-//// TransformHierarchySystem.hpp ///////////////////////////////////////////////////////////////
+//// OpenGlUniformBuffer.hpp //////////////////////////////////////////////////
 //
 // ⢀⢀⢀⣤⣤⣤⡀⢀⢀⢀⢀⢀⢀⢠⣤⡄⢀⢀⢀⢀⣠⣤⣤⣤⣤⣤⣤⣤⣤⣤⡀⢀⢀⢀⢠⣤⣄⢀⢀⢀⢀⢀⢀⢀⣤⣤⢀⢀⢀⢀⢀⢀⢀⢀⣀⣄⢀⢀⢠⣄⣀⢀⢀⢀⢀⢀⢀⢀
 // ⢀⢀⢀⣿⣿⣿⣷⡀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡟⡛⡛⡛⡛⡛⡛⡛⢁⢀⢀⢀⢀⢻⣿⣦⢀⢀⢀⢀⢠⣾⡿⢃⢀⢀⢀⢀⢀⣠⣾⣿⢿⡟⢀⢀⡙⢿⢿⣿⣦⡀⢀⢀⢀⢀
@@ -10,48 +10,32 @@
 // ⢀⢀⢀⣿⣿⢀⢀⢀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⢀⣀⣀⣀⣀⣀⣀⣀⣀⣀⡀⢀⢀⢀⣠⣾⡿⢃⢀⢀⢀⢀⢀⢻⣿⣧⡀⢀⢀⢀⡈⢻⣿⣷⣦⣄⢀⢀⣠⣤⣶⣿⡿⢋⢀⢀⢀⢀
 // ⢀⢀⢀⢿⢿⢀⢀⢀⢀⢀⢀⢀⢀⢸⢿⢃⢀⢀⢀⢀⢻⢿⢿⢿⢿⢿⢿⢿⢿⢿⢃⢀⢀⢀⢿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⡗⢀⢀⢀⢀⢀⡈⡉⡛⡛⢀⢀⢹⡛⢋⢁⢀⢀⢀⢀⢀⢀
 //
-//  Author:      Mehdy MORVAN
-//  Date:        14/05/2025
-//  Description: Header file for the transform hierarchy system
+//  Author:      Parallax Engine Team
+//  Date:        16/10/2026
+//  Description: Header file for the opengl implementation of uniform buffer objects
 //
 ///////////////////////////////////////////////////////////////////////////////
 #pragma once
 
-#include "components/Model.hpp"
-#include "components/Parent.hpp"
-#include "ecs/GroupSystem.hpp"
-#include "components/Transform.hpp"
-#include "components/SceneComponents.hpp"
-#include "components/RenderContext.hpp"
+#include "renderer/UniformBuffer.hpp"
 
-namespace parallax::system {
-    /**
-     * @class TransformHierarchySystem
-     * @brief System that handles hierarchical transformations for entities with parents.
-     *
-     * This system updates the transforms of entities with parent relationships,
-     * ensuring child entities inherit the transformations of their parents.
-     */
-     class TransformHierarchySystem final : public ecs::GroupSystem<
-		ecs::Owned<
-	        ecs::Read<components::RootComponent>>,
-        ecs::NonOwned<
-            ecs::Write<components::TransformComponent>,
-           	ecs::Read<components::SceneTag>>,
-        ecs::WriteSingleton<components::RenderContext>> {
-			public:
-                void update();
-            private:
-                /**
-                    * @brief Recursively updates transforms of child entities based on parent transform
-                    *
-                    * @param children Vector of child indices to process
-                    * @param parentTransform The parent's transform component
-                    */
-                void updateChildTransforms(
-                    const std::shared_ptr<ecs::ComponentArray<components::TransformComponent>> &transformComponentArray,
-                    const std::vector<ecs::Entity>& children,
-                    const glm::mat4& parentWorldMatrix);
-                [[nodiscard]] glm::mat4 calculateLocalMatrix(const components::TransformComponent& transform) const;
+namespace parallax::renderer {
+	class NxOpenGlUniformBuffer final : public NxUniformBuffer {
+	public:
+		explicit NxOpenGlUniformBuffer(unsigned int size);
+		~NxOpenGlUniformBuffer() override;
+
+		void bind() const override;
+		void bindBase(unsigned int bindingLocation) const override;
+		void unbind() const override;
+
+		void setData(const void* data, size_t size) override;
+
+		[[nodiscard]] unsigned int getSize() const override { return m_size; };
+		[[nodiscard]] unsigned int getId() const override { return m_id; };
+
+	private:
+		unsigned int m_id{};
+		unsigned int m_size = 0;
 	};
 }
@@ -22,6 +22,33 @@ using System.Runtime.InteropServices;
 namespace Parallax.Components
 {
 
+    /// <summary>
+    /// Affine matrix stored as its four columns without the constant (0, 0, 0, 1) row,
+    /// matching glm::mat4x3 on the native side.
+    /// </summary>
+    [StructLayout(LayoutKind.Sequential)]
+    public struct AffineMatrix
+    {
+        public Vector3 column0;
+        public Vector3 column1;
+        public Vector3 column2;
+        public Vector3 column3;
+
+        public Matrix4x4 ToMatrix4x4()
+        {
+            return new Matrix4x4(
+                column0.X, column0.Y, column0.Z, 0.0f,
+                column1.X, column1.Y, column1.Z, 0.0f,
+                column2.X, column2.Y, column2.Z, 0.0f,
+                column3.X, column3.Y, column3.Z, 1.0f);
+        }
+
+        public override string ToString()
+        {
+            return ToMatrix4x4().ToString();
+        }
+    }
+
     [StructLayout(LayoutKind.Sequential)]
     public struct Transform
     {
@@ -29,13 +56,8 @@ namespace Parallax.Components
         public Vector3 size;
         public Quaternion quat;
         
-        public Matrix4x4 worldMatrix;
-        public Matrix4x4 localMatrix;
-
-        public Vector3 localCenter;
-
-        // Note: children is a C++ vector class, it cannot be directly represented in C#.
-        // TODO: Find a way to handle vectors and lists between C++ and C#.
+        public AffineMatrix worldMatrix;
+        public AffineMatrix localMatrix;
     }
 
 }
@@ -29,6 +29,12 @@
 
 namespace parallax::system {
 
+	CameraContextSystem::CameraContextSystem()
+		: m_scenePartition(m_group->getPartitionHandle<components::SceneTag, unsigned int>(
+			[](const components::SceneTag& tag) { return tag.id; }))
+	{
+	}
+
 	void CameraContextSystem::update()
 	{
 		auto &renderContext = getSingleton<components::RenderContext>();
@@ -37,9 +43,7 @@ namespace parallax::system {
 
 		const auto sceneRendered = static_cast<unsigned int>(renderContext.sceneRendered);
 
-		const auto scenePartition = m_group->getPartitionView<components::SceneTag, unsigned int>(
-			[](const components::SceneTag& tag) { return tag.id; }
-		);
+		const auto scenePartition = m_group->getPartitionView(m_scenePartition);
 
 		const auto *partition = scenePartition.getPartition(sceneRendered);
 
@@ -66,6 +70,8 @@ namespace parallax::system {
 			glm::mat4 viewMatrix = cameraComponent.getViewMatrix(transformComponent);
 			const glm::mat4 viewProjectionMatrix = projectionMatrix * viewMatrix;
 			components::CameraContext context{viewProjectionMatrix, transformComponent.pos, cameraComponent.clearColor, cameraComponent.m_renderTarget, cameraComponent.pipeline};
+			context.entity = entitySpan[i];
+			context.frustum = math::extractFrustum(viewProjectionMatrix);
 			renderContext.cameras.push_back(context);
 		}
 	}
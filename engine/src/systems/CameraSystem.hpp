@@ -40,7 +40,7 @@ namespace parallax::system {
 	*  - READ access to components::CameraComponent (owned)
 	*  - READ access to components::SceneTag (non-owned)
 	*  - READ access to components::TransformComponent (non-owned)
-	*  - WRITE access to components::RenderContext (singleton)
+	*  - WRITE access to components::RenderContext (singleton, cameras part)
 	*
 	* @note The system uses scene partitioning to only process camera entities belonging to the
 	* currently active scene (identified by RenderContext.sceneRendered).
@@ -51,9 +51,13 @@ namespace parallax::system {
         ecs::NonOwned<
         	ecs::Read<components::SceneTag>,
          	ecs::Read<components::TransformComponent>>,
-    	ecs::WriteSingleton<components::RenderContext>> {
+    	ecs::WriteSingleton<components::RenderContext, components::RenderContext::CamerasPart>> {
 		public:
+			CameraContextSystem();
 			void update();
+
+		private:
+			ecs::PartitionHandle<unsigned int> m_scenePartition; ///< Partitioning of the group by scene ID
 	};
 
 	/**
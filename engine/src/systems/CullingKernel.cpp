@@ -0,0 +1,142 @@
+//// CullingKernel.cpp ////////////////////////////////////////////////////////
+//
+// ⢀⢀⢀⣤⣤⣤⡀⢀⢀⢀⢀⢀⢀⢠⣤⡄⢀⢀⢀⢀⣠⣤⣤⣤⣤⣤⣤⣤⣤⣤⡀⢀⢀⢀⢠⣤⣄⢀⢀⢀⢀⢀⢀⢀⣤⣤⢀⢀⢀⢀⢀⢀⢀⢀⣀⣄⢀⢀⢠⣄⣀⢀⢀⢀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⣿⣷⡀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡟⡛⡛⡛⡛⡛⡛⡛⢁⢀⢀⢀⢀⢻⣿⣦⢀⢀⢀⢀⢠⣾⡿⢃⢀⢀⢀⢀⢀⣠⣾⣿⢿⡟⢀⢀⡙⢿⢿⣿⣦⡀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⡛⣿⣷⡀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡙⣿⡷⢀⢀⣰⣿⡟⢁⢀⢀⢀⢀⢀⣾⣿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⣿⡆⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⡈⢿⣷⡄⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣇⣀⣀⣀⣀⣀⣀⣀⢀⢀⢀⢀⢀⢀⢀⡈⢀⢀⣼⣿⢏⢀⢀⢀⢀⢀⢀⣼⣿⡏⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡘⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⡈⢿⣿⡄⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣿⢿⢿⢿⢿⢿⢿⢿⢇⢀⢀⢀⢀⢀⢀⢀⢠⣾⣿⣧⡀⢀⢀⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⡈⢿⣿⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣰⣿⡟⡛⣿⣷⡄⢀⢀⢀⢀⢀⢿⣿⣇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⡈⢿⢀⢀⢸⣿⡇⢀⢀⢀⢀⡛⡟⢁⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⡟⢀⢀⡈⢿⣿⣄⢀⢀⢀⢀⡘⣿⣿⣄⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⢏⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⢀⣀⣀⣀⣀⣀⣀⣀⣀⣀⡀⢀⢀⢀⣠⣾⡿⢃⢀⢀⢀⢀⢀⢻⣿⣧⡀⢀⢀⢀⡈⢻⣿⣷⣦⣄⢀⢀⣠⣤⣶⣿⡿⢋⢀⢀⢀⢀
+// ⢀⢀⢀⢿⢿⢀⢀⢀⢀⢀⢀⢀⢀⢸⢿⢃⢀⢀⢀⢀⢻⢿⢿⢿⢿⢿⢿⢿⢿⢿⢃⢀⢀⢀⢿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⡗⢀⢀⢀⢀⢀⡈⡉⡛⡛⢀⢀⢹⡛⢋⢁⢀⢀⢀⢀⢀⢀
+//
+//  Author:      Parallax Engine Team
+//  Date:        16/10/2026
+//  Description: Source file for the frustum culling kernel
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include "CullingKernel.hpp"
+#include "renderer/RendererExceptions.hpp"
+
+#if defined(__x86_64__) || defined(_M_X64)
+    #define PARALLAX_CULLING_KERNEL_X86 1
+    #include <immintrin.h>
+#else
+    #define PARALLAX_CULLING_KERNEL_X86 0
+#endif
+
+namespace parallax::system {
+    namespace {
+        std::size_t cullScalar(const math::Frustum &frustum, const WorldBounds &bounds,
+                               const std::span<std::uint8_t> visible, const std::size_t begin)
+        {
+            std::size_t visibleCount = 0;
+            for (std::size_t i = begin; i < bounds.size(); ++i) {
+                bool outside = false;
+                for (const glm::vec4 &plane : frustum.planes) {
+                    const float distance = plane.x * bounds.centerX[i] + plane.y * bounds.centerY[i] +
+                                           plane.z * bounds.centerZ[i] + plane.w;
+                    const float radius = std::abs(plane.x) * bounds.extentX[i] + std::abs(plane.y) * bounds.extentY[i] +
+                                         std::abs(plane.z) * bounds.extentZ[i];
+                    // Written as a sum so that infinite boxes against null plane components (NaN) are kept
+                    outside |= distance + radius < 0.0f;
+                }
+                visible[i] = outside ? 0 : 1;
+                visibleCount += !outside;
+            }
+            return visibleCount;
+        }
+
+#if PARALLAX_CULLING_KERNEL_X86
+        std::size_t cullSse(const math::Frustum &frustum, const WorldBounds &bounds, const std::span<std::uint8_t> visible)
+        {
+            const __m128 zero = _mm_setzero_ps();
+            const std::size_t count = bounds.size();
+            std::size_t visibleCount = 0;
+
+            std::size_t i = 0;
+            for (; i + 4 <= count; i += 4) {
+                // One lane per box
+                const __m128 cx = _mm_loadu_ps(bounds.centerX.data() + i);
+                const __m128 cy = _mm_loadu_ps(bounds.centerY.data() + i);
+                const __m128 cz = _mm_loadu_ps(bounds.centerZ.data() + i);
+                const __m128 ex = _mm_loadu_ps(bounds.extentX.data() + i);
+                const __m128 ey = _mm_loadu_ps(bounds.extentY.data() + i);
+                const __m128 ez = _mm_loadu_ps(bounds.extentZ.data() + i);
+
+                __m128 outside = zero;
+                for (const glm::vec4 &plane : frustum.planes) {
+                    const __m128 nx = _mm_set1_ps(plane.x);
+                    const __m128 ny = _mm_set1_ps(plane.y);
+                    const __m128 nz = _mm_set1_ps(plane.z);
+                    const __m128 distance = _mm_add_ps(
+                        _mm_add_ps(_mm_add_ps(_mm_mul_ps(nx, cx), _mm_mul_ps(ny, cy)), _mm_mul_ps(nz, cz)),
+                        _mm_set1_ps(plane.w));
+                    const __m128 radius = _mm_add_ps(
+                        _mm_add_ps(_mm_mul_ps(_mm_set1_ps(std::abs(plane.x)), ex),
+                                   _mm_mul_ps(_mm_set1_ps(std::abs(plane.y)), ey)),
+                        _mm_mul_ps(_mm_set1_ps(std::abs(plane.z)), ez));
+                    outside = _mm_or_ps(outside, _mm_cmplt_ps(_mm_add_ps(distance, radius), zero));
+                }
+
+                const int outsideBits = _mm_movemask_ps(outside);
+                for (int lane = 0; lane < 4; ++lane) {
+                    const bool isVisible = !(outsideBits & (1 << lane));
+                    visible[i + lane] = isVisible ? 1 : 0;
+                    visibleCount += isVisible;
+                }
+            }
+            return visibleCount + cullScalar(frustum, bounds, visible, i);
+        }
+#endif
+    }
+
+    CullingKernelPath bestCullingKernelPath()
+    {
+#if PARALLAX_CULLING_KERNEL_X86
+        // SSE2 is part of every x86-64 CPU
+        return CullingKernelPath::Sse;
+#else
+        return CullingKernelPath::Scalar;
+#endif
+    }
+
+    void WorldBounds::reserve(const std::size_t count)
+    {
+        centerX.reserve(count);
+        centerY.reserve(count);
+        centerZ.reserve(count);
+        extentX.reserve(count);
+        extentY.reserve(count);
+        extentZ.reserve(count);
+    }
+
+    void WorldBounds::add(const math::AABB &localBounds, const glm::mat4x3 &worldMatrix)
+    {
+        const math::CenterExtents world = math::transformBounds(localBounds, worldMatrix);
+        centerX.push_back(world.center.x);
+        centerY.push_back(world.center.y);
+        centerZ.push_back(world.center.z);
+        extentX.push_back(world.extents.x);
+        extentY.push_back(world.extents.y);
+        extentZ.push_back(world.extents.z);
+    }
+
+    std::size_t cullBounds(const math::Frustum &frustum, const WorldBounds &bounds, const std::span<std::uint8_t> visible,
+                           const CullingKernelPath path)
+    {
+        // The last box would be written past the end of visible
+        if (visible.size() < bounds.size())
+            THROW_EXCEPTION(renderer::NxOutOfRangeException, bounds.size() - 1, visible.size());
+
+        switch (path) {
+#if PARALLAX_CULLING_KERNEL_X86
+            case CullingKernelPath::Sse:
+                return cullSse(frustum, bounds, visible);
+#endif
+            default:
+                return cullScalar(frustum, bounds, visible, 0);
+        }
+    }
+}
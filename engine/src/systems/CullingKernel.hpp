@@ -0,0 +1,88 @@
+//// CullingKernel.hpp ////////////////////////////////////////////////////////
+//
+// ⢀⢀⢀⣤⣤⣤⡀⢀⢀⢀⢀⢀⢀⢠⣤⡄⢀⢀⢀⢀⣠⣤⣤⣤⣤⣤⣤⣤⣤⣤⡀⢀⢀⢀⢠⣤⣄⢀⢀⢀⢀⢀⢀⢀⣤⣤⢀⢀⢀⢀⢀⢀⢀⢀⣀⣄⢀⢀⢠⣄⣀⢀⢀⢀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⣿⣷⡀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡟⡛⡛⡛⡛⡛⡛⡛⢁⢀⢀⢀⢀⢻⣿⣦⢀⢀⢀⢀⢠⣾⡿⢃⢀⢀⢀⢀⢀⣠⣾⣿⢿⡟⢀⢀⡙⢿⢿⣿⣦⡀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⡛⣿⣷⡀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡙⣿⡷⢀⢀⣰⣿⡟⢁⢀⢀⢀⢀⢀⣾⣿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⣿⡆⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⡈⢿⣷⡄⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣇⣀⣀⣀⣀⣀⣀⣀⢀⢀⢀⢀⢀⢀⢀⡈⢀⢀⣼⣿⢏⢀⢀⢀⢀⢀⢀⣼⣿⡏⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡘⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⡈⢿⣿⡄⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣿⢿⢿⢿⢿⢿⢿⢿⢇⢀⢀⢀⢀⢀⢀⢀⢠⣾⣿⣧⡀⢀⢀⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⡈⢿⣿⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣰⣿⡟⡛⣿⣷⡄⢀⢀⢀⢀⢀⢿⣿⣇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⡈⢿⢀⢀⢸⣿⡇⢀⢀⢀⢀⡛⡟⢁⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⡟⢀⢀⡈⢿⣿⣄⢀⢀⢀⢀⡘⣿⣿⣄⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⢏⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⢀⣀⣀⣀⣀⣀⣀⣀⣀⣀⡀⢀⢀⢀⣠⣾⡿⢃⢀⢀⢀⢀⢀⢻⣿⣧⡀⢀⢀⢀⡈⢻⣿⣷⣦⣄⢀⢀⣠⣤⣶⣿⡿⢋⢀⢀⢀⢀
+// ⢀⢀⢀⢿⢿⢀⢀⢀⢀⢀⢀⢀⢀⢸⢿⢃⢀⢀⢀⢀⢻⢿⢿⢿⢿⢿⢿⢿⢿⢿⢃⢀⢀⢀⢿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⡗⢀⢀⢀⢀⢀⡈⡉⡛⡛⢀⢀⢹⡛⢋⢁⢀⢀⢀⢀⢀⢀
+//
+//  Author:      Parallax Engine Team
+//  Date:        16/10/2026
+//  Description: Header file for the frustum culling kernel
+//
+///////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include "math/Bounds.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <span>
+#include <vector>
+
+namespace parallax::system {
+    /**
+     * @brief Instruction set used by cullBounds
+     */
+    enum class CullingKernelPath : std::uint8_t {
+        Scalar, ///< Portable fallback, one box per iteration
+        Sse     ///< 4 boxes per iteration
+    };
+
+    /**
+     * @brief Gets the widest kernel path supported by the running CPU
+     */
+    [[nodiscard]] CullingKernelPath bestCullingKernelPath();
+
+    /**
+     * @brief World space boxes of the meshes of a frame
+     *
+     * Stored with one array per coordinate so that the SIMD path loads four boxes per register.
+     * The arrays are allocator-aware, a frame usually builds them in the frame arena.
+     */
+    struct WorldBounds {
+        explicit WorldBounds(std::pmr::memory_resource *resource = std::pmr::get_default_resource())
+            : centerX(resource), centerY(resource), centerZ(resource),
+              extentX(resource), extentY(resource), extentZ(resource) {}
+
+        std::pmr::vector<float> centerX;
+        std::pmr::vector<float> centerY;
+        std::pmr::vector<float> centerZ;
+        std::pmr::vector<float> extentX;
+        std::pmr::vector<float> extentY;
+        std::pmr::vector<float> extentZ;
+
+        void reserve(std::size_t count);
+
+        /**
+         * @brief Appends the world box of a mesh
+         *
+         * @param localBounds Bounds of the mesh in its local space, empty bounds are never culled
+         * @param worldMatrix Affine local-to-world matrix of the mesh
+         */
+        void add(const math::AABB &localBounds, const glm::mat4x3 &worldMatrix);
+
+        [[nodiscard]] std::size_t size() const { return centerX.size(); }
+    };
+
+    /**
+     * @brief Tests every box against a frustum
+     *
+     * A box is culled when it lies entirely on the outer side of one of the planes. Boxes crossing
+     * the corners of the frustum may be kept even though they are outside, never the opposite.
+     * Every path evaluates the same operations in the same order and returns the same result.
+     *
+     * @param frustum Planes of the camera
+     * @param bounds World boxes to test
+     * @param visible Receives 1 for the boxes to draw and 0 for the culled ones, at least bounds.size() long
+     * @param path Instruction set to use, the best supported one is used instead if the CPU lacks it
+     * @return std::size_t The number of visible boxes
+     */
+    std::size_t cullBounds(const math::Frustum &frustum, const WorldBounds &bounds, std::span<std::uint8_t> visible,
+                           CullingKernelPath path = bestCullingKernelPath());
+}
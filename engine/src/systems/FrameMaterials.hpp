@@ -0,0 +1,72 @@
+//// FrameMaterials.hpp ///////////////////////////////////////////////////////
+//
+// ⢀⢀⢀⣤⣤⣤⡀⢀⢀⢀⢀⢀⢀⢠⣤⡄⢀⢀⢀⢀⣠⣤⣤⣤⣤⣤⣤⣤⣤⣤⡀⢀⢀⢀⢠⣤⣄⢀⢀⢀⢀⢀⢀⢀⣤⣤⢀⢀⢀⢀⢀⢀⢀⢀⣀⣄⢀⢀⢠⣄⣀⢀⢀⢀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⣿⣷⡀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡟⡛⡛⡛⡛⡛⡛⡛⢁⢀⢀⢀⢀⢻⣿⣦⢀⢀⢀⢀⢠⣾⡿⢃⢀⢀⢀⢀⢀⣠⣾⣿⢿⡟⢀⢀⡙⢿⢿⣿⣦⡀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⡛⣿⣷⡀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡙⣿⡷⢀⢀⣰⣿⡟⢁⢀⢀⢀⢀⢀⣾⣿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⣿⡆⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⡈⢿⣷⡄⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣇⣀⣀⣀⣀⣀⣀⣀⢀⢀⢀⢀⢀⢀⢀⡈⢀⢀⣼⣿⢏⢀⢀⢀⢀⢀⢀⣼⣿⡏⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡘⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⡈⢿⣿⡄⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣿⢿⢿⢿⢿⢿⢿⢿⢇⢀⢀⢀⢀⢀⢀⢀⢠⣾⣿⣧⡀⢀⢀⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⡈⢿⣿⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣰⣿⡟⡛⣿⣷⡄⢀⢀⢀⢀⢀⢿⣿⣇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⡈⢿⢀⢀⢸⣿⡇⢀⢀⢀⢀⡛⡟⢁⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⡟⢀⢀⡈⢿⣿⣄⢀⢀⢀⢀⡘⣿⣿⣄⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⢏⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⢀⣀⣀⣀⣀⣀⣀⣀⣀⣀⡀⢀⢀⢀⣠⣾⡿⢃⢀⢀⢀⢀⢀⢻⣿⣧⡀⢀⢀⢀⡈⢻⣿⣷⣦⣄⢀⢀⣠⣤⣶⣿⡿⢋⢀⢀⢀⢀
+// ⢀⢀⢀⢿⢿⢀⢀⢀⢀⢀⢀⢀⢀⢸⢿⢃⢀⢀⢀⢀⢻⢿⢿⢿⢿⢿⢿⢿⢿⢿⢃⢀⢀⢀⢿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⡗⢀⢀⢀⢀⢀⡈⡉⡛⡛⢀⢀⢹⡛⢋⢁⢀⢀⢀⢀⢀⢀
+//
+//  Author:      Parallax Engine Team
+//  Date:        16/10/2026
+//  Description: Header file for the registration of materials in the frame's material buffer
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "assets/Assets/Material/Material.hpp"
+#include "renderer/Renderer3D.hpp"
+
+#include <memory>
+
+namespace parallax::system {
+
+    /**
+     * @brief Gets the texture of a texture asset reference, or nullptr if it is not loaded
+     */
+    inline std::shared_ptr<renderer::NxTexture2D> loadedTexture(const assets::AssetRef<assets::Texture> &textureRef)
+    {
+        const auto textureAsset = textureRef.lock();
+        return textureAsset && textureAsset->isLoaded() ? textureAsset->getData()->texture : nullptr;
+    }
+
+    /**
+     * @brief Gets the index of a material in the frame's material buffer, adding it on first use
+     *
+     * Draws sharing a material asset share the same entry. Draws without a loaded material
+     * all use a default entry.
+     *
+     * @param materialAsset Material of the draw, may be null.
+     * @return int Index to set as the uMaterialIndex uniform of the draw.
+     */
+    inline int frameMaterialIndex(const std::shared_ptr<assets::Material> &materialAsset)
+    {
+        const auto &renderer3D = renderer::NxRenderer3D::get();
+        const bool isLoaded = materialAsset && materialAsset->isLoaded();
+        const void *key = isLoaded ? materialAsset.get() : nullptr;
+        if (const int index = renderer3D.findMaterial(key); index != -1)
+            return index;
+
+        renderer::NxIndexedMaterial material;
+        if (isLoaded) {
+            const auto &data = materialAsset->getData();
+            material.albedoColor = data->albedoColor;
+            material.albedoTexIndex = renderer3D.getTextureIndex(loadedTexture(data->albedoTexture));
+            material.specularColor = data->specularColor;
+            material.specularTexIndex = renderer3D.getTextureIndex(loadedTexture(data->metallicMap));
+            material.emissiveColor = data->emissiveColor;
+            material.emissiveTexIndex = renderer3D.getTextureIndex(loadedTexture(data->emissiveMap));
+            material.roughness = data->roughness;
+            material.roughnessTexIndex = renderer3D.getTextureIndex(loadedTexture(data->roughnessMap));
+        } else {
+            material.albedoColor = glm::vec4(0.0f);
+            material.specularColor = glm::vec4(0.0f);
+            material.roughness = 1.0f;
+        }
+        return renderer3D.addMaterial(key, material);
+    }
+}
@@ -26,4 +26,12 @@ namespace parallax::system {
 		m_pointLightSystem->update();
 		m_spotLightSystem->update();
 	}
+
+	void LightSystem::addToSchedule(ecs::SystemScheduler &scheduler) const
+	{
+		scheduler.addSystem("AmbientLightSystem", m_ambientLightSystem);
+		scheduler.addSystem("DirectionalLightsSystem", m_directionalLightSystem);
+		scheduler.addSystem("PointLightsSystem", m_pointLightSystem);
+		scheduler.addSystem("SpotLightsSystem", m_spotLightSystem);
+	}
 }
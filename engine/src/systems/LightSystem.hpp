@@ -21,6 +21,7 @@
 #include "lights/DirectionalLightsSystem.hpp"
 #include "lights/PointLightsSystem.hpp"
 #include "lights/SpotLightsSystem.hpp"
+#include "ecs/SystemScheduler.hpp"
 
 namespace parallax::system {
 
@@ -48,6 +49,16 @@ namespace parallax::system {
 			m_spotLightSystem(spotSystem) {}
 
 			void update() const;
+
+			/**
+			 * @brief Registers every light subsystem as a separate node of a frame schedule.
+			 *
+			 * Each subsystem writes its own part of the RenderContext, so the scheduler is free
+			 * to run them concurrently.
+			 *
+			 * @param scheduler Scheduler receiving the light subsystems.
+			 */
+			void addToSchedule(ecs::SystemScheduler &scheduler) const;
 		private:
 			std::shared_ptr<AmbientLightSystem> m_ambientLightSystem = nullptr;
 			std::shared_ptr<DirectionalLightsSystem> m_directionalLightSystem = nullptr;
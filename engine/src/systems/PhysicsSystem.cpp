@@ -71,16 +71,14 @@ namespace parallax::system {
         constexpr int collisionSteps = 5;
         physicsSystem->Update(fixedTimestep, collisionSteps, tempAllocator, jobSystem);
 
-        for (const ecs::Entity entity : entities) {
-            auto& transform = getComponent<components::TransformComponent>(entity);
-            const auto& physicsBody = getComponent<components::PhysicsBodyComponent>(entity);
-
+        forEach([this](ecs::Entity, components::TransformComponent &transform,
+                       const components::PhysicsBodyComponent &physicsBody) {
             const JPH::Vec3 pos = bodyInterface->GetPosition(physicsBody.bodyID);
             transform.pos = glm::vec3(pos.GetX(), pos.GetY(), pos.GetZ());
 
             const JPH::Quat rot = bodyInterface->GetRotation(physicsBody.bodyID);
             transform.quat = glm::quat(rot.GetW(), rot.GetX(), rot.GetY(), rot.GetZ());
-        }
+        });
     }
 
 
@@ -35,9 +35,10 @@ namespace parallax::system {
            	ecs::Read<components::SceneTag>>,
        	ecs::WriteSingleton<components::RenderContext>> {
 			public:
+                   RenderBillboardSystem();
                    void update();
 
 			private:
-			    static void setupLights(renderer::DrawCommand &cmd, const components::LightContext& lightContext);
+			    ecs::PartitionHandle<unsigned int> m_scenePartition; ///< Partitioning of the group by scene ID
 	};
 }
@@ -28,43 +28,46 @@
 #include "components/StaticMesh.hpp"
 #include "components/Transform.hpp"
 #include "core/event/Input.hpp"
+#include "math/Affine.hpp"
 #include "math/Projection.hpp"
 #include "math/Vector.hpp"
 #include "renderPasses/Masks.hpp"
 #include "Application.hpp"
 #include "renderer/ShaderLibrary.hpp"
+#include "FrameMaterials.hpp"
+#include "SceneUniforms.hpp"
+#include "FrameArena.hpp"
+#include "CullingKernel.hpp"
 
+#include <algorithm>
+#include <tuple>
 #include <glm/gtc/type_ptr.hpp>
 #define GLM_ENABLE_EXPERIMENTAL
 #include <glm/gtx/quaternion.hpp>
 
 namespace parallax::system {
 
+    // Model, entity id and material index
+    constexpr size_t MESH_UNIFORM_COUNT = 3;
+    // Instance offset and material index
+    constexpr size_t INSTANCED_UNIFORM_COUNT = 2;
+
     /**
-    * @brief Sets up the lighting uniforms in the given shader.
-    *
-    * This static helper function binds the provided shader and sets uniforms for ambient, directional,
-    * point, and spot lights based on the current lightContext data. After updating the uniforms, the shader is unbound.
+    * @brief Packs the scene lights into the layout of the shaders' LightsBlock.
     *
-    * @param shader Shared pointer to the shader used for rendering.
     * @param lightContext The light context containing lighting information for the scene.
-    *
-    * @note The light context must contain valid values for:
-    *  - ambientLight
-    *  - directionalLights (and directionalLightCount)
-    *  - pointLights (and pointLightCount)
-    *  - spotLights (and spotLightCount)
+    * @return LightsBlock The block to upload, shared by every lit draw of the frame.
     */
-    void RenderCommandSystem::setupLights(renderer::DrawCommand &cmd, const components::LightContext& lightContext)
+    LightsBlock RenderCommandSystem::createLightsBlock(const components::LightContext& lightContext)
     {
-        cmd.uniforms["uAmbientLight"] = lightContext.ambientLight;
-
-        cmd.uniforms["uNumPointLights"] = static_cast<int>(lightContext.pointLightCount);
-        cmd.uniforms["uNumSpotLights"] = static_cast<int>(lightContext.spotLightCount);
+        LightsBlock block{};
+        block.ambientLight = lightContext.ambientLight;
+        block.numPointLights = static_cast<int>(lightContext.pointLightCount);
+        block.numSpotLights = static_cast<int>(lightContext.spotLightCount);
 
         const auto &directionalLight = lightContext.dirLight;
-        cmd.uniforms["uDirLight.direction"] = directionalLight.direction;
-        cmd.uniforms["uDirLight.color"] = glm::vec4(directionalLight.color, 1.0f);
+        block.dirLight.direction = directionalLight.direction;
+        block.dirLight.color = glm::vec4(directionalLight.color, 1.0f);
 
         const auto &pointLightComponentArray = coord->getComponentArray<components::PointLightComponent>();
         const auto &transformComponentArray = coord->getComponentArray<components::TransformComponent>();
@@ -72,11 +75,12 @@ namespace parallax::system {
         {
             const auto &pointLight = pointLightComponentArray->get(lightContext.pointLights[i]);
             const auto &transform = transformComponentArray->get(lightContext.pointLights[i]);
-            cmd.uniforms[std::format("uPointLights[{}].position", i)] = transform.pos;
-            cmd.uniforms[std::format("uPointLights[{}].color", i)] = glm::vec4(pointLight.color, 1.0f);
-            cmd.uniforms[std::format("uPointLights[{}].constant", i)] = pointLight.constant;
-            cmd.uniforms[std::format("uPointLights[{}].linear", i)] = pointLight.linear;
-            cmd.uniforms[std::format("uPointLights[{}].quadratic", i)] = pointLight.quadratic;
+            PointLightData &data = block.pointLights[i];
+            data.position = transform.pos;
+            data.color = glm::vec4(pointLight.color, 1.0f);
+            data.constant = pointLight.constant;
+            data.linear = pointLight.linear;
+            data.quadratic = pointLight.quadratic;
         }
 
         const auto &spotLightComponentArray = coord->getComponentArray<components::SpotLightComponent>();
@@ -84,57 +88,60 @@ namespace parallax::system {
         {
             const auto &spotLight = spotLightComponentArray->get(lightContext.spotLights[i]);
             const auto &transform = transformComponentArray->get(lightContext.spotLights[i]);
-            cmd.uniforms[std::format("uSpotLights[{}].position", i)] = transform.pos;
-            cmd.uniforms[std::format("uSpotLights[{}].color", i)] = glm::vec4(spotLight.color, 1.0f);
-            cmd.uniforms[std::format("uSpotLights[{}].constant", i)] = spotLight.constant;
-            cmd.uniforms[std::format("uSpotLights[{}].linear", i)] = spotLight.linear;
-            cmd.uniforms[std::format("uSpotLights[{}].quadratic", i)] = spotLight.quadratic;
-            cmd.uniforms[std::format("uSpotLights[{}].direction", i)] = spotLight.direction;
-            cmd.uniforms[std::format("uSpotLights[{}].cutOff", i)] = spotLight.cutOff;
-            cmd.uniforms[std::format("uSpotLights[{}].outerCutoff", i)] = spotLight.outerCutoff;
+            SpotLightData &data = block.spotLights[i];
+            data.position = transform.pos;
+            data.color = glm::vec4(spotLight.color, 1.0f);
+            data.constant = spotLight.constant;
+            data.linear = spotLight.linear;
+            data.quadratic = spotLight.quadratic;
+            data.direction = spotLight.direction;
+            data.cutOff = spotLight.cutOff;
+            data.outerCutoff = spotLight.outerCutoff;
         }
+        return block;
     }
 
-    static renderer::DrawCommand createOutlineDrawCommand(const components::CameraContext &camera)
+    static renderer::DrawCommand createOutlineDrawCommand(
+        const components::CameraContext &camera,
+        const renderer::DrawCommand::allocator_type &allocator)
     {
-        renderer::DrawCommand cmd;
+        const SceneUniforms &uniforms = sceneUniforms();
+        renderer::DrawCommand cmd(allocator);
         cmd.type = renderer::CommandType::FULL_SCREEN;
         cmd.filterMask = 0;
         cmd.filterMask |= renderer::F_OUTLINE_PASS;
         cmd.shader = renderer::ShaderLibrary::getInstance().get("Outline pulse flat");
 
-        cmd.uniforms["uViewProjection"] = camera.viewProjectionMatrix;
-        cmd.uniforms["uCamPos"] = camera.cameraPosition;
-
-        cmd.uniforms["uMaskTexture"] = 0;
-        cmd.uniforms["uDepthTexture"] = 1;
-        cmd.uniforms["uDepthMaskTexture"] = 2;
-        cmd.uniforms["uTime"] = static_cast<float>(glfwGetTime());
+        cmd.setUniform(uniforms.maskTexture, 0);
+        cmd.setUniform(uniforms.depthTexture, 1);
+        cmd.setUniform(uniforms.depthMaskTexture, 2);
+        cmd.setUniform(uniforms.time, static_cast<float>(glfwGetTime()));
         const glm::vec2 screenSize = {camera.renderTarget->getSize().x, camera.renderTarget->getSize().y};
-        cmd.uniforms["uScreenSize"] = screenSize;
-        cmd.uniforms["uOutlineWidth"] = 10.0f;
+        cmd.setUniform(uniforms.screenSize, screenSize);
+        cmd.setUniform(uniforms.outlineWidth, 10.0f);
         return cmd;
     }
 
-    static renderer::DrawCommand createGridDrawCommand(const components::CameraContext &camera, const components::RenderContext &renderContext)
+    static renderer::DrawCommand createGridDrawCommand(
+        const components::CameraContext &camera,
+        const components::RenderContext &renderContext,
+        const renderer::DrawCommand::allocator_type &allocator)
     {
-        renderer::DrawCommand cmd;
+        const SceneUniforms &uniforms = sceneUniforms();
+        renderer::DrawCommand cmd(allocator);
         cmd.type = renderer::CommandType::FULL_SCREEN;
         cmd.filterMask = 0;
         cmd.filterMask |= renderer::F_GRID_PASS;
         cmd.shader = renderer::ShaderLibrary::getInstance().get("Grid shader");
 
-        cmd.uniforms["uViewProjection"] = camera.viewProjectionMatrix;
-        cmd.uniforms["uCamPos"] = camera.cameraPosition;
-
         const components::RenderContext::GridParams &gridParams = renderContext.gridParams;
-        cmd.uniforms["uGridSize"] = gridParams.gridSize;
-        cmd.uniforms["uGridCellSize"] = gridParams.cellSize;
-        cmd.uniforms["uGridMinPixelsBetweenCells"] = gridParams.minPixelsBetweenCells;
+        cmd.setUniform(uniforms.gridSize, gridParams.gridSize);
+        cmd.setUniform(uniforms.gridCellSize, gridParams.cellSize);
+        cmd.setUniform(uniforms.gridMinPixelsBetweenCells, gridParams.minPixelsBetweenCells);
         constexpr glm::vec4 gridColorThin = {0.5f, 0.55f, 0.7f, 0.6f};
         constexpr glm::vec4 gridColorThick = {0.7f, 0.75f, 0.9f, 0.8f};
-        cmd.uniforms["uGridColorThin"] = gridColorThin;
-        cmd.uniforms["uGridColorThick"] = gridColorThick;
+        cmd.setUniform(uniforms.gridColorThin, gridColorThin);
+        cmd.setUniform(uniforms.gridColorThick, gridColorThick);
 
 
         const glm::vec2 globalMousePos = event::getMousePosition();
@@ -198,72 +205,174 @@ namespace parallax::system {
             }
         }
 
-        cmd.uniforms["uMouseWorldPos"] = mouseWorldPos;
-        cmd.uniforms["uTime"] = static_cast<float>(glfwGetTime());
+        cmd.setUniform(uniforms.mouseWorldPos, mouseWorldPos);
+        cmd.setUniform(uniforms.time, static_cast<float>(glfwGetTime()));
         return cmd;
     }
 
+    /**
+     * @brief Mesh of the rendered scene, gathered once per frame and recorded by each camera that sees it
+     */
+    struct MeshItem {
+        ecs::Entity entity;
+        const components::StaticMeshComponent *mesh;
+        const components::TransformComponent *transform;
+        std::shared_ptr<renderer::NxShader> shader;
+        std::shared_ptr<renderer::NxShader> instancedShader; // Null if the mesh cannot be batched
+        uint32_t materialIndex;
+        bool isOpaque;
+        bool isSelected;
+    };
+
     static renderer::DrawCommand createSelectedDrawCommand(
-        const components::StaticMeshComponent &mesh,
-        const std::shared_ptr<assets::Material> &materialAsset,
-        const components::TransformComponent &transform)
+        const MeshItem &item,
+        const renderer::DrawCommand::allocator_type &allocator)
     {
-        renderer::DrawCommand cmd;
-        cmd.vao = mesh.vao;
-        const bool isOpaque = materialAsset && materialAsset->isLoaded() ? materialAsset->getData()->isOpaque : true;
-        if (isOpaque)
+        const SceneUniforms &uniforms = sceneUniforms();
+        renderer::DrawCommand cmd(allocator);
+        cmd.vao = item.mesh->vao;
+        cmd.isOpaque = item.isOpaque;
+        if (item.isOpaque)
             cmd.shader = renderer::ShaderLibrary::getInstance().get("Flat color");
         else {
             cmd.shader = renderer::ShaderLibrary::getInstance().get("Albedo unshaded transparent");
-            cmd.uniforms["uMaterial.albedoColor"] = materialAsset && materialAsset->isLoaded() ? materialAsset->getData()->albedoColor : glm::vec4(0.0f);
-            const auto albedoTextureAsset = materialAsset && materialAsset->isLoaded() ? materialAsset->getData()->albedoTexture.lock() : nullptr;
-            const auto albedoTexture = albedoTextureAsset && albedoTextureAsset->isLoaded() ? albedoTextureAsset->getData()->texture : nullptr;
-            cmd.uniforms["uMaterial.albedoTexIndex"] = renderer::NxRenderer3D::get().getTextureIndex(albedoTexture);
+            cmd.materialIndex = item.materialIndex;
+            cmd.setUniform(uniforms.materialIndex, static_cast<int>(cmd.materialIndex));
         }
-        cmd.uniforms["uMatModel"] = transform.worldMatrix;
+        cmd.setUniform(uniforms.model, math::affineToMat4(item.transform->worldMatrix));
+        cmd.worldPosition = item.transform->worldMatrix[3];
         cmd.filterMask = 0;
         cmd.filterMask = renderer::F_OUTLINE_MASK;
         return cmd;
     }
 
     static renderer::DrawCommand createDrawCommand(
-        const ecs::Entity entity,
-        const std::shared_ptr<renderer::NxShader> &shader,
-        const components::StaticMeshComponent &mesh,
-        const std::shared_ptr<assets::Material> &materialAsset,
-        const components::TransformComponent &transform)
+        const MeshItem &item,
+        const renderer::DrawCommand::allocator_type &allocator)
     {
-        renderer::DrawCommand cmd;
-        cmd.vao = mesh.vao;
-        cmd.shader = shader;
-        cmd.uniforms["uMatModel"] = transform.worldMatrix;
-        cmd.uniforms["uEntityId"] = static_cast<int>(entity);
-
-        cmd.uniforms["uMaterial.albedoColor"] = materialAsset && materialAsset->isLoaded() ? materialAsset->getData()->albedoColor : glm::vec4(0.0f);
-        const auto albedoTextureAsset = materialAsset && materialAsset->isLoaded() ? materialAsset->getData()->albedoTexture.lock() : nullptr;
-        const auto albedoTexture = albedoTextureAsset && albedoTextureAsset->isLoaded() ? albedoTextureAsset->getData()->texture : nullptr;
-        cmd.uniforms["uMaterial.albedoTexIndex"] = renderer::NxRenderer3D::get().getTextureIndex(albedoTexture);
-
-        cmd.uniforms["uMaterial.specularColor"] = materialAsset && materialAsset->isLoaded() ? materialAsset->getData()->specularColor : glm::vec4(0.0f);
-        const auto specularTextureAsset = materialAsset && materialAsset->isLoaded() ? materialAsset->getData()->metallicMap.lock() : nullptr;
-        const auto specularTexture = specularTextureAsset && specularTextureAsset->isLoaded() ? specularTextureAsset->getData()->texture : nullptr;
-        cmd.uniforms["uMaterial.specularTexIndex"] = renderer::NxRenderer3D::get().getTextureIndex(specularTexture);
-
-        cmd.uniforms["uMaterial.emissiveColor"] = materialAsset && materialAsset->isLoaded() ? materialAsset->getData()->emissiveColor : glm::vec3(0.0f);
-        const auto emissiveTextureAsset = materialAsset && materialAsset->isLoaded() ? materialAsset->getData()->emissiveMap.lock() : nullptr;
-        const auto emissiveTexture = emissiveTextureAsset && emissiveTextureAsset->isLoaded() ? emissiveTextureAsset->getData()->texture : nullptr;
-        cmd.uniforms["uMaterial.emissiveTexIndex"] = renderer::NxRenderer3D::get().getTextureIndex(emissiveTexture);
-
-        cmd.uniforms["uMaterial.roughness"] = materialAsset && materialAsset->isLoaded() ? materialAsset->getData()->roughness : 1.0f;
-        const auto roughnessTextureAsset = materialAsset && materialAsset->isLoaded() ? materialAsset->getData()->roughnessMap.lock() : nullptr;
-        const auto roughnessTexture = roughnessTextureAsset && roughnessTextureAsset->isLoaded() ? roughnessTextureAsset->getData()->texture : nullptr;
-        cmd.uniforms["uMaterial.roughnessTexIndex"] = renderer::NxRenderer3D::get().getTextureIndex(roughnessTexture);
+        const SceneUniforms &uniforms = sceneUniforms();
+        renderer::DrawCommand cmd(allocator);
+        cmd.uniforms.reserve(MESH_UNIFORM_COUNT);
+        cmd.vao = item.mesh->vao;
+        cmd.shader = item.shader;
+        cmd.setUniform(uniforms.model, math::affineToMat4(item.transform->worldMatrix));
+        cmd.setUniform(uniforms.entityId, static_cast<int>(item.entity));
+        cmd.materialIndex = item.materialIndex;
+        cmd.setUniform(uniforms.materialIndex, static_cast<int>(cmd.materialIndex));
+        cmd.isOpaque = item.isOpaque;
+
+        cmd.worldPosition = item.transform->worldMatrix[3];
+        cmd.filterMask = 0;
+        cmd.filterMask |= renderer::F_FORWARD_PASS;
+        return cmd;
+    }
 
+    static renderer::DrawCommand createInstancedDrawCommand(
+        const MeshItem &first,
+        const unsigned int instanceOffset,
+        const uint32_t instanceCount,
+        const renderer::DrawCommand::allocator_type &allocator)
+    {
+        const SceneUniforms &uniforms = sceneUniforms();
+        renderer::DrawCommand cmd(allocator);
+        cmd.uniforms.reserve(INSTANCED_UNIFORM_COUNT);
+        cmd.vao = first.mesh->vao;
+        cmd.shader = first.instancedShader;
+        cmd.setUniform(uniforms.instanceOffset, static_cast<int>(instanceOffset));
+        cmd.materialIndex = first.materialIndex;
+        cmd.setUniform(uniforms.materialIndex, static_cast<int>(cmd.materialIndex));
+        cmd.instanceCount = instanceCount;
+
+        // Only opaque draws are batched, their order within the batch does not matter
+        cmd.isOpaque = true;
+        cmd.worldPosition = first.transform->worldMatrix[3];
         cmd.filterMask = 0;
         cmd.filterMask |= renderer::F_FORWARD_PASS;
         return cmd;
     }
 
+    /**
+     * @brief Draw that can be merged with the others sharing its mesh, shader and material
+     */
+    struct InstanceCandidate {
+        const renderer::NxVertexArray *vao;
+        const renderer::NxShader *shader;
+        uint32_t materialIndex;
+        const MeshItem *item;
+    };
+
+    /**
+     * @brief Records the draws of the meshes a camera sees
+     *
+     * Opaque meshes whose shader has an instanced variant are batched by mesh, shader and material,
+     * each batch of two or more meshes becoming a single instanced draw.
+     *
+     * @param items Meshes of the frame
+     * @param visible Culling result of the camera, one entry per item
+     * @param drawCommands Receives the commands
+     */
+    static void recordMeshCommands(
+        const std::span<const MeshItem> items,
+        const std::span<const std::uint8_t> visible,
+        std::pmr::vector<renderer::DrawCommand> &drawCommands)
+    {
+        std::pmr::vector<InstanceCandidate> candidates(&FrameArena::getInstance());
+        for (size_t i = 0; i < items.size(); ++i) {
+            if (!visible[i])
+                continue;
+            const MeshItem &item = items[i];
+            if (item.instancedShader)
+                candidates.push_back({item.mesh->vao.get(), item.shader.get(), item.materialIndex, &item});
+            else
+                drawCommands.push_back(createDrawCommand(item, drawCommands.get_allocator()));
+
+            // The outline mask is drawn per entity, so selecting a single instance of a batch still works
+            if (item.isSelected)
+                drawCommands.push_back(createSelectedDrawCommand(item, drawCommands.get_allocator()));
+        }
+
+        // Meshes sharing mesh, shader and material end up next to each other and are drawn as one instanced draw
+        std::ranges::sort(candidates, [](const InstanceCandidate &a, const InstanceCandidate &b) {
+            return std::tie(a.vao, a.shader, a.materialIndex) < std::tie(b.vao, b.shader, b.materialIndex);
+        });
+        std::pmr::vector<renderer::NxInstanceData> instances(&FrameArena::getInstance());
+        for (size_t begin = 0; begin < candidates.size();) {
+            const InstanceCandidate &first = candidates[begin];
+            size_t end = begin + 1;
+            while (end < candidates.size() && candidates[end].vao == first.vao &&
+                   candidates[end].shader == first.shader && candidates[end].materialIndex == first.materialIndex)
+                ++end;
+
+            if (end - begin == 1) {
+                drawCommands.push_back(createDrawCommand(*first.item, drawCommands.get_allocator()));
+                begin = end;
+                continue;
+            }
+
+            instances.clear();
+            for (size_t c = begin; c < end; ++c) {
+                const MeshItem &item = *candidates[c].item;
+                renderer::NxInstanceData &instance = instances.emplace_back();
+                instance.model = math::affineToMat4(item.transform->worldMatrix);
+                instance.entityId = static_cast<int>(item.entity);
+            }
+            const unsigned int instanceOffset = renderer::NxRenderer3D::get().addInstances(instances);
+            drawCommands.push_back(createInstancedDrawCommand(
+                *first.item,
+                instanceOffset,
+                static_cast<uint32_t>(end - begin),
+                drawCommands.get_allocator())
+            );
+            begin = end;
+        }
+    }
+
+	RenderCommandSystem::RenderCommandSystem()
+		: m_scenePartition(m_group->getPartitionHandle<components::SceneTag, unsigned int>(
+			[](const components::SceneTag& tag) { return tag.id; }))
+	{
+	}
+
 	void RenderCommandSystem::update()
 	{
 		auto &renderContext = getSingleton<components::RenderContext>();
@@ -273,9 +382,18 @@ namespace parallax::system {
 		const auto sceneRendered = static_cast<unsigned int>(renderContext.sceneRendered);
 		const SceneType sceneType = renderContext.sceneType;
 
-		const auto scenePartition = m_group->getPartitionView<components::SceneTag, unsigned int>(
-			[](const components::SceneTag& tag) { return tag.id; }
-		);
+        // Camera and lights are shared by every draw of a camera, so they are uploaded once per frame as
+        // uniform blocks. The blocks are set even when there is no mesh, the billboards read them too.
+        // The camera position is also where the pipeline measures the depth of its sort keys from
+        const LightsBlock lightsBlock = createLightsBlock(renderContext.sceneLights);
+        for (auto &camera : renderContext.cameras) {
+            const CameraBlock cameraBlock{camera.viewProjectionMatrix, camera.cameraPosition, 0.0f};
+            camera.pipeline.setUniformBlock(CAMERA_BLOCK_BINDING, std::as_bytes(std::span(&cameraBlock, 1)));
+            camera.pipeline.setUniformBlock(LIGHTS_BLOCK_BINDING, std::as_bytes(std::span(&lightsBlock, 1)));
+            camera.pipeline.setCameraPosition(camera.cameraPosition);
+        }
+
+		const auto scenePartition = m_group->getPartitionView(m_scenePartition);
 		const auto *partition = scenePartition.getPartition(sceneRendered);
 		auto &app = Application::getInstance();
         const std::string &sceneName = app.getSceneManager().getScene(sceneRendered).getName();
@@ -290,7 +408,13 @@ namespace parallax::system {
 		const auto materialSpan = get<components::MaterialComponent>();
 		const std::span<const ecs::Entity> entitySpan = m_group->entities();
 
-        std::vector<renderer::DrawCommand> drawCommands;
+        // Meshes and their world bounds are gathered once, then every camera culls and records its own commands.
+        // Everything only lives until the pipelines execute, so it goes to the frame arena
+        std::pmr::vector<MeshItem> items(&FrameArena::getInstance());
+        items.reserve(partition->count);
+        WorldBounds bounds(&FrameArena::getInstance());
+        bounds.reserve(partition->count);
+        const auto &shaderLibrary = renderer::ShaderLibrary::getInstance();
 		for (size_t i = partition->startIndex; i < partition->startIndex + partition->count; ++i) {
 		    const ecs::Entity entity = entitySpan[i];
             if (coord->entityHasComponent<components::CameraComponent>(entity) && sceneType != SceneType::EDITOR)
@@ -299,32 +423,39 @@ namespace parallax::system {
             const auto &materialAsset = materialSpan[i].material.lock();
             std::string shaderStr = materialAsset && materialAsset->isLoaded() ? materialAsset->getData()->shader : "";
             const auto &mesh = meshSpan[i];
-            auto shader = renderer::ShaderLibrary::getInstance().get(shaderStr);
+            auto shader = shaderLibrary.get(shaderStr);
             if (!shader)
                 continue;
-            drawCommands.push_back(createDrawCommand(
-                entity,
-                shader,
-                mesh,
-                materialAsset,
-                transform)
-            );
 
-            if (coord->entityHasComponent<components::SelectedTag>(entity))
-                drawCommands.push_back(createSelectedDrawCommand(mesh, materialAsset, transform));
+            MeshItem &item = items.emplace_back();
+            item.entity = entity;
+            item.mesh = &mesh;
+            item.transform = &transform;
+            item.materialIndex = static_cast<uint32_t>(frameMaterialIndex(materialAsset));
+            item.isOpaque = materialAsset && materialAsset->isLoaded() ? materialAsset->getData()->isOpaque : true;
+            item.isSelected = coord->entityHasComponent<components::SelectedTag>(entity);
+            // Transparent draws are not batched, they have to be sorted back to front one by one
+            if (item.isOpaque && mesh.vao)
+                item.instancedShader = shaderLibrary.getInstancedVariant(shader.get());
+            item.shader = std::move(shader);
+            bounds.add(mesh.localBounds, transform.worldMatrix);
 		}
 
+        std::pmr::vector<std::uint8_t> visible(items.size(), &FrameArena::getInstance());
 		for (auto &camera : renderContext.cameras) {
-            for (auto &cmd : drawCommands) {
-                cmd.uniforms["uViewProjection"] = camera.viewProjectionMatrix;
-                cmd.uniforms["uCamPos"] = camera.cameraPosition;
-                setupLights(cmd, renderContext.sceneLights);
-            }
+            const size_t visibleCount = cullBounds(camera.frustum, bounds, visible);
+            camera.cullingStats.visibleMeshes = static_cast<unsigned int>(visibleCount);
+            camera.cullingStats.totalMeshes = static_cast<unsigned int>(items.size());
+
+            std::pmr::vector<renderer::DrawCommand> drawCommands(&FrameArena::getInstance());
+            drawCommands.reserve(visibleCount);
+            recordMeshCommands(items, visible, drawCommands);
+
             camera.pipeline.addDrawCommands(drawCommands);
             if (sceneType == SceneType::EDITOR && renderContext.gridParams.enabled)
-                camera.pipeline.addDrawCommand(createGridDrawCommand(camera, renderContext));
+                camera.pipeline.addDrawCommand(createGridDrawCommand(camera, renderContext, drawCommands.get_allocator()));
             if (sceneType == SceneType::EDITOR)
-                camera.pipeline.addDrawCommand(createOutlineDrawCommand(camera));
+                camera.pipeline.addDrawCommand(createOutlineDrawCommand(camera, drawCommands.get_allocator()));
 		}
 	}
 }
@@ -25,6 +25,7 @@
 #include "components/MaterialComponent.hpp"
 #include "components/StaticMesh.hpp"
 #include "components/Transform.hpp"
+#include "UniformBlocks.hpp"
 
 namespace parallax::system {
 
@@ -32,7 +33,7 @@ namespace parallax::system {
 	* @brief System responsible for rendering the scene.
 	*
 	* The RenderSystem iterates over the active cameras stored in the RenderContext singleton,
-	* sets up lighting uniforms using the sceneLights data, and then renders entities that have
+	*	* uploads the camera and sceneLights data as uniform blocks, and then renders entities that have
 	* a valid RenderComponent. The system binds each camera's render target, clears the buffers,
 	* and then draws each renderable entity.
 	*
@@ -54,9 +55,11 @@ namespace parallax::system {
         	ecs::Read<components::SceneTag>>,
     	ecs::WriteSingleton<components::RenderContext>> {
 			public:
+                RenderCommandSystem();
                 void update();
 
 			private:
-			    static void setupLights(renderer::DrawCommand &cmd, const components::LightContext& lightContext);
+			    static LightsBlock createLightsBlock(const components::LightContext& lightContext);
+			    ecs::PartitionHandle<unsigned int> m_scenePartition; ///< Partitioning of the group by scene ID
 	};
 }
@@ -0,0 +1,79 @@
+//// SceneUniforms.hpp ////////////////////////////////////////////////////////
+//
+// ⢀⢀⢀⣤⣤⣤⡀⢀⢀⢀⢀⢀⢀⢠⣤⡄⢀⢀⢀⢀⣠⣤⣤⣤⣤⣤⣤⣤⣤⣤⡀⢀⢀⢀⢠⣤⣄⢀⢀⢀⢀⢀⢀⢀⣤⣤⢀⢀⢀⢀⢀⢀⢀⢀⣀⣄⢀⢀⢠⣄⣀⢀⢀⢀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⣿⣷⡀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡟⡛⡛⡛⡛⡛⡛⡛⢁⢀⢀⢀⢀⢻⣿⣦⢀⢀⢀⢀⢠⣾⡿⢃⢀⢀⢀⢀⢀⣠⣾⣿⢿⡟⢀⢀⡙⢿⢿⣿⣦⡀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⡛⣿⣷⡀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡙⣿⡷⢀⢀⣰⣿⡟⢁⢀⢀⢀⢀⢀⣾⣿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⣿⡆⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⡈⢿⣷⡄⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣇⣀⣀⣀⣀⣀⣀⣀⢀⢀⢀⢀⢀⢀⢀⡈⢀⢀⣼⣿⢏⢀⢀⢀⢀⢀⢀⣼⣿⡏⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡘⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⡈⢿⣿⡄⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣿⢿⢿⢿⢿⢿⢿⢿⢇⢀⢀⢀⢀⢀⢀⢀⢠⣾⣿⣧⡀⢀⢀⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⡈⢿⣿⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣰⣿⡟⡛⣿⣷⡄⢀⢀⢀⢀⢀⢿⣿⣇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⡈⢿⢀⢀⢸⣿⡇⢀⢀⢀⢀⡛⡟⢁⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⡟⢀⢀⡈⢿⣿⣄⢀⢀⢀⢀⡘⣿⣿⣄⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⢏⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⢀⣀⣀⣀⣀⣀⣀⣀⣀⣀⡀⢀⢀⢀⣠⣾⡿⢃⢀⢀⢀⢀⢀⢻⣿⣧⡀⢀⢀⢀⡈⢻⣿⣷⣦⣄⢀⢀⣠⣤⣶⣿⡿⢋⢀⢀⢀⢀
+// ⢀⢀⢀⢿⢿⢀⢀⢀⢀⢀⢀⢀⢀⢸⢿⢃⢀⢀⢀⢀⢻⢿⢿⢿⢿⢿⢿⢿⢿⢿⢃⢀⢀⢀⢿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⡗⢀⢀⢀⢀⢀⡈⡉⡛⡛⢀⢀⢹⡛⢋⢁⢀⢀⢀⢀⢀⢀
+//
+//  Author:      Parallax Engine Team
+//  Date:        16/10/2026
+//  Description: Header file for the interned handles of the uniforms written by the render systems
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "renderer/UniformRegistry.hpp"
+
+namespace parallax::system {
+
+    /**
+     * @brief Handles of the model, material and editor uniforms written by the render systems
+     */
+    struct SceneUniforms {
+        renderer::UniformHandle model;
+        renderer::UniformHandle entityId;
+        renderer::UniformHandle materialIndex;
+        renderer::UniformHandle instanceOffset;
+
+        renderer::UniformHandle time;
+        renderer::UniformHandle screenSize;
+        renderer::UniformHandle maskTexture;
+        renderer::UniformHandle depthTexture;
+        renderer::UniformHandle depthMaskTexture;
+        renderer::UniformHandle outlineWidth;
+
+        renderer::UniformHandle gridSize;
+        renderer::UniformHandle gridCellSize;
+        renderer::UniformHandle gridMinPixelsBetweenCells;
+        renderer::UniformHandle gridColorThin;
+        renderer::UniformHandle gridColorThick;
+        renderer::UniformHandle mouseWorldPos;
+    };
+
+    /**
+     * @brief Gets the handles of the scene uniforms, interned on first use
+     */
+    inline const SceneUniforms &sceneUniforms()
+    {
+        static const SceneUniforms uniforms = [] {
+            auto &registry = renderer::UniformRegistry::getInstance();
+            return SceneUniforms{
+                registry.intern("uMatModel"),
+                registry.intern("uEntityId"),
+                registry.intern("uMaterialIndex"),
+                registry.intern("uInstanceOffset"),
+
+                registry.intern("uTime"),
+                registry.intern("uScreenSize"),
+                registry.intern("uMaskTexture"),
+                registry.intern("uDepthTexture"),
+                registry.intern("uDepthMaskTexture"),
+                registry.intern("uOutlineWidth"),
+
+                registry.intern("uGridSize"),
+                registry.intern("uGridCellSize"),
+                registry.intern("uGridMinPixelsBetweenCells"),
+                registry.intern("uGridColorThin"),
+                registry.intern("uGridColorThick"),
+                registry.intern("uMouseWorldPos")
+            };
+        }();
+        return uniforms;
+    }
+}
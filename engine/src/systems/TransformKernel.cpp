@@ -0,0 +1,310 @@
+//// TransformKernel.cpp //////////////////////////////////////////////////////
+//
+// ⢀⢀⢀⣤⣤⣤⡀⢀⢀⢀⢀⢀⢀⢠⣤⡄⢀⢀⢀⢀⣠⣤⣤⣤⣤⣤⣤⣤⣤⣤⡀⢀⢀⢀⢠⣤⣄⢀⢀⢀⢀⢀⢀⢀⣤⣤⢀⢀⢀⢀⢀⢀⢀⢀⣀⣄⢀⢀⢠⣄⣀⢀⢀⢀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⣿⣷⡀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡟⡛⡛⡛⡛⡛⡛⡛⢁⢀⢀⢀⢀⢻⣿⣦⢀⢀⢀⢀⢠⣾⡿⢃⢀⢀⢀⢀⢀⣠⣾⣿⢿⡟⢀⢀⡙⢿⢿⣿⣦⡀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⡛⣿⣷⡀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡙⣿⡷⢀⢀⣰⣿⡟⢁⢀⢀⢀⢀⢀⣾⣿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⣿⡆⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⡈⢿⣷⡄⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣇⣀⣀⣀⣀⣀⣀⣀⢀⢀⢀⢀⢀⢀⢀⡈⢀⢀⣼⣿⢏⢀⢀⢀⢀⢀⢀⣼⣿⡏⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡘⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⡈⢿⣿⡄⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣿⢿⢿⢿⢿⢿⢿⢿⢇⢀⢀⢀⢀⢀⢀⢀⢠⣾⣿⣧⡀⢀⢀⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⡈⢿⣿⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣰⣿⡟⡛⣿⣷⡄⢀⢀⢀⢀⢀⢿⣿⣇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⡈⢿⢀⢀⢸⣿⡇⢀⢀⢀⢀⡛⡟⢁⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⡟⢀⢀⡈⢿⣿⣄⢀⢀⢀⢀⡘⣿⣿⣄⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⢏⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⢀⣀⣀⣀⣀⣀⣀⣀⣀⣀⡀⢀⢀⢀⣠⣾⡿⢃⢀⢀⢀⢀⢀⢻⣿⣧⡀⢀⢀⢀⡈⢻⣿⣷⣦⣄⢀⢀⣠⣤⣶⣿⡿⢋⢀⢀⢀⢀
+// ⢀⢀⢀⢿⢿⢀⢀⢀⢀⢀⢀⢀⢀⢸⢿⢃⢀⢀⢀⢀⢻⢿⢿⢿⢿⢿⢿⢿⢿⢿⢃⢀⢀⢀⢿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⡗⢀⢀⢀⢀⢀⡈⡉⡛⡛⢀⢀⢹⡛⢋⢁⢀⢀⢀⢀⢀⢀
+//
+//  Author:      Parallax Engine Team
+//  Date:        16/10/2026
+//  Description: Source file for the SIMD transform kernel
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include "TransformKernel.hpp"
+
+#if defined(__x86_64__) || defined(_M_X64)
+    #define PARALLAX_TRANSFORM_KERNEL_X86 1
+    #include <immintrin.h>
+    #if defined(_MSC_VER)
+        #include <intrin.h>
+        // MSVC accepts AVX2 intrinsics in any function
+        #define PARALLAX_TARGET_AVX2
+    #else
+        // Only the AVX2 functions are compiled for AVX2, the rest of the file stays at the baseline
+        #define PARALLAX_TARGET_AVX2 __attribute__((target("avx2")))
+    #endif
+#else
+    #define PARALLAX_TRANSFORM_KERNEL_X86 0
+#endif
+
+namespace parallax::system {
+    namespace {
+        struct ContiguousTransforms {
+            components::TransformComponent *data;
+
+            components::TransformComponent &operator()(const std::size_t i) const { return data[i]; }
+        };
+
+        struct IndexedTransforms {
+            components::TransformComponent *data;
+            const std::uint32_t *indices;
+
+            components::TransformComponent &operator()(const std::size_t i) const { return data[indices[i]]; }
+        };
+
+        // Same operations as glm::mat3_cast, each rotation column scaled afterwards like the scale matrix does
+        void composeScalar(components::TransformComponent &transform)
+        {
+            const glm::quat &q = transform.quat;
+            const float xx = q.x * q.x;
+            const float yy = q.y * q.y;
+            const float zz = q.z * q.z;
+            const float xy = q.x * q.y;
+            const float xz = q.x * q.z;
+            const float yz = q.y * q.z;
+            const float wx = q.w * q.x;
+            const float wy = q.w * q.y;
+            const float wz = q.w * q.z;
+
+            const glm::vec3 &s = transform.size;
+            glm::mat4x3 &m = transform.localMatrix;
+            m[0] = glm::vec3((1.0f - 2.0f * (yy + zz)) * s.x, 2.0f * (xy + wz) * s.x, 2.0f * (xz - wy) * s.x);
+            m[1] = glm::vec3(2.0f * (xy - wz) * s.y, (1.0f - 2.0f * (xx + zz)) * s.y, 2.0f * (yz + wx) * s.y);
+            m[2] = glm::vec3(2.0f * (xz + wy) * s.z, 2.0f * (yz - wx) * s.z, (1.0f - 2.0f * (xx + yy)) * s.z);
+            m[3] = transform.pos;
+        }
+
+        template<typename Fetch>
+        void composeScalar(const Fetch fetch, const std::size_t begin, const std::size_t count)
+        {
+            for (std::size_t i = begin; i < count; ++i)
+                composeScalar(fetch(i));
+        }
+
+#if PARALLAX_TRANSFORM_KERNEL_X86
+        static_assert(sizeof(glm::mat4x3) == 12 * sizeof(float), "affine matrices must be 12 packed floats");
+
+        // Writes four (x, y, z, w) columns as 12 packed floats. Each of the first three stores
+        // spills its w into the next column, which the following store overwrites.
+        inline void storeAffine(float *m, const __m128 c0, const __m128 c1, const __m128 c2, const __m128 c3)
+        {
+            _mm_storeu_ps(m, c0);
+            _mm_storeu_ps(m + 3, c1);
+            _mm_storeu_ps(m + 6, c2);
+            _mm_storel_pi(reinterpret_cast<__m64 *>(m + 9), c3);
+            _mm_store_ss(m + 11, _mm_movehl_ps(c3, c3));
+        }
+
+        template<typename Fetch>
+        void composeSse(const Fetch fetch, const std::size_t count)
+        {
+            const __m128 one = _mm_set1_ps(1.0f);
+            const __m128 two = _mm_set1_ps(2.0f);
+            const __m128 zero = _mm_setzero_ps();
+
+            std::size_t i = 0;
+            for (; i + 4 <= count; i += 4) {
+                components::TransformComponent *t[4] = {&fetch(i), &fetch(i + 1), &fetch(i + 2), &fetch(i + 3)};
+
+                // One register per field, one lane per transform
+                const __m128 qx = _mm_setr_ps(t[0]->quat.x, t[1]->quat.x, t[2]->quat.x, t[3]->quat.x);
+                const __m128 qy = _mm_setr_ps(t[0]->quat.y, t[1]->quat.y, t[2]->quat.y, t[3]->quat.y);
+                const __m128 qz = _mm_setr_ps(t[0]->quat.z, t[1]->quat.z, t[2]->quat.z, t[3]->quat.z);
+                const __m128 qw = _mm_setr_ps(t[0]->quat.w, t[1]->quat.w, t[2]->quat.w, t[3]->quat.w);
+                const __m128 sx = _mm_setr_ps(t[0]->size.x, t[1]->size.x, t[2]->size.x, t[3]->size.x);
+                const __m128 sy = _mm_setr_ps(t[0]->size.y, t[1]->size.y, t[2]->size.y, t[3]->size.y);
+                const __m128 sz = _mm_setr_ps(t[0]->size.z, t[1]->size.z, t[2]->size.z, t[3]->size.z);
+                __m128 px = _mm_setr_ps(t[0]->pos.x, t[1]->pos.x, t[2]->pos.x, t[3]->pos.x);
+                __m128 py = _mm_setr_ps(t[0]->pos.y, t[1]->pos.y, t[2]->pos.y, t[3]->pos.y);
+                __m128 pz = _mm_setr_ps(t[0]->pos.z, t[1]->pos.z, t[2]->pos.z, t[3]->pos.z);
+
+                const __m128 xx = _mm_mul_ps(qx, qx);
+                const __m128 yy = _mm_mul_ps(qy, qy);
+                const __m128 zz = _mm_mul_ps(qz, qz);
+                const __m128 xy = _mm_mul_ps(qx, qy);
+                const __m128 xz = _mm_mul_ps(qx, qz);
+                const __m128 yz = _mm_mul_ps(qy, qz);
+                const __m128 wx = _mm_mul_ps(qw, qx);
+                const __m128 wy = _mm_mul_ps(qw, qy);
+                const __m128 wz = _mm_mul_ps(qw, qz);
+
+                __m128 c0x = _mm_mul_ps(_mm_sub_ps(one, _mm_mul_ps(two, _mm_add_ps(yy, zz))), sx);
+                __m128 c0y = _mm_mul_ps(_mm_mul_ps(two, _mm_add_ps(xy, wz)), sx);
+                __m128 c0z = _mm_mul_ps(_mm_mul_ps(two, _mm_sub_ps(xz, wy)), sx);
+                __m128 c0w = zero;
+                __m128 c1x = _mm_mul_ps(_mm_mul_ps(two, _mm_sub_ps(xy, wz)), sy);
+                __m128 c1y = _mm_mul_ps(_mm_sub_ps(one, _mm_mul_ps(two, _mm_add_ps(xx, zz))), sy);
+                __m128 c1z = _mm_mul_ps(_mm_mul_ps(two, _mm_add_ps(yz, wx)), sy);
+                __m128 c1w = zero;
+                __m128 c2x = _mm_mul_ps(_mm_mul_ps(two, _mm_add_ps(xz, wy)), sz);
+                __m128 c2y = _mm_mul_ps(_mm_mul_ps(two, _mm_sub_ps(yz, wx)), sz);
+                __m128 c2z = _mm_mul_ps(_mm_sub_ps(one, _mm_mul_ps(two, _mm_add_ps(xx, yy))), sz);
+                __m128 c2w = zero;
+                __m128 c3w = one;
+
+                // Back to one register per transform column
+                _MM_TRANSPOSE4_PS(c0x, c0y, c0z, c0w);
+                _MM_TRANSPOSE4_PS(c1x, c1y, c1z, c1w);
+                _MM_TRANSPOSE4_PS(c2x, c2y, c2z, c2w);
+                _MM_TRANSPOSE4_PS(px, py, pz, c3w);
+                const __m128 columns[4][4] = {{c0x, c1x, c2x, px}, {c0y, c1y, c2y, py},
+                                              {c0z, c1z, c2z, pz}, {c0w, c1w, c2w, c3w}};
+                for (int lane = 0; lane < 4; ++lane)
+                    storeAffine(&t[lane]->localMatrix[0][0], columns[lane][0], columns[lane][1], columns[lane][2], columns[lane][3]);
+            }
+            composeScalar(fetch, i, count);
+        }
+
+        // Transposes four registers of 8 lanes into, for each lane k < 4, the (x, y, z, w) of
+        // transform k in the low half of out[k] and the one of transform k + 4 in its high half
+        PARALLAX_TARGET_AVX2 inline void transpose8x4(const __m256 x, const __m256 y, const __m256 z, const __m256 w, __m256 out[4])
+        {
+            const __m256 xy0 = _mm256_unpacklo_ps(x, y);
+            const __m256 xy1 = _mm256_unpackhi_ps(x, y);
+            const __m256 zw0 = _mm256_unpacklo_ps(z, w);
+            const __m256 zw1 = _mm256_unpackhi_ps(z, w);
+            out[0] = _mm256_shuffle_ps(xy0, zw0, _MM_SHUFFLE(1, 0, 1, 0));
+            out[1] = _mm256_shuffle_ps(xy0, zw0, _MM_SHUFFLE(3, 2, 3, 2));
+            out[2] = _mm256_shuffle_ps(xy1, zw1, _MM_SHUFFLE(1, 0, 1, 0));
+            out[3] = _mm256_shuffle_ps(xy1, zw1, _MM_SHUFFLE(3, 2, 3, 2));
+        }
+
+        template<typename Fetch>
+        PARALLAX_TARGET_AVX2 void composeAvx2(const Fetch fetch, const std::size_t count)
+        {
+            const __m256 one = _mm256_set1_ps(1.0f);
+            const __m256 two = _mm256_set1_ps(2.0f);
+            const __m256 zero = _mm256_setzero_ps();
+
+            std::size_t i = 0;
+            for (; i + 8 <= count; i += 8) {
+                components::TransformComponent *t[8];
+                for (int lane = 0; lane < 8; ++lane)
+                    t[lane] = &fetch(i + lane);
+
+#define PARALLAX_GATHER8(field) _mm256_setr_ps(t[0]->field, t[1]->field, t[2]->field, t[3]->field, \
+                                               t[4]->field, t[5]->field, t[6]->field, t[7]->field)
+                const __m256 qx = PARALLAX_GATHER8(quat.x);
+                const __m256 qy = PARALLAX_GATHER8(quat.y);
+                const __m256 qz = PARALLAX_GATHER8(quat.z);
+                const __m256 qw = PARALLAX_GATHER8(quat.w);
+                const __m256 sx = PARALLAX_GATHER8(size.x);
+                const __m256 sy = PARALLAX_GATHER8(size.y);
+                const __m256 sz = PARALLAX_GATHER8(size.z);
+                const __m256 px = PARALLAX_GATHER8(pos.x);
+                const __m256 py = PARALLAX_GATHER8(pos.y);
+                const __m256 pz = PARALLAX_GATHER8(pos.z);
+#undef PARALLAX_GATHER8
+
+                const __m256 xx = _mm256_mul_ps(qx, qx);
+                const __m256 yy = _mm256_mul_ps(qy, qy);
+                const __m256 zz = _mm256_mul_ps(qz, qz);
+                const __m256 xy = _mm256_mul_ps(qx, qy);
+                const __m256 xz = _mm256_mul_ps(qx, qz);
+                const __m256 yz = _mm256_mul_ps(qy, qz);
+                const __m256 wx = _mm256_mul_ps(qw, qx);
+                const __m256 wy = _mm256_mul_ps(qw, qy);
+                const __m256 wz = _mm256_mul_ps(qw, qz);
+
+                // No FMA on purpose: separate roundings keep the results identical to the other paths
+                __m256 columns[4][4];
+                transpose8x4(_mm256_mul_ps(_mm256_sub_ps(one, _mm256_mul_ps(two, _mm256_add_ps(yy, zz))), sx),
+                             _mm256_mul_ps(_mm256_mul_ps(two, _mm256_add_ps(xy, wz)), sx),
+                             _mm256_mul_ps(_mm256_mul_ps(two, _mm256_sub_ps(xz, wy)), sx),
+                             zero, columns[0]);
+                transpose8x4(_mm256_mul_ps(_mm256_mul_ps(two, _mm256_sub_ps(xy, wz)), sy),
+                             _mm256_mul_ps(_mm256_sub_ps(one, _mm256_mul_ps(two, _mm256_add_ps(xx, zz))), sy),
+                             _mm256_mul_ps(_mm256_mul_ps(two, _mm256_add_ps(yz, wx)), sy),
+                             zero, columns[1]);
+                transpose8x4(_mm256_mul_ps(_mm256_mul_ps(two, _mm256_add_ps(xz, wy)), sz),
+                             _mm256_mul_ps(_mm256_mul_ps(two, _mm256_sub_ps(yz, wx)), sz),
+                             _mm256_mul_ps(_mm256_sub_ps(one, _mm256_mul_ps(two, _mm256_add_ps(xx, yy))), sz),
+                             zero, columns[2]);
+                transpose8x4(px, py, pz, one, columns[3]);
+
+                for (int lane = 0; lane < 4; ++lane) {
+                    storeAffine(&t[lane]->localMatrix[0][0],
+                                _mm256_castps256_ps128(columns[0][lane]), _mm256_castps256_ps128(columns[1][lane]),
+                                _mm256_castps256_ps128(columns[2][lane]), _mm256_castps256_ps128(columns[3][lane]));
+                    storeAffine(&t[lane + 4]->localMatrix[0][0],
+                                _mm256_extractf128_ps(columns[0][lane], 1), _mm256_extractf128_ps(columns[1][lane], 1),
+                                _mm256_extractf128_ps(columns[2][lane], 1), _mm256_extractf128_ps(columns[3][lane], 1));
+                }
+            }
+            composeScalar(fetch, i, count);
+        }
+
+        bool cpuSupportsAvx2()
+        {
+#if defined(_MSC_VER)
+            int info[4];
+            __cpuid(info, 0);
+            if (info[0] < 7)
+                return false;
+            __cpuid(info, 1);
+            const bool osSavesAvx = (info[2] & (1 << 27)) != 0 && (info[2] & (1 << 28)) != 0
+                && (_xgetbv(0) & 0x6) == 0x6;
+            if (!osSavesAvx)
+                return false;
+            __cpuidex(info, 7, 0);
+            return (info[1] & (1 << 5)) != 0;
+#else
+            return __builtin_cpu_supports("avx2");
+#endif
+        }
+#endif
+
+        template<typename Fetch>
+        void compose(const Fetch fetch, const std::size_t count, TransformKernelPath path)
+        {
+            if (!isTransformKernelPathSupported(path))
+                path = bestTransformKernelPath();
+            switch (path) {
+#if PARALLAX_TRANSFORM_KERNEL_X86
+                case TransformKernelPath::Avx2:
+                    composeAvx2(fetch, count);
+                    return;
+                case TransformKernelPath::Sse:
+                    composeSse(fetch, count);
+                    return;
+#endif
+                default:
+                    composeScalar(fetch, 0, count);
+            }
+        }
+    }
+
+    bool isTransformKernelPathSupported(const TransformKernelPath path)
+    {
+        switch (path) {
+            case TransformKernelPath::Scalar:
+                return true;
+#if PARALLAX_TRANSFORM_KERNEL_X86
+            case TransformKernelPath::Sse:
+                // SSE2 is part of every x86-64 CPU
+                return true;
+            case TransformKernelPath::Avx2: {
+                static const bool supported = cpuSupportsAvx2();
+                return supported;
+            }
+#endif
+            default:
+                return false;
+        }
+    }
+
+    TransformKernelPath bestTransformKernelPath()
+    {
+        static const TransformKernelPath best = isTransformKernelPathSupported(TransformKernelPath::Avx2)
+            ? TransformKernelPath::Avx2
+            : isTransformKernelPathSupported(TransformKernelPath::Sse) ? TransformKernelPath::Sse : TransformKernelPath::Scalar;
+        return best;
+    }
+
+    void composeLocalMatrices(const std::span<components::TransformComponent> transforms, const TransformKernelPath path)
+    {
+        compose(ContiguousTransforms{transforms.data()}, transforms.size(), path);
+    }
+
+    void composeLocalMatrices(const std::span<components::TransformComponent> transforms,
+                              const std::span<const std::uint32_t> indices, const TransformKernelPath path)
+    {
+        compose(IndexedTransforms{transforms.data(), indices.data()}, indices.size(), path);
+    }
+}
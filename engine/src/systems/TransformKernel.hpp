@@ -0,0 +1,71 @@
+//// TransformKernel.hpp //////////////////////////////////////////////////////
+//
+// ⢀⢀⢀⣤⣤⣤⡀⢀⢀⢀⢀⢀⢀⢠⣤⡄⢀⢀⢀⢀⣠⣤⣤⣤⣤⣤⣤⣤⣤⣤⡀⢀⢀⢀⢠⣤⣄⢀⢀⢀⢀⢀⢀⢀⣤⣤⢀⢀⢀⢀⢀⢀⢀⢀⣀⣄⢀⢀⢠⣄⣀⢀⢀⢀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⣿⣷⡀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡟⡛⡛⡛⡛⡛⡛⡛⢁⢀⢀⢀⢀⢻⣿⣦⢀⢀⢀⢀⢠⣾⡿⢃⢀⢀⢀⢀⢀⣠⣾⣿⢿⡟⢀⢀⡙⢿⢿⣿⣦⡀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⡛⣿⣷⡀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡙⣿⡷⢀⢀⣰⣿⡟⢁⢀⢀⢀⢀⢀⣾⣿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⣿⡆⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⡈⢿⣷⡄⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣇⣀⣀⣀⣀⣀⣀⣀⢀⢀⢀⢀⢀⢀⢀⡈⢀⢀⣼⣿⢏⢀⢀⢀⢀⢀⢀⣼⣿⡏⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡘⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⡈⢿⣿⡄⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣿⢿⢿⢿⢿⢿⢿⢿⢇⢀⢀⢀⢀⢀⢀⢀⢠⣾⣿⣧⡀⢀⢀⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⡈⢿⣿⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣰⣿⡟⡛⣿⣷⡄⢀⢀⢀⢀⢀⢿⣿⣇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⡈⢿⢀⢀⢸⣿⡇⢀⢀⢀⢀⡛⡟⢁⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⡟⢀⢀⡈⢿⣿⣄⢀⢀⢀⢀⡘⣿⣿⣄⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⢏⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⢀⣀⣀⣀⣀⣀⣀⣀⣀⣀⡀⢀⢀⢀⣠⣾⡿⢃⢀⢀⢀⢀⢀⢻⣿⣧⡀⢀⢀⢀⡈⢻⣿⣷⣦⣄⢀⢀⣠⣤⣶⣿⡿⢋⢀⢀⢀⢀
+// ⢀⢀⢀⢿⢿⢀⢀⢀⢀⢀⢀⢀⢀⢸⢿⢃⢀⢀⢀⢀⢻⢿⢿⢿⢿⢿⢿⢿⢿⢿⢃⢀⢀⢀⢿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⡗⢀⢀⢀⢀⢀⡈⡉⡛⡛⢀⢀⢹⡛⢋⢁⢀⢀⢀⢀⢀⢀
+//
+//  Author:      Parallax Engine Team
+//  Date:        16/10/2026
+//  Description: Batched composition of local matrices from position, rotation and scale
+//
+///////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include "components/Transform.hpp"
+
+#include <cstdint>
+#include <span>
+
+namespace parallax::system {
+    /**
+     * @brief Instruction set used by composeLocalMatrices
+     */
+    enum class TransformKernelPath : std::uint8_t {
+        Scalar, ///< Portable fallback, one transform per iteration
+        Sse,    ///< 4 transforms per iteration
+        Avx2    ///< 8 transforms per iteration
+    };
+
+    /**
+     * @brief Checks whether the running CPU can execute a kernel path
+     */
+    [[nodiscard]] bool isTransformKernelPathSupported(TransformKernelPath path);
+
+    /**
+     * @brief Gets the widest kernel path supported by the running CPU
+     *
+     * The CPU is only queried on the first call.
+     */
+    [[nodiscard]] TransformKernelPath bestTransformKernelPath();
+
+    /**
+     * @brief Rebuilds the local matrix of every transform from its position, rotation and scale
+     *
+     * The 3x4 affine matrix is written directly from the quaternion instead of multiplying
+     * translate * toMat4(quat) * scale, using the same operations in the same order so
+     * that every path produces the same values. The SIMD paths load several transforms
+     * per iteration into one register per field and transpose the result back into columns.
+     *
+     * @param transforms Transforms to update, usually the dense span of the component array
+     * @param path Instruction set to use, the best supported one is used instead if the CPU lacks it
+     */
+    void composeLocalMatrices(std::span<components::TransformComponent> transforms,
+                              TransformKernelPath path = bestTransformKernelPath());
+
+    /**
+     * @brief Rebuilds the local matrices of a subset of transforms
+     *
+     * @param transforms Dense transform storage
+     * @param indices Positions in transforms of the transforms to update
+     * @param path Instruction set to use, the best supported one is used instead if the CPU lacks it
+     */
+    void composeLocalMatrices(std::span<components::TransformComponent> transforms,
+                              std::span<const std::uint32_t> indices,
+                              TransformKernelPath path = bestTransformKernelPath());
+}
@@ -0,0 +1,194 @@
+//// TransformSystem.cpp //////////////////////////////////////////////////////
+//
+// ⢀⢀⢀⣤⣤⣤⡀⢀⢀⢀⢀⢀⢀⢠⣤⡄⢀⢀⢀⢀⣠⣤⣤⣤⣤⣤⣤⣤⣤⣤⡀⢀⢀⢀⢠⣤⣄⢀⢀⢀⢀⢀⢀⢀⣤⣤⢀⢀⢀⢀⢀⢀⢀⢀⣀⣄⢀⢀⢠⣄⣀⢀⢀⢀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⣿⣷⡀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡟⡛⡛⡛⡛⡛⡛⡛⢁⢀⢀⢀⢀⢻⣿⣦⢀⢀⢀⢀⢠⣾⡿⢃⢀⢀⢀⢀⢀⣠⣾⣿⢿⡟⢀⢀⡙⢿⢿⣿⣦⡀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⡛⣿⣷⡀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡙⣿⡷⢀⢀⣰⣿⡟⢁⢀⢀⢀⢀⢀⣾⣿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⣿⡆⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⡈⢿⣷⡄⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣇⣀⣀⣀⣀⣀⣀⣀⢀⢀⢀⢀⢀⢀⢀⡈⢀⢀⣼⣿⢏⢀⢀⢀⢀⢀⢀⣼⣿⡏⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡘⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⡈⢿⣿⡄⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣿⢿⢿⢿⢿⢿⢿⢿⢇⢀⢀⢀⢀⢀⢀⢀⢠⣾⣿⣧⡀⢀⢀⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⡈⢿⣿⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣰⣿⡟⡛⣿⣷⡄⢀⢀⢀⢀⢀⢿⣿⣇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⡈⢿⢀⢀⢸⣿⡇⢀⢀⢀⢀⡛⡟⢁⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⡟⢀⢀⡈⢿⣿⣄⢀⢀⢀⢀⡘⣿⣿⣄⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⢏⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⢀⣀⣀⣀⣀⣀⣀⣀⣀⣀⡀⢀⢀⢀⣠⣾⡿⢃⢀⢀⢀⢀⢀⢻⣿⣧⡀⢀⢀⢀⡈⢻⣿⣷⣦⣄⢀⢀⣠⣤⣶⣿⡿⢋⢀⢀⢀⢀
+// ⢀⢀⢀⢿⢿⢀⢀⢀⢀⢀⢀⢀⢀⢸⢿⢃⢀⢀⢀⢀⢻⢿⢿⢿⢿⢿⢿⢿⢿⢿⢃⢀⢀⢀⢿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⡗⢀⢀⢀⢀⢀⡈⡉⡛⡛⢀⢀⢹⡛⢋⢁⢀⢀⢀⢀⢀⢀
+//
+//  Author:      Parallax Engine Team
+//  Date:        16/10/2026
+//  Description: Source file for the transform system
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include "TransformSystem.hpp"
+#include "TransformKernel.hpp"
+#include "ecs/JobSystem.hpp"
+#include "math/Affine.hpp"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <numeric>
+
+namespace parallax::system {
+    TransformSystem::TransformSystem()
+    {
+        m_removeObserver = coord->onRemove<components::TransformComponent>([this](const std::span<const ecs::Entity> removed) {
+            const ecs::Hierarchy &hierarchy = coord->getHierarchy();
+            for (const ecs::Entity entity : removed) {
+                if (hierarchy.contains(entity)) {
+                    m_transformRemoved = true;
+                    return;
+                }
+            }
+        });
+    }
+
+    TransformSystem::~TransformSystem()
+    {
+        if (coord)
+            coord->removeObserver(m_removeObserver);
+    }
+
+    void TransformSystem::update()
+    {
+        m_stats = {};
+        const auto &renderContext = getSingleton<components::RenderContext>();
+        if (renderContext.sceneRendered == -1)
+            return;
+
+        // Our own writes are stamped with m_lastUpdateTick and are not seen as changes next time
+        const ecs::Tick since = m_lastUpdateTick;
+        m_lastUpdateTick = coord->advanceTick();
+
+        const ecs::Hierarchy &hierarchy = coord->getHierarchy();
+        const bool reshaped = hierarchy.version() != m_hierarchyVersion || m_transformRemoved;
+        m_hierarchyVersion = hierarchy.version();
+        m_transformRemoved = false;
+
+        m_localDirty.assign(hierarchy.size(), 0);
+        m_stats.localMatrices = updateLocalMatrices(since, hierarchy);
+        m_stats.worldMatrices = updateWorldMatrices(hierarchy, reshaped);
+
+        // Writes made by the systems running after us must compare as changed on the next update
+        coord->advanceTick();
+    }
+
+    std::size_t TransformSystem::updateLocalMatrices(const ecs::Tick since, const ecs::Hierarchy &hierarchy)
+    {
+        // Each transform only depends on itself, so the dense array is split across the job system.
+        // Every job gathers its changed transforms and hands them to the SIMD kernel in one batch.
+        const auto transformComponentArray = coord->getComponentArray<components::TransformComponent>();
+        const std::span<components::TransformComponent> transforms = transformComponentArray->getAllComponents();
+        const std::span<const ecs::Tick> changeTicks = transformComponentArray->getChangeTicks();
+        const std::span<const ecs::Entity> owners = transformComponentArray->entities();
+
+        std::atomic<std::size_t> rebuilt{0};
+        ecs::JobSystem::getInstance().parallelFor(0, transforms.size(), ecs::DEFAULT_GRAIN_SIZE,
+            [this, transforms, changeTicks, owners, &hierarchy, &rebuilt, since](const std::size_t start, const std::size_t end) {
+                std::array<std::uint32_t, ecs::DEFAULT_GRAIN_SIZE> changed;
+                std::size_t pending = 0;
+                std::size_t count = 0;
+                const auto flush = [&] {
+                    const std::span<const std::uint32_t> indices(changed.data(), pending);
+                    composeLocalMatrices(transforms, indices);
+                    for (const std::uint32_t i : indices) {
+                        // Every entity owns its own flag, so concurrent writes never alias
+                        const std::uint32_t node = hierarchy.indexOf(owners[i]);
+                        if (node == ecs::PagedSparseIndex::INVALID_INDEX)
+                            transforms[i].worldMatrix = transforms[i].localMatrix;
+                        else
+                            m_localDirty[node] = 1;
+                    }
+                    count += pending;
+                    pending = 0;
+                };
+
+                // Ranges run inline can be longer than the grain size, the batch is flushed whenever it is full
+                for (std::size_t i = start; i < end; ++i) {
+                    if (changeTicks[i] <= since)
+                        continue;
+                    changed[pending++] = static_cast<std::uint32_t>(i);
+                    if (pending == changed.size())
+                        flush();
+                }
+                flush();
+                // Counts are summed per job to keep the shared counter out of the inner loop
+                rebuilt.fetch_add(count, std::memory_order_relaxed);
+            });
+        return rebuilt.load(std::memory_order_relaxed);
+    }
+
+    std::size_t TransformSystem::updateWorldMatrices(const ecs::Hierarchy &hierarchy, const bool everyNode)
+    {
+        if (hierarchy.version() != m_levelsVersion) {
+            rebuildLevels(hierarchy);
+            m_levelsVersion = hierarchy.version();
+        }
+        if (!everyNode && std::ranges::find(m_localDirty, 1) == m_localDirty.end())
+            return 0;
+
+        const std::span<const ecs::Entity> hierarchyEntities = hierarchy.entities();
+        const std::span<const std::uint32_t> parents = hierarchy.parents();
+        const auto transformComponentArray = coord->getComponentArray<components::TransformComponent>();
+        m_worldMatrices.resize(hierarchyEntities.size());
+        m_worldDirty.resize(hierarchyEntities.size());
+
+        // The nodes of a level only read the matrices of the previous one, so each level is split
+        // across the job system and the levels run one after the other. Every node does the same
+        // multiplication as a serial depth-first walk would, so the results are identical.
+        std::atomic<std::size_t> recomputed{0};
+        for (std::size_t level = 0; level + 1 < m_levelOffsets.size(); ++level) {
+            ecs::JobSystem::getInstance().parallelFor(m_levelOffsets[level], m_levelOffsets[level + 1], ecs::DEFAULT_GRAIN_SIZE,
+                [&](const std::size_t start, const std::size_t end) {
+                    std::size_t count = 0;
+                    for (std::size_t i = start; i < end; ++i) {
+                        const std::uint32_t node = m_levelNodes[i];
+                        const std::uint32_t parent = parents[node];
+                        // A node is world dirty when its local matrix or any of its ancestors changed
+                        const bool dirty = everyNode || m_localDirty[node]
+                            || (parent != ecs::Hierarchy::NO_PARENT && m_worldDirty[parent]);
+                        m_worldDirty[node] = dirty;
+                        if (!dirty)
+                            continue;
+
+                        const ecs::PagedSparseIndex::Index index = transformComponentArray->getDenseIndex(hierarchyEntities[node]);
+                        // Nodes without a transform pass their parent's matrix down
+                        if (index == ecs::PagedSparseIndex::INVALID_INDEX) {
+                            m_worldMatrices[node] = parent == ecs::Hierarchy::NO_PARENT ? glm::mat4x3(1.0f) : m_worldMatrices[parent];
+                            continue;
+                        }
+
+                        auto &transform = transformComponentArray->getAt(index);
+                        transform.worldMatrix = parent == ecs::Hierarchy::NO_PARENT
+                            ? transform.localMatrix
+                            : math::composeAffine(m_worldMatrices[parent], transform.localMatrix);
+                        m_worldMatrices[node] = transform.worldMatrix;
+                        ++count;
+                    }
+                    recomputed.fetch_add(count, std::memory_order_relaxed);
+                });
+        }
+        return recomputed.load(std::memory_order_relaxed);
+    }
+
+    void TransformSystem::rebuildLevels(const ecs::Hierarchy &hierarchy)
+    {
+        const std::span<const std::uint32_t> parents = hierarchy.parents();
+
+        // Parents come before their children, so depths are found in one forward pass
+        std::vector<std::uint32_t> depths(parents.size());
+        std::uint32_t maxDepth = 0;
+        for (std::size_t node = 0; node < parents.size(); ++node) {
+            depths[node] = parents[node] == ecs::Hierarchy::NO_PARENT ? 0 : depths[parents[node]] + 1;
+            maxDepth = std::max(maxDepth, depths[node]);
+        }
+
+        // Counting sort by depth, the nodes of a level stay in depth-first order
+        m_levelOffsets.assign(parents.empty() ? 1 : maxDepth + 2, 0);
+        for (const std::uint32_t depth : depths)
+            ++m_levelOffsets[depth + 1];
+        std::partial_sum(m_levelOffsets.begin(), m_levelOffsets.end(), m_levelOffsets.begin());
+
+        std::vector<std::uint32_t> cursors(m_levelOffsets.begin(), m_levelOffsets.end() - 1);
+        m_levelNodes.resize(parents.size());
+        for (std::uint32_t node = 0; node < depths.size(); ++node)
+            m_levelNodes[cursors[depths[node]]++] = node;
+    }
+}
@@ -0,0 +1,106 @@
+//// TransformSystem.hpp //////////////////////////////////////////////////////
+//
+// ⢀⢀⢀⣤⣤⣤⡀⢀⢀⢀⢀⢀⢀⢠⣤⡄⢀⢀⢀⢀⣠⣤⣤⣤⣤⣤⣤⣤⣤⣤⡀⢀⢀⢀⢠⣤⣄⢀⢀⢀⢀⢀⢀⢀⣤⣤⢀⢀⢀⢀⢀⢀⢀⢀⣀⣄⢀⢀⢠⣄⣀⢀⢀⢀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⣿⣷⡀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡟⡛⡛⡛⡛⡛⡛⡛⢁⢀⢀⢀⢀⢻⣿⣦⢀⢀⢀⢀⢠⣾⡿⢃⢀⢀⢀⢀⢀⣠⣾⣿⢿⡟⢀⢀⡙⢿⢿⣿⣦⡀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⡛⣿⣷⡀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡙⣿⡷⢀⢀⣰⣿⡟⢁⢀⢀⢀⢀⢀⣾⣿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⣿⡆⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⡈⢿⣷⡄⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣇⣀⣀⣀⣀⣀⣀⣀⢀⢀⢀⢀⢀⢀⢀⡈⢀⢀⣼⣿⢏⢀⢀⢀⢀⢀⢀⣼⣿⡏⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡘⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⡈⢿⣿⡄⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣿⢿⢿⢿⢿⢿⢿⢿⢇⢀⢀⢀⢀⢀⢀⢀⢠⣾⣿⣧⡀⢀⢀⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⡈⢿⣿⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣰⣿⡟⡛⣿⣷⡄⢀⢀⢀⢀⢀⢿⣿⣇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⡈⢿⢀⢀⢸⣿⡇⢀⢀⢀⢀⡛⡟⢁⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⡟⢀⢀⡈⢿⣿⣄⢀⢀⢀⢀⡘⣿⣿⣄⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⢏⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⢀⣀⣀⣀⣀⣀⣀⣀⣀⣀⡀⢀⢀⢀⣠⣾⡿⢃⢀⢀⢀⢀⢀⢻⣿⣧⡀⢀⢀⢀⡈⢻⣿⣷⣦⣄⢀⢀⣠⣤⣶⣿⡿⢋⢀⢀⢀⢀
+// ⢀⢀⢀⢿⢿⢀⢀⢀⢀⢀⢀⢀⢀⢸⢿⢃⢀⢀⢀⢀⢻⢿⢿⢿⢿⢿⢿⢿⢿⢿⢃⢀⢀⢀⢿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⡗⢀⢀⢀⢀⢀⡈⡉⡛⡛⢀⢀⢹⡛⢋⢁⢀⢀⢀⢀⢀⢀
+//
+//  Author:      Parallax Engine Team
+//  Date:        16/10/2026
+//  Description: System computing local and world matrices from the transform components
+//
+///////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include "ecs/QuerySystem.hpp"
+#include "components/Transform.hpp"
+#include "components/SceneComponents.hpp"
+#include "components/RenderContext.hpp"
+
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+namespace parallax::system {
+    /**
+     * @brief Number of matrices rebuilt by the last TransformSystem update
+     */
+    struct TransformUpdateStats {
+        std::size_t localMatrices = 0; ///< Local matrices rebuilt from pos / quat / size
+        std::size_t worldMatrices = 0; ///< World matrices of hierarchy nodes propagated from their parent
+    };
+
+    /**
+     * @class TransformSystem
+     * @brief System that keeps the local and world matrices of every transform up to date
+     *
+     * A local matrix is only rebuilt when its transform was written since the previous update,
+     * which acts as the local dirty flag. Entities outside the hierarchy use it as their world matrix.
+     * Hierarchy nodes whose local matrix changed mark their whole subtree world dirty, and only
+     * world dirty nodes are recomputed. World matrices are propagated one depth level at a time,
+     * each level in parallel. Every node is recomputed after the hierarchy changes shape.
+     */
+    class TransformSystem final : public ecs::QuerySystem<
+        ecs::Write<components::TransformComponent>,
+        ecs::Read<components::SceneTag>,
+        ecs::ReadSingleton<components::RenderContext>> {
+            public:
+                TransformSystem();
+                ~TransformSystem() override;
+
+                void update();
+
+                /**
+                 * @brief Gets the number of matrices rebuilt by the last update
+                 */
+                [[nodiscard]] const TransformUpdateStats &getStats() const { return m_stats; }
+
+            private:
+                /**
+                 * @brief Rebuilds the local matrices of the transforms written after since
+                 *
+                 * Every transform of the component array is considered, not only the ones of the
+                 * rendered scene. Flags the hierarchy nodes it touches in m_localDirty.
+                 *
+                 * @return The number of rebuilt matrices
+                 */
+                std::size_t updateLocalMatrices(ecs::Tick since, const ecs::Hierarchy &hierarchy);
+
+                /**
+                 * @brief Propagates the world matrices below every dirty hierarchy node
+                 *
+                 * The hierarchy is processed level by level, each level being split across the job system.
+                 * @param everyNode Recompute the whole hierarchy instead of the dirty subtrees only
+                 * @return The number of recomputed world matrices
+                 */
+                std::size_t updateWorldMatrices(const ecs::Hierarchy &hierarchy, bool everyNode);
+
+                /**
+                 * @brief Groups the hierarchy nodes by depth into m_levelNodes / m_levelOffsets
+                 */
+                void rebuildLevels(const ecs::Hierarchy &hierarchy);
+
+                // Tick of the previous update, transforms written after it get their matrices rebuilt
+                ecs::Tick m_lastUpdateTick = 0;
+                // Hierarchy version the world matrices were propagated for, they are all recomputed when it moves
+                std::uint64_t m_hierarchyVersion = std::numeric_limits<std::uint64_t>::max();
+                // Set when a hierarchy node loses its transform, its children then inherit from the next ancestor
+                bool m_transformRemoved = false;
+                ecs::ObserverId m_removeObserver = 0;
+
+                std::vector<std::uint8_t> m_localDirty; ///< Local dirty flag of each hierarchy node, indexed like the hierarchy
+                std::vector<std::uint8_t> m_worldDirty; ///< World dirty flag of each hierarchy node, set level by level
+                std::vector<glm::mat4x3> m_worldMatrices; ///< World matrices indexed like the hierarchy, read back by the children
+
+                // Hierarchy nodes sorted by depth, the nodes of level d being [m_levelOffsets[d], m_levelOffsets[d + 1])
+                std::vector<std::uint32_t> m_levelNodes;
+                std::vector<std::uint32_t> m_levelOffsets;
+                std::uint64_t m_levelsVersion = std::numeric_limits<std::uint64_t>::max();
+                TransformUpdateStats m_stats;
+    };
+}
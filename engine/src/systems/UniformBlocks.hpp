@@ -0,0 +1,114 @@
+//// UniformBlocks.hpp ////////////////////////////////////////////////////////
+//
+// ⢀⢀⢀⣤⣤⣤⡀⢀⢀⢀⢀⢀⢀⢠⣤⡄⢀⢀⢀⢀⣠⣤⣤⣤⣤⣤⣤⣤⣤⣤⡀⢀⢀⢀⢠⣤⣄⢀⢀⢀⢀⢀⢀⢀⣤⣤⢀⢀⢀⢀⢀⢀⢀⢀⣀⣄⢀⢀⢠⣄⣀⢀⢀⢀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⣿⣷⡀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡟⡛⡛⡛⡛⡛⡛⡛⢁⢀⢀⢀⢀⢻⣿⣦⢀⢀⢀⢀⢠⣾⡿⢃⢀⢀⢀⢀⢀⣠⣾⣿⢿⡟⢀⢀⡙⢿⢿⣿⣦⡀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⡛⣿⣷⡀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡙⣿⡷⢀⢀⣰⣿⡟⢁⢀⢀⢀⢀⢀⣾⣿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⣿⡆⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⡈⢿⣷⡄⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣇⣀⣀⣀⣀⣀⣀⣀⢀⢀⢀⢀⢀⢀⢀⡈⢀⢀⣼⣿⢏⢀⢀⢀⢀⢀⢀⣼⣿⡏⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡘⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⡈⢿⣿⡄⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣿⢿⢿⢿⢿⢿⢿⢿⢇⢀⢀⢀⢀⢀⢀⢀⢠⣾⣿⣧⡀⢀⢀⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⡈⢿⣿⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣰⣿⡟⡛⣿⣷⡄⢀⢀⢀⢀⢀⢿⣿⣇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⡈⢿⢀⢀⢸⣿⡇⢀⢀⢀⢀⡛⡟⢁⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⡟⢀⢀⡈⢿⣿⣄⢀⢀⢀⢀⡘⣿⣿⣄⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⢏⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⢀⣀⣀⣀⣀⣀⣀⣀⣀⣀⡀⢀⢀⢀⣠⣾⡿⢃⢀⢀⢀⢀⢀⢻⣿⣧⡀⢀⢀⢀⡈⢻⣿⣷⣦⣄⢀⢀⣠⣤⣶⣿⡿⢋⢀⢀⢀⢀
+// ⢀⢀⢀⢿⢿⢀⢀⢀⢀⢀⢀⢀⢀⢸⢿⢃⢀⢀⢀⢀⢻⢿⢿⢿⢿⢿⢿⢿⢿⢿⢃⢀⢀⢀⢿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⡗⢀⢀⢀⢀⢀⡈⡉⡛⡛⢀⢀⢹⡛⢋⢁⢀⢀⢀⢀⢀⢀
+//
+//  Author:      Parallax Engine Team
+//  Date:        16/10/2026
+//  Description: Header file for the layouts of the per-frame uniform blocks
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "components/Light.hpp"
+
+#include <cstddef>
+#include <glm/glm.hpp>
+
+namespace parallax::system {
+
+    /**
+     * @brief Binding point of the CameraBlock declared by the shaders
+     */
+    constexpr unsigned int CAMERA_BLOCK_BINDING = 0;
+
+    /**
+     * @brief Binding point of the LightsBlock declared by the shaders
+     */
+    constexpr unsigned int LIGHTS_BLOCK_BINDING = 1;
+
+    /**
+     * @brief Camera data shared by every draw of a camera, std140 layout
+     */
+    struct CameraBlock {
+        glm::mat4 viewProjection;
+        glm::vec3 cameraPosition;
+        float padding;
+    };
+    static_assert(offsetof(CameraBlock, cameraPosition) == 64);
+    static_assert(sizeof(CameraBlock) == 80, "CameraBlock must match the std140 layout of the shaders");
+
+    /**
+     * @brief Directional light as laid out in the LightsBlock
+     */
+    struct DirectionalLightData {
+        glm::vec3 direction;
+        float padding;
+        glm::vec4 color;
+    };
+    static_assert(sizeof(DirectionalLightData) == 32);
+
+    /**
+     * @brief Point light as laid out in the LightsBlock, the array stride is 48 bytes
+     */
+    struct PointLightData {
+        glm::vec3 position;
+        float padding0;
+        glm::vec4 color;
+        float constant;
+        float linear;
+        float quadratic;
+        float padding1;
+    };
+    static_assert(offsetof(PointLightData, constant) == 32);
+    static_assert(sizeof(PointLightData) == 48);
+
+    /**
+     * @brief Spot light as laid out in the LightsBlock, the array stride is 80 bytes
+     */
+    struct SpotLightData {
+        glm::vec3 position;
+        float padding0;
+        glm::vec3 direction;
+        float padding1;
+        glm::vec4 color;
+        float cutOff;
+        float outerCutoff;
+        float constant;
+        float linear;
+        float quadratic;
+        float padding2[3];
+    };
+    static_assert(offsetof(SpotLightData, cutOff) == 48);
+    static_assert(sizeof(SpotLightData) == 80);
+
+    /**
+     * @brief Scene lights shared by every lit draw, std140 layout
+     *
+     * Only the first numPointLights and numSpotLights entries of the arrays are meaningful.
+     */
+    struct LightsBlock {
+        DirectionalLightData dirLight;
+        glm::vec3 ambientLight;
+        int numPointLights;
+        int numSpotLights;
+        int padding[3];
+        PointLightData pointLights[MAX_POINT_LIGHTS];
+        SpotLightData spotLights[MAX_SPOT_LIGHTS];
+    };
+    static_assert(offsetof(LightsBlock, ambientLight) == 32);
+    static_assert(offsetof(LightsBlock, numPointLights) == 44);
+    static_assert(offsetof(LightsBlock, numSpotLights) == 48);
+    static_assert(offsetof(LightsBlock, pointLights) == 64);
+    static_assert(offsetof(LightsBlock, spotLights) == 64 + 48 * MAX_POINT_LIGHTS);
+    static_assert(sizeof(LightsBlock) == 64 + 48 * MAX_POINT_LIGHTS + 80 * MAX_SPOT_LIGHTS,
+                  "LightsBlock must match the std140 layout of the shaders");
+}
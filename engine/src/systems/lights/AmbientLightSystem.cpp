@@ -23,6 +23,12 @@
 #include "components/Light.hpp"
 
 namespace parallax::system {
+	AmbientLightSystem::AmbientLightSystem()
+		: m_scenePartition(m_group->getPartitionHandle<components::SceneTag, unsigned int>(
+			[](const components::SceneTag& tag) { return tag.id; }))
+	{
+	}
+
 	void AmbientLightSystem::update()
 	{
 		auto &renderContext = getSingleton<components::RenderContext>();
@@ -31,9 +37,7 @@ namespace parallax::system {
 
 		const auto sceneRendered = static_cast<unsigned int>(renderContext.sceneRendered);
 
-		const auto scenePartition = m_group->getPartitionView<components::SceneTag, unsigned int>(
-			[](const components::SceneTag& tag) { return tag.id; }
-		);
+		const auto scenePartition = m_group->getPartitionView(m_scenePartition);
 
 		const auto *partition = scenePartition.getPartition(sceneRendered);
 
@@ -32,7 +32,7 @@ namespace parallax::system {
 	* @note Component Access Rights:
 	*  - READ access to components::AmbientLightComponent (owned)
 	*  - READ access to components::SceneTag (non-owned)
-	*  - WRITE access to components::RenderContext (singleton)
+	*  - WRITE access to components::RenderContext (singleton, ambient light part)
 	*
 	* @note The system uses scene partitioning to only process ambient light entities
 	* belonging to the currently active scene (identified by RenderContext.sceneRendered).
@@ -42,8 +42,12 @@ namespace parallax::system {
 			ecs::Read<components::AmbientLightComponent>>,
         ecs::NonOwned<
         	ecs::Read<components::SceneTag>>,
-    	ecs::WriteSingleton<components::RenderContext>> {
+    	ecs::WriteSingleton<components::RenderContext, components::RenderContext::AmbientLightPart>> {
 			public:
+				AmbientLightSystem();
 				void update();
+
+			private:
+				ecs::PartitionHandle<unsigned int> m_scenePartition; ///< Partitioning of the group by scene ID
 	};
 }
@@ -25,6 +25,12 @@
 #include "Application.hpp"
 
 namespace parallax::system {
+	PointLightsSystem::PointLightsSystem()
+		: m_scenePartition(m_group->getPartitionHandle<components::SceneTag, unsigned int>(
+			[](const components::SceneTag& tag) { return tag.id; }))
+	{
+	}
+
 	void PointLightsSystem::update()
 	{
 		auto &renderContext = getSingleton<components::RenderContext>();
@@ -33,9 +39,7 @@ namespace parallax::system {
 
 		const auto sceneRendered = static_cast<unsigned int>(renderContext.sceneRendered);
 
-		const auto scenePartition = m_group->getPartitionView<components::SceneTag, unsigned int>(
-			[](const components::SceneTag& tag) { return tag.id; }
-		);
+		const auto scenePartition = m_group->getPartitionView(m_scenePartition);
 
 		const auto *partition = scenePartition.getPartition(sceneRendered);
 
@@ -33,7 +33,7 @@ namespace parallax::system {
 	* @note Component Access Rights:
 	*  - READ access to components::PointLightComponent (owned)
 	*  - READ access to components::SceneTag (non-owned)
-	*  - WRITE access to components::RenderContext (singleton)
+	*  - WRITE access to components::RenderContext (singleton, point lights part)
 	*
 	* @note The system uses scene partitioning to only process point light entities
 	* belonging to the currently active scene (identified by RenderContext.sceneRendered).
@@ -45,8 +45,12 @@ namespace parallax::system {
 			ecs::Read<components::PointLightComponent>>,
         ecs::NonOwned<
         	ecs::Read<components::SceneTag>>,
-    	ecs::WriteSingleton<components::RenderContext>> {
+    	ecs::WriteSingleton<components::RenderContext, components::RenderContext::PointLightsPart>> {
 		public:
+			PointLightsSystem();
 			void update();
+
+		private:
+			ecs::PartitionHandle<unsigned int> m_scenePartition; ///< Partitioning of the group by scene ID
 	};
 }
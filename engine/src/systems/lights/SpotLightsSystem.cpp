@@ -24,6 +24,12 @@
 #include "Application.hpp"
 
 namespace parallax::system {
+	SpotLightsSystem::SpotLightsSystem()
+		: m_scenePartition(m_group->getPartitionHandle<components::SceneTag, unsigned int>(
+			[](const components::SceneTag& tag) { return tag.id; }))
+	{
+	}
+
 	void SpotLightsSystem::update()
 	{
 		auto &renderContext = getSingleton<components::RenderContext>();
@@ -32,9 +38,7 @@ namespace parallax::system {
 
 		const auto sceneRendered = static_cast<unsigned int>(renderContext.sceneRendered);
 
-		const auto scenePartition = m_group->getPartitionView<components::SceneTag, unsigned int>(
-			[](const components::SceneTag& tag) { return tag.id; }
-		);
+		const auto scenePartition = m_group->getPartitionView(m_scenePartition);
 
 		const auto *partition = scenePartition.getPartition(sceneRendered);
 
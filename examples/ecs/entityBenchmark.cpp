@@ -0,0 +1,82 @@
+#include <iostream>
+#include <chrono>
+#include <string>
+#include <vector>
+#include <random>
+#include <algorithm>
+#include <iomanip>
+#include <memory>
+#include "ecs/Entity.hpp"
+
+// This benchmark measures the cost of the EntityManager operations that used to scale with the number of
+// living entities:
+//  - Startup: constructing the manager (used to push all MAX_ENTITIES ids into a deque)
+//  - Destroy: destroying every living entity in random order (used to be a linear search per destroy)
+// Results are printed as a table, one row per living entity count.
+
+using Clock = std::chrono::high_resolution_clock;
+
+static double elapsedMs(const Clock::time_point start)
+{
+    const std::chrono::duration<double, std::milli> duration = Clock::now() - start;
+    return duration.count();
+}
+
+struct BenchmarkResult {
+    size_t livingEntities;
+    double startupMs;
+    double createMs;
+    double destroyMs;
+};
+
+static BenchmarkResult runBenchmark(const size_t livingEntities, std::mt19937 &gen)
+{
+    BenchmarkResult result{livingEntities, 0.0, 0.0, 0.0};
+
+    auto start = Clock::now();
+    auto manager = std::make_unique<parallax::ecs::EntityManager>();
+    result.startupMs = elapsedMs(start);
+
+    std::vector<parallax::ecs::Entity> entities;
+    entities.reserve(livingEntities);
+
+    start = Clock::now();
+    for (size_t i = 0; i < livingEntities; ++i)
+        entities.push_back(manager->createEntity());
+    result.createMs = elapsedMs(start);
+
+    // Random order is the worst case for the living list since destroyed entities are spread everywhere
+    std::ranges::shuffle(entities, gen);
+
+    start = Clock::now();
+    for (const parallax::ecs::Entity entity : entities)
+        manager->destroyEntity(entity);
+    result.destroyMs = elapsedMs(start);
+
+    return result;
+}
+
+int main()
+{
+    std::mt19937 gen(42);
+    const std::vector<size_t> livingCounts = {1000, 10000, 50000, 100000, 250000, parallax::ecs::MAX_ENTITIES};
+
+    std::cout << std::left
+              << std::setw(16) << "living"
+              << std::setw(16) << "startup (ms)"
+              << std::setw(16) << "create (ms)"
+              << std::setw(16) << "destroy (ms)"
+              << "destroy/entity (ns)" << std::endl;
+
+    for (const size_t count : livingCounts) {
+        const BenchmarkResult result = runBenchmark(count, gen);
+        std::cout << std::left << std::fixed << std::setprecision(3)
+                  << std::setw(16) << result.livingEntities
+                  << std::setw(16) << result.startupMs
+                  << std::setw(16) << result.createMs
+                  << std::setw(16) << result.destroyMs
+                  << (result.destroyMs * 1e6 / static_cast<double>(result.livingEntities)) << std::endl;
+    }
+
+    return 0;
+}
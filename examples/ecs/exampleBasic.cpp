@@ -80,7 +80,9 @@ class QueryBenchmarkSystem : public parallax::ecs::QuerySystem<
 			log("Running query system benchmarks with " + std::to_string(entities.size()) + " entities");
 	        constexpr int NUM_ITERATIONS = 100;
 	        auto queryTime = benchmarkQuery(NUM_ITERATIONS);
-	        log("Query System: " + std::to_string(queryTime) + " milliseconds per iteration");
+	        log("Query System (getComponent): " + std::to_string(queryTime) + " milliseconds per iteration");
+	        auto forEachTime = benchmarkForEach(NUM_ITERATIONS);
+	        log("Query System (forEach): " + std::to_string(forEachTime) + " milliseconds per iteration");
 	    }
 
 	private:
@@ -118,6 +120,24 @@ class QueryBenchmarkSystem : public parallax::ecs::QuerySystem<
 	        std::chrono::duration<double, std::milli> duration = end - start;
 	        return duration.count() / numIterations;
 	    }
+
+	    // Same workload through forEach: the components are handed to the lambda directly,
+	    // Velocity comes in as a const reference since it is declared as Read
+	    double benchmarkForEach(int numIterations)
+	    {
+	        auto start = std::chrono::high_resolution_clock::now();
+
+	        for (int i = 0; i < numIterations; i++) {
+	            forEach([](parallax::ecs::Entity, Position &position, const Velocity &velocity) {
+	                position.x += velocity.x;
+	                position.y += velocity.y;
+	            });
+	        }
+
+	        auto end = std::chrono::high_resolution_clock::now();
+	        std::chrono::duration<double, std::milli> duration = end - start;
+	        return duration.count() / numIterations;
+	    }
 };
 
 // This a basic full-owning group system
@@ -321,6 +341,19 @@ int main() {
     auto &gameConfig = coordinator.getSingletonComponent<GameConfig>();
     log("Max entities: " + std::to_string(gameConfig.maxEntities));
 
+    // Snapshot and restore of a 100k entity world, as done when entering and leaving play mode
+    log("\n=== Starting Snapshot Benchmark ===");
+    coordinator.createEntities(100000 - entities.size(), Position{1.0f, 2.0f}, Velocity{0.5f, 0.5f});
+    auto start = std::chrono::high_resolution_clock::now();
+    const parallax::ecs::WorldSnapshot snapshot = coordinator.snapshot();
+    const std::chrono::duration<double, std::milli> snapshotTime = std::chrono::high_resolution_clock::now() - start;
+    start = std::chrono::high_resolution_clock::now();
+    coordinator.restore(snapshot);
+    const std::chrono::duration<double, std::milli> restoreTime = std::chrono::high_resolution_clock::now() - start;
+    log("Snapshot: " + std::to_string(snapshot.data.size() / 1024) + " KiB in " + std::to_string(snapshotTime.count()) + " ms");
+    log("Restore: " + std::to_string(restoreTime.count()) + " ms");
+    log("=== Snapshot Benchmark Complete ===");
+
 
     return 0;
 }
@@ -0,0 +1,114 @@
+#include <iostream>
+#include <chrono>
+#include <string>
+#include <vector>
+#include <random>
+#include <algorithm>
+#include <iomanip>
+#include <limits>
+#include "systems/TransformKernel.hpp"
+#include "math/Affine.hpp"
+
+#define GLM_ENABLE_EXPERIMENTAL
+#include <glm/gtx/quaternion.hpp>
+
+// This benchmark compares the ways of rebuilding the local matrix of every transform of a dense array:
+//  - glm: translate * toMat4(quat) * scale, what the transform systems used to do per entity
+//  - scalar / sse / avx2: the batched TRS kernel forced on each path supported by this CPU
+// Each measure keeps the best of several runs. Results are printed as a table, one row per transform count.
+
+using Clock = std::chrono::high_resolution_clock;
+using parallax::components::TransformComponent;
+using parallax::system::TransformKernelPath;
+
+static constexpr int RUNS = 5;
+
+static double elapsedMs(const Clock::time_point start)
+{
+    const std::chrono::duration<double, std::milli> duration = Clock::now() - start;
+    return duration.count();
+}
+
+static std::vector<TransformComponent> randomTransforms(const size_t count, std::mt19937 &gen)
+{
+    std::uniform_real_distribution<float> position(-100.0f, 100.0f);
+    std::uniform_real_distribution<float> scale(0.1f, 10.0f);
+    std::uniform_real_distribution<float> unit(-1.0f, 1.0f);
+
+    std::vector<TransformComponent> transforms(count);
+    for (auto &transform : transforms) {
+        transform.pos = {position(gen), position(gen), position(gen)};
+        transform.size = {scale(gen), scale(gen), scale(gen)};
+        transform.quat = glm::normalize(glm::quat(unit(gen), unit(gen), unit(gen), unit(gen)));
+    }
+    return transforms;
+}
+
+template<typename Func>
+static double bestOf(Func func)
+{
+    double best = std::numeric_limits<double>::max();
+    for (int run = 0; run < RUNS; ++run) {
+        const auto start = Clock::now();
+        func();
+        best = std::min(best, elapsedMs(start));
+    }
+    return best;
+}
+
+static double runGlm(std::vector<TransformComponent> &transforms)
+{
+    return bestOf([&transforms] {
+        for (auto &transform : transforms) {
+            transform.localMatrix = parallax::math::mat4ToAffine(glm::translate(glm::mat4(1.0f), transform.pos) *
+                                                                 glm::toMat4(transform.quat) *
+                                                                 glm::scale(glm::mat4(1.0f), transform.size));
+        }
+    });
+}
+
+static double runKernel(std::vector<TransformComponent> &transforms, const TransformKernelPath path)
+{
+    if (!parallax::system::isTransformKernelPathSupported(path))
+        return -1.0;
+    return bestOf([&transforms, path] {
+        parallax::system::composeLocalMatrices(transforms, path);
+    });
+}
+
+int main()
+{
+    std::mt19937 gen(42);
+    const std::vector<size_t> transformCounts = {10000, 100000, 1000000};
+    const std::vector<std::pair<std::string, TransformKernelPath>> paths = {
+        {"scalar (ms)", TransformKernelPath::Scalar},
+        {"sse (ms)", TransformKernelPath::Sse},
+        {"avx2 (ms)", TransformKernelPath::Avx2},
+    };
+
+    std::cout << std::left << std::setw(12) << "transforms" << std::setw(14) << "glm (ms)";
+    for (const auto &[name, path] : paths)
+        std::cout << std::setw(14) << name;
+    std::cout << "best speedup" << std::endl;
+
+    for (const size_t count : transformCounts) {
+        auto transforms = randomTransforms(count, gen);
+        const double glmMs = runGlm(transforms);
+
+        std::cout << std::left << std::fixed << std::setprecision(3)
+                  << std::setw(12) << count << std::setw(14) << glmMs;
+        double bestMs = glmMs;
+        for (const auto &[name, path] : paths) {
+            const double ms = runKernel(transforms, path);
+            if (ms < 0.0) {
+                std::cout << std::setw(14) << "n/a";
+                continue;
+            }
+            bestMs = std::min(bestMs, ms);
+            std::cout << std::setw(14) << ms;
+        }
+        std::cout << std::setprecision(2) << glmMs / bestMs << "x" << std::endl;
+    }
+
+    return 0;
+}
@@ -18,9 +18,11 @@
 #type vertex
 #version 430
 
-uniform mat4 uViewProjection = mat4(1.0);
+layout(std140, binding = 0) uniform CameraBlock {
+    mat4 uViewProjection;
+    vec3 uCamPos;
+};
 uniform float uGridSize;
-uniform vec3 uCamPos;
 
 out vec3 FragPos;
 
@@ -70,7 +72,10 @@ in vec3 FragPos;
 
 uniform vec3 uMouseWorldPos;
 uniform float uTime;
-uniform vec3 uCamPos;
+layout(std140, binding = 0) uniform CameraBlock {
+    mat4 uViewProjection;
+    vec3 uCamPos;
+};
 uniform float uGridSize = 100.0;
 uniform float uGridMinPixelsBetweenCells = 2.0;
 uniform float uGridCellSize = 0.025;
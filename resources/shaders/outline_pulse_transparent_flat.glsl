@@ -3,7 +3,10 @@
 layout(location = 0) in vec2 aPos;
 layout(location = 1) in vec2 aTexCoord;
 
-uniform mat4 uViewProjection;
+layout(std140, binding = 0) uniform CameraBlock {
+    mat4 uViewProjection;
+    vec3 uCamPos;
+};
 uniform mat4 uMatModel;
 
 out vec2 vTexCoord;
@@ -24,8 +27,24 @@ in vec2 vTexCoord;
 struct Material {
     vec4 albedoColor;
     int albedoTexIndex; // Default: 0 (white texture)
+    vec4 specularColor;
+    int specularTexIndex; // Default: 0 (white texture)
+    vec3 emissiveColor;
+    int emissiveTexIndex; // Default: 0 (white texture)
+    float roughness;
+    int roughnessTexIndex; // Default: 0 (white texture)
+    float metallic;
+    int metallicTexIndex; // Default: 0 (white texture)
+    float opacity;
+    int opacityTexIndex; // Default: 0 (white texture)
+    int normalTexIndex; // Default: 0 (no normal map)
+    float normalStrength;
+};
+layout(std430, binding = 2) readonly buffer MaterialsBlock {
+    Material uMaterials[];
 };
-uniform Material uMaterial;
+uniform int uMaterialIndex;
+#define uMaterial uMaterials[uMaterialIndex]
 
 uniform sampler2D uTexture[31];
 uniform float uTime;
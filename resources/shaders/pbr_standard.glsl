@@ -6,7 +6,10 @@ layout(location = 2) in vec3 aNormal;
 layout(location = 3) in vec3 aTangent;
 layout(location = 4) in vec3 aBitangent;
 
-uniform mat4 uViewProjection;
+layout(std140, binding = 0) uniform CameraBlock {
+    mat4 uViewProjection;
+    vec3 uCamPos;
+};
 uniform mat4 uMatModel;
 
 out vec3 vFragPos;
@@ -76,32 +79,41 @@ in mat3 vTBN;
 
 uniform sampler2D uTexture[32];
 
-uniform vec3 uCamPos;
+layout(std140, binding = 0) uniform CameraBlock {
+    mat4 uViewProjection;
+    vec3 uCamPos;
+};
 
-uniform vec3 uAmbientLight;
-uniform DirectionalLight uDirLight;
-uniform PointLight uPointLights[MAX_POINT_LIGHTS];
-uniform int uNumPointLights;
-uniform SpotLight uSpotLights[MAX_SPOT_LIGHTS];
-uniform int uNumSpotLights;
+layout(std140, binding = 1) uniform LightsBlock {
+    DirectionalLight uDirLight;
+    vec3 uAmbientLight;
+    int uNumPointLights;
+    int uNumSpotLights;
+    PointLight uPointLights[MAX_POINT_LIGHTS];
+    SpotLight uSpotLights[MAX_SPOT_LIGHTS];
+};
 
 struct Material {
     vec4 albedoColor;
-    int albedoTexIndex;
+    int albedoTexIndex; // Default: 0 (white texture)
     vec4 specularColor;
-    int specularTexIndex;
+    int specularTexIndex; // Default: 0 (white texture)
     vec3 emissiveColor;
-    int emissiveTexIndex;
+    int emissiveTexIndex; // Default: 0 (white texture)
     float roughness;
-    int roughnessTexIndex;
+    int roughnessTexIndex; // Default: 0 (white texture)
     float metallic;
-    int metallicTexIndex;
+    int metallicTexIndex; // Default: 0 (white texture)
     float opacity;
-    int opacityTexIndex;
-    int normalTexIndex;  // Normal map
+    int opacityTexIndex; // Default: 0 (white texture)
+    int normalTexIndex; // Default: 0 (no normal map)
     float normalStrength;
 };
-uniform Material uMaterial;
+layout(std430, binding = 2) readonly buffer MaterialsBlock {
+    Material uMaterials[];
+};
+uniform int uMaterialIndex;
+#define uMaterial uMaterials[uMaterialIndex]
 
 uniform int uEntityId;
 
@@ -4,7 +4,10 @@ layout(location = 0) in vec3 aPos;
 layout(location = 1) in vec2 aTexCoord;
 layout(location = 2) in vec3 aNormal;
 
-uniform mat4 uViewProjection;
+layout(std140, binding = 0) uniform CameraBlock {
+    mat4 uViewProjection;
+    vec3 uCamPos;
+};
 uniform mat4 uMatModel;
 
 out vec3 vFragPos;
@@ -63,14 +66,19 @@ in vec3 vNormal;
 
 uniform sampler2D uTexture[32];
 
-uniform vec3 uCamPos;
+layout(std140, binding = 0) uniform CameraBlock {
+    mat4 uViewProjection;
+    vec3 uCamPos;
+};
 
-uniform vec3 uAmbientLight;
-uniform DirectionalLight uDirLight;
-uniform PointLight uPointLights[MAX_POINT_LIGHTS];
-uniform int uNumPointLights;
-uniform SpotLight uSpotLights[MAX_SPOT_LIGHTS];
-uniform int uNumSpotLights;
+layout(std140, binding = 1) uniform LightsBlock {
+    DirectionalLight uDirLight;
+    vec3 uAmbientLight;
+    int uNumPointLights;
+    int uNumSpotLights;
+    PointLight uPointLights[MAX_POINT_LIGHTS];
+    SpotLight uSpotLights[MAX_SPOT_LIGHTS];
+};
 
 struct Material {
     vec4 albedoColor;
@@ -85,8 +93,14 @@ struct Material {
     int metallicTexIndex; // Default: 0 (white texture)
     float opacity;
     int opacityTexIndex; // Default: 0 (white texture)
+    int normalTexIndex; // Default: 0 (no normal map)
+    float normalStrength;
+};
+layout(std430, binding = 2) readonly buffer MaterialsBlock {
+    Material uMaterials[];
 };
-uniform Material uMaterial;
+uniform int uMaterialIndex;
+#define uMaterial uMaterials[uMaterialIndex]
 
 uniform int uEntityId;
 
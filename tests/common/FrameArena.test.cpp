@@ -0,0 +1,115 @@
+//// FrameArena.test.cpp //////////////////////////////////////////////////////
+//
+// ⢀⢀⢀⣤⣤⣤⡀⢀⢀⢀⢀⢀⢀⢠⣤⡄⢀⢀⢀⢀⣠⣤⣤⣤⣤⣤⣤⣤⣤⣤⡀⢀⢀⢀⢠⣤⣄⢀⢀⢀⢀⢀⢀⢀⣤⣤⢀⢀⢀⢀⢀⢀⢀⢀⣀⣄⢀⢀⢠⣄⣀⢀⢀⢀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⣿⣷⡀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡟⡛⡛⡛⡛⡛⡛⡛⢁⢀⢀⢀⢀⢻⣿⣦⢀⢀⢀⢀⢠⣾⡿⢃⢀⢀⢀⢀⢀⣠⣾⣿⢿⡟⢀⢀⡙⢿⢿⣿⣦⡀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⡛⣿⣷⡀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡙⣿⡷⢀⢀⣰⣿⡟⢁⢀⢀⢀⢀⢀⣾⣿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⣿⡆⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⡈⢿⣷⡄⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣇⣀⣀⣀⣀⣀⣀⣀⢀⢀⢀⢀⢀⢀⢀⡈⢀⢀⣼⣿⢏⢀⢀⢀⢀⢀⢀⣼⣿⡏⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡘⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⡈⢿⣿⡄⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣿⢿⢿⢿⢿⢿⢿⢿⢇⢀⢀⢀⢀⢀⢀⢀⢠⣾⣿⣧⡀⢀⢀⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⡈⢿⣿⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣰⣿⡟⡛⣿⣷⡄⢀⢀⢀⢀⢀⢿⣿⣇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⡈⢿⢀⢀⢸⣿⡇⢀⢀⢀⢀⡛⡟⢁⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⡟⢀⢀⡈⢿⣿⣄⢀⢀⢀⢀⡘⣿⣿⣄⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⢏⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⢀⣀⣀⣀⣀⣀⣀⣀⣀⣀⡀⢀⢀⢀⣠⣾⡿⢃⢀⢀⢀⢀⢀⢻⣿⣧⡀⢀⢀⢀⡈⢻⣿⣷⣦⣄⢀⢀⣠⣤⣶⣿⡿⢋⢀⢀⢀⢀
+// ⢀⢀⢀⢿⢿⢀⢀⢀⢀⢀⢀⢀⢀⢸⢿⢃⢀⢀⢀⢀⢻⢿⢿⢿⢿⢿⢿⢿⢿⢿⢃⢀⢀⢀⢿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⡗⢀⢀⢀⢀⢀⡈⡉⡛⡛⢀⢀⢹⡛⢋⢁⢀⢀⢀⢀⢀⢀
+//
+//  Author:      Parallax Engine Team
+//  Date:        16/10/2026
+//  Description: Test file for the per-frame linear arena allocator
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <gtest/gtest.h>
+#include "FrameArena.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace parallax {
+
+    class FrameArenaTest : public ::testing::Test {
+        protected:
+            static constexpr std::size_t BLOCK_SIZE = 4096;
+            FrameArena arena{BLOCK_SIZE};
+    };
+
+    TEST_F(FrameArenaTest, AllocationsAreAlignedAndDisjoint) {
+        std::vector<std::pair<std::uintptr_t, std::size_t>> ranges;
+        for (std::size_t i = 1; i <= 64; ++i) {
+            const std::size_t alignment = std::size_t{1} << (i % 7);
+            void *p = arena.allocate(i * 3, alignment);
+            EXPECT_EQ(reinterpret_cast<std::uintptr_t>(p) % alignment, 0u);
+            ranges.emplace_back(reinterpret_cast<std::uintptr_t>(p), i * 3);
+        }
+
+        std::ranges::sort(ranges);
+        for (std::size_t i = 1; i < ranges.size(); ++i)
+            EXPECT_LE(ranges[i - 1].first + ranges[i - 1].second, ranges[i].first);
+    }
+
+    TEST_F(FrameArenaTest, ResetReportsTheFrameAndMergesItsBlocks) {
+        for (int i = 0; i < 10; ++i)
+            arena.allocate(1000, 8);
+
+        const FrameAllocationStats frame = arena.reset();
+        EXPECT_EQ(frame.allocations, 10u);
+        EXPECT_GE(frame.bytesAllocated, 10000u);
+        EXPECT_EQ(frame.upstreamAllocations, 3u);
+        EXPECT_EQ(frame.capacity, 3 * BLOCK_SIZE);
+
+        // The same frame now fits in the merged block
+        for (int i = 0; i < 10; ++i)
+            arena.allocate(1000, 8);
+        const FrameAllocationStats next = arena.stats();
+        EXPECT_EQ(next.allocations, 10u);
+        EXPECT_EQ(next.upstreamAllocations, 0u);
+        EXPECT_EQ(next.capacity, 3 * BLOCK_SIZE);
+    }
+
+    TEST_F(FrameArenaTest, OnlyTheLastAllocationIsGivenBack) {
+        void *first = arena.allocate(64, 8);
+        void *second = arena.allocate(64, 8);
+
+        arena.deallocate(first, 64, 8);
+        EXPECT_NE(arena.allocate(64, 8), first);
+
+        void *third = arena.allocate(64, 8);
+        arena.deallocate(third, 64, 8);
+        EXPECT_EQ(arena.allocate(64, 8), third);
+        EXPECT_NE(second, third);
+    }
+
+    TEST_F(FrameArenaTest, BackPmrContainers) {
+        std::pmr::vector<int> values(&arena);
+        for (int i = 0; i < 1000; ++i)
+            values.push_back(i);
+
+        EXPECT_EQ(values.size(), 1000u);
+        EXPECT_EQ(values[999], 999);
+        EXPECT_GT(arena.stats().allocations, 0u);
+    }
+
+    TEST_F(FrameArenaTest, ConcurrentAllocationsDoNotOverlap) {
+        constexpr std::size_t THREADS = 4;
+        constexpr std::size_t ALLOCATIONS = 2000;
+        std::vector<std::vector<std::uintptr_t>> results(THREADS);
+
+        std::vector<std::thread> threads;
+        for (std::size_t t = 0; t < THREADS; ++t) {
+            threads.emplace_back([this, &results, t] {
+                for (std::size_t i = 0; i < ALLOCATIONS; ++i)
+                    results[t].push_back(reinterpret_cast<std::uintptr_t>(arena.allocate(24, 8)));
+            });
+        }
+        for (auto &thread : threads)
+            thread.join();
+
+        std::vector<std::uintptr_t> all;
+        for (const auto &result : results)
+            all.insert(all.end(), result.begin(), result.end());
+        std::ranges::sort(all);
+        for (std::size_t i = 1; i < all.size(); ++i)
+            EXPECT_GE(all[i] - all[i - 1], 24u);
+        EXPECT_EQ(arena.stats().allocations, THREADS * ALLOCATIONS);
+    }
+}
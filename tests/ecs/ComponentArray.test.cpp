@@ -20,6 +20,8 @@
 #include "ComponentArray.hpp"
 #include "ECSExceptions.hpp"
 
+#include <string>
+
 namespace parallax::ecs {
 
     struct TestComponent {
@@ -389,4 +391,146 @@ namespace parallax::ecs {
         EXPECT_EQ(componentArray->get(2).value, 20);
         EXPECT_EQ(componentArray->get(4).value, 40);
     }
+
+    // =========================================================
+    // ================== CHANGE DETECTION =====================
+    // =========================================================
+
+    TEST_F(ComponentArrayTest, InsertStampsCurrentTick) {
+        EXPECT_EQ(componentArray->getChangeTick(0), FIRST_TICK);
+
+        componentArray->setCurrentTick(5);
+        componentArray->insert(10, TestComponent{100});
+
+        EXPECT_EQ(componentArray->getChangeTick(10), 5);
+        EXPECT_EQ(componentArray->getChangeTick(0), FIRST_TICK);
+        EXPECT_EQ(componentArray->getChangeTick(42), 0); // Missing component
+    }
+
+    TEST_F(ComponentArrayTest, MarkChangedUpdatesOnlyTargetEntity) {
+        componentArray->setCurrentTick(3);
+        componentArray->markChanged(2);
+
+        EXPECT_TRUE(componentArray->isChangedSince(2, 2));
+        EXPECT_FALSE(componentArray->isChangedSince(2, 3));
+        EXPECT_FALSE(componentArray->isChangedSince(1, FIRST_TICK));
+        EXPECT_THROW(componentArray->markChanged(42), ComponentNotFound);
+    }
+
+    TEST_F(ComponentArrayTest, ChangeTicksFollowComponentsOnSwap) {
+        componentArray->setCurrentTick(7);
+        componentArray->markChanged(4);
+
+        // Removing entity 0 moves entity 4 into its slot
+        componentArray->remove(0);
+        EXPECT_EQ(componentArray->getChangeTick(4), 7);
+
+        // Grouping swaps entity 4 to the front of the array
+        componentArray->addToGroup(4);
+        EXPECT_EQ(componentArray->getChangeTickAt(0), 7);
+        EXPECT_EQ(componentArray->getChangeTick(4), 7);
+
+        componentArray->removeFromGroup(4);
+        EXPECT_EQ(componentArray->getChangeTick(4), 7);
+        EXPECT_EQ(componentArray->getChangeTicks().size(), componentArray->size());
+    }
+
+    // =========================================================
+    // ================== SPARSE INDEX =========================
+    // =========================================================
+
+    TEST_F(ComponentArrayTest, SparsePagesAreAllocatedOnDemand) {
+        const ComponentMemoryUsage before = componentArray->memoryUsage();
+        EXPECT_EQ(before.sparse, PagedSparseIndex::PAGE_SIZE * sizeof(PagedSparseIndex::Index));
+
+        // A distant entity only costs one extra page, not a sparse slot for every ID below it
+        const Entity farEntity = MAX_ENTITIES - 1;
+        componentArray->insert(farEntity, TestComponent{42});
+        const ComponentMemoryUsage withFarEntity = componentArray->memoryUsage();
+        EXPECT_EQ(withFarEntity.sparse, 2 * before.sparse);
+        EXPECT_GT(withFarEntity.pageOverhead, before.pageOverhead);
+        EXPECT_EQ(withFarEntity.total(), withFarEntity.dense + withFarEntity.sparse + withFarEntity.pageOverhead);
+        EXPECT_EQ(componentArray->get(farEntity).value, 42);
+
+        // The page is released with its last entity
+        componentArray->remove(farEntity);
+        EXPECT_EQ(componentArray->memoryUsage().sparse, before.sparse);
+        EXPECT_FALSE(componentArray->hasComponent(farEntity));
+        EXPECT_FALSE(componentArray->hasComponent(farEntity - 1));
+    }
+
+    TEST_F(ComponentArrayTest, SparseIndexSurvivesGroupSwaps) {
+        const Entity farEntity = 3 * PagedSparseIndex::PAGE_SIZE + 7;
+        componentArray->insert(farEntity, TestComponent{70});
+        componentArray->addToGroup(farEntity);
+        componentArray->addToGroup(2);
+
+        EXPECT_EQ(componentArray->getEntityAtIndex(0), farEntity);
+        EXPECT_EQ(componentArray->get(farEntity).value, 70);
+        EXPECT_EQ(componentArray->get(0).value, 0);
+
+        componentArray->remove(farEntity);
+        EXPECT_EQ(componentArray->groupSize(), 1);
+        for (Entity i = 0; i < 5; ++i)
+            EXPECT_EQ(componentArray->get(i).value, static_cast<int>(i * 10));
+    }
+
+    TEST_F(ComponentArrayTest, SnapshotRestoresDenseOrderAndGroupRegion) {
+        componentArray->addToGroup(3);
+        componentArray->addToGroup(1);
+        WorldSnapshot snapshot;
+        SnapshotWriter writer(snapshot.data);
+        componentArray->snapshot(writer);
+
+        componentArray->remove(3);
+        componentArray->insert(42, TestComponent{420});
+        componentArray->get(0).value = -1;
+
+        SnapshotReader reader(snapshot.data);
+        componentArray->restore(reader);
+        EXPECT_TRUE(reader.atEnd());
+        ASSERT_EQ(componentArray->size(), 5);
+        EXPECT_EQ(componentArray->groupSize(), 2);
+        EXPECT_EQ(componentArray->getEntityAtIndex(0), 3);
+        EXPECT_EQ(componentArray->getEntityAtIndex(1), 1);
+        EXPECT_FALSE(componentArray->hasComponent(42));
+        for (Entity i = 0; i < 5; ++i)
+            EXPECT_EQ(componentArray->get(i).value, static_cast<int>(i * 10));
+
+        // A truncated block is rejected
+        SnapshotReader truncated(std::span(snapshot.data).first(snapshot.data.size() - 1));
+        EXPECT_THROW(componentArray->restore(truncated), InvalidSnapshot);
+    }
+
+    TEST_F(ComponentArrayTest, SnapshotOfNonTriviallyCopyableComponentsNeedsSerializer) {
+        struct NamedComponent {
+            std::string name;
+        };
+        ComponentArray<NamedComponent> names;
+        names.insert(4, NamedComponent{"four"});
+        names.insert(9, NamedComponent{"nine"});
+
+        WorldSnapshot snapshot;
+        SnapshotWriter writer(snapshot.data);
+        EXPECT_THROW(names.snapshot(writer), ComponentNotSerializable);
+
+        names.setSerializer({
+            [](SnapshotWriter &out, const NamedComponent &component) {
+                out.writeBlock(std::span<const char>(component.name));
+            },
+            [](SnapshotReader &in) {
+                std::vector<char> characters;
+                in.readBlock(characters);
+                return NamedComponent{std::string(characters.begin(), characters.end())};
+            }
+        });
+        snapshot.data.clear();
+        names.snapshot(writer);
+        names.remove(4);
+
+        SnapshotReader reader(snapshot.data);
+        names.restore(reader);
+        EXPECT_EQ(names.get(4).name, "four");
+        EXPECT_EQ(names.get(9).name, "nine");
+    }
 }
@@ -19,6 +19,7 @@
 #include "Components.hpp"
 #include "Definitions.hpp"
 #include "ECSExceptions.hpp"
+#include "JobSystem.hpp"
 #include <string>
 
 namespace parallax::ecs {
@@ -531,6 +532,107 @@ namespace parallax::ecs {
 	    EXPECT_EQ(group->size(), 0);
 	}
 
+	// =========================================================
+	// ================== OBSERVER TESTS ======================
+	// =========================================================
+
+	TEST_F(ComponentManagerTest, ObserversReceiveOneBatchPerFlush) {
+	    std::vector<std::vector<Entity>> added, removed, changed;
+	    componentManager.onAdd<TestComponentA>([&](std::span<const Entity> entities) { added.emplace_back(entities.begin(), entities.end()); });
+	    componentManager.onRemove<TestComponentA>([&](std::span<const Entity> entities) { removed.emplace_back(entities.begin(), entities.end()); });
+	    componentManager.onChange<TestComponentA>([&](std::span<const Entity> entities) { changed.emplace_back(entities.begin(), entities.end()); });
+
+	    Signature signature;
+	    signature.set(getComponentTypeID<TestComponentA>());
+	    for (Entity entity = 0; entity < 4; ++entity)
+	        componentManager.addComponent<TestComponentA>(entity, TestComponentA(static_cast<int>(entity)), Signature{}, signature);
+	    auto array = componentManager.getComponentArray<TestComponentA>();
+	    array->markChanged(1);
+
+	    // Nothing is delivered before the sync point
+	    EXPECT_TRUE(added.empty());
+	    componentManager.flushObservers();
+	    ASSERT_EQ(added.size(), 1);
+	    EXPECT_EQ(added[0], (std::vector<Entity>{0, 1, 2, 3}));
+	    // Entity 1 was added in the same batch, the change is folded into the addition
+	    EXPECT_TRUE(changed.empty());
+	    EXPECT_TRUE(removed.empty());
+
+	    array->markChanged(2);
+	    array->markChanged(2);
+	    array->markChanged(0);
+	    componentManager.removeComponent<TestComponentA>(3, signature, Signature{});
+	    componentManager.entityDestroyed(1, signature);
+	    componentManager.flushObservers();
+	    ASSERT_EQ(changed.size(), 1);
+	    EXPECT_EQ(changed[0], (std::vector<Entity>{0, 2}));
+	    ASSERT_EQ(removed.size(), 1);
+	    EXPECT_EQ(removed[0], (std::vector<Entity>{1, 3}));
+	    EXPECT_EQ(added.size(), 1);
+
+	    // An empty batch calls nobody
+	    componentManager.flushObservers();
+	    EXPECT_EQ(added.size(), 1);
+	    EXPECT_EQ(removed.size(), 1);
+	    EXPECT_EQ(changed.size(), 1);
+	}
+
+	TEST_F(ComponentManagerTest, RemovedObserverStopsRecordingEvents) {
+	    std::vector<Entity> added;
+	    const ObserverId id = componentManager.onAdd<TestComponentB>([&](std::span<const Entity> entities) {
+	        added.insert(added.end(), entities.begin(), entities.end());
+	    });
+
+	    Signature signature;
+	    signature.set(getComponentTypeID<TestComponentB>());
+	    componentManager.addComponent<TestComponentB>(5, TestComponentB(1.0f, 2.0f), Signature{}, signature);
+	    // An entity added then removed within the batch is not reported as added
+	    componentManager.addComponent<TestComponentB>(6, TestComponentB(1.0f, 2.0f), Signature{}, signature);
+	    componentManager.removeComponent<TestComponentB>(6, signature, Signature{});
+	    componentManager.removeObserver(id);
+	    componentManager.addComponent<TestComponentB>(7, TestComponentB(1.0f, 2.0f), Signature{}, signature);
+	    componentManager.flushObservers();
+	    EXPECT_TRUE(added.empty());
+
+	    componentManager.onAdd<TestComponentB>([&](std::span<const Entity> entities) {
+	        added.insert(added.end(), entities.begin(), entities.end());
+	    });
+	    componentManager.addComponent<TestComponentB>(6, TestComponentB(1.0f, 2.0f), Signature{}, signature);
+	    componentManager.addComponent<TestComponentB>(8, TestComponentB(1.0f, 2.0f), Signature{}, signature);
+	    componentManager.removeComponent<TestComponentB>(8, signature, Signature{});
+	    componentManager.flushObservers();
+	    EXPECT_EQ(added, (std::vector<Entity>{6}));
+
+	    EXPECT_THROW(componentManager.onAdd<TestComponentD>([](std::span<const Entity>) {}), ComponentNotRegistered);
+	}
+
+	TEST_F(ComponentManagerTest, ChangesMarkedFromWorkerThreadsAreAllDelivered) {
+	    std::vector<Entity> changed;
+	    componentManager.onChange<TestComponentA>([&](std::span<const Entity> entities) {
+	        changed.insert(changed.end(), entities.begin(), entities.end());
+	    });
+
+	    constexpr Entity entityCount = 2000;
+	    Signature signature;
+	    signature.set(getComponentTypeID<TestComponentA>());
+	    for (Entity entity = 0; entity < entityCount; ++entity)
+	        componentManager.addComponent<TestComponentA>(entity, TestComponentA(static_cast<int>(entity)), Signature{}, signature);
+	    componentManager.flushObservers();
+	    auto array = componentManager.getComponentArray<TestComponentA>();
+
+	    // Parallel iterations mark the entities they write from several threads at once
+	    JobSystem jobSystem(3);
+	    jobSystem.parallelFor(0, entityCount, 16, [&](const size_t begin, const size_t end) {
+	        for (size_t i = begin; i < end; ++i)
+	            array->markChanged(static_cast<Entity>(i));
+	    });
+	    componentManager.flushObservers();
+
+	    ASSERT_EQ(changed.size(), entityCount);
+	    for (Entity entity = 0; entity < entityCount; ++entity)
+	        EXPECT_EQ(changed[entity], entity);
+	}
+
 	// =========================================================
 	// ================ INTEGRATION TEST ======================
 	// =========================================================
@@ -19,6 +19,7 @@
 #include <gtest/gtest.h>
 #include <gmock/gmock.h>
 #include "ecs/Coordinator.hpp"
+#include "ecs/QuerySystem.hpp"
 #include "Components.hpp"
 #include "ecs/SingletonComponent.hpp"
 #include "ecs/Definitions.hpp"
@@ -132,7 +133,7 @@ namespace parallax::ecs {
         ComponentA compA{10};
         coordinator->addComponent(e1, compA);
 
-        std::vector<Entity> result = coordinator->getAllEntitiesWith<ComponentA, ComponentB>();
+        std::span<const Entity> result = coordinator->getAllEntitiesWith<ComponentA, ComponentB>();
         EXPECT_TRUE(result.empty());
     }
 
@@ -144,7 +145,7 @@ namespace parallax::ecs {
         coordinator->addComponent(e2, ComponentA{20});
         coordinator->addComponent(e2, ComponentB{3.14f});
 
-        std::vector<Entity> result = coordinator->getAllEntitiesWith<ComponentA, ComponentB>();
+        std::span<const Entity> result = coordinator->getAllEntitiesWith<ComponentA, ComponentB>();
         EXPECT_EQ(result.size(), 1);
         EXPECT_TRUE(std::find(result.begin(), result.end(), e2) != result.end());
     }
@@ -162,7 +163,7 @@ namespace parallax::ecs {
         coordinator->addComponent(e3, ComponentA{3});
         coordinator->addComponent(e3, ComponentB{3.0f});
 
-        std::vector<Entity> result = coordinator->getAllEntitiesWith<ComponentA, ComponentB>();
+        std::span<const Entity> result = coordinator->getAllEntitiesWith<ComponentA, ComponentB>();
         EXPECT_EQ(result.size(), 3);
         EXPECT_TRUE(std::find(result.begin(), result.end(), e1) != result.end());
         EXPECT_TRUE(std::find(result.begin(), result.end(), e2) != result.end());
@@ -174,7 +175,7 @@ namespace parallax::ecs {
         coordinator->addComponent(e1, ComponentA{10});
         coordinator->addComponent(e1, ComponentB{2.5f});
 
-        std::vector<Entity> result = coordinator->getAllEntitiesWith<ComponentA, ComponentB>();
+        std::span<const Entity> result = coordinator->getAllEntitiesWith<ComponentA, ComponentB>();
         EXPECT_TRUE(std::find(result.begin(), result.end(), e1) != result.end());
 
         coordinator->destroyEntity(e1);
@@ -455,4 +456,211 @@ namespace parallax::ecs {
         types = coordinator->getAllComponentTypes(entity);
         EXPECT_EQ(types.size(), 3);
     }
+
+    class BatchQuerySystem final : public QuerySystem<Read<ComponentA>> {};
+
+    TEST_F(CoordinatorTest, CreateEntitiesAddsBatchToGroupsAndSystems) {
+        auto group = coordinator->registerGroup<ComponentA>(get<ComponentB>());
+        auto system = coordinator->registerQuerySystem<BatchQuerySystem>();
+        const Entity existing = coordinator->createEntity();
+        coordinator->addComponent(existing, ComponentA{1});
+
+        const std::vector<Entity> entities = coordinator->createEntities(1000, ComponentA{7}, ComponentB{2.0f});
+
+        ASSERT_EQ(entities.size(), 1000);
+        EXPECT_EQ(group->size(), 1000);
+        EXPECT_EQ(system->entities.size(), 1001);
+        for (const Entity entity : entities) {
+            EXPECT_EQ(coordinator->getComponent<ComponentA>(entity).value, 7);
+            EXPECT_FLOAT_EQ(coordinator->getComponent<ComponentB>(entity).data, 2.0f);
+        }
+
+        // The existing entity only has ComponentA and must stay out of the group
+        EXPECT_EQ(std::ranges::count(group->entities(), existing), 0);
+    }
+
+    TEST_F(CoordinatorTest, SpawnBatchAssignsPerEntityValues) {
+        auto group = coordinator->registerGroup<ComponentA, ComponentB>(get<>());
+        const std::vector<ComponentA> as = {{1}, {2}, {3}};
+        const std::vector<ComponentB> bs = {{1.5f}, {2.5f}, {3.5f}};
+
+        const std::vector<Entity> entities = coordinator->spawnBatch<ComponentA, ComponentB>(as, bs);
+
+        ASSERT_EQ(entities.size(), 3);
+        EXPECT_EQ(group->size(), 3);
+        for (size_t i = 0; i < entities.size(); ++i) {
+            EXPECT_EQ(coordinator->getComponent<ComponentA>(entities[i]).value, as[i].value);
+            EXPECT_FLOAT_EQ(coordinator->getComponent<ComponentB>(entities[i]).data, bs[i].data);
+        }
+    }
+
+    TEST_F(CoordinatorTest, SpawnBatchRejectsMismatchedSizes) {
+        const std::vector<ComponentA> as = {{1}, {2}};
+        const std::vector<ComponentB> bs = {{1.0f}};
+
+        EXPECT_THROW((coordinator->spawnBatch<ComponentA, ComponentB>(as, bs)), BatchSizeMismatch);
+        EXPECT_EQ(coordinator->getComponentArray<ComponentA>()->size(), 0);
+    }
+
+    TEST_F(CoordinatorTest, SignatureEvaluationStatsOnlyCountReferencingConsumers) {
+        coordinator->registerComponent<TestComponent>();
+        auto group = coordinator->registerGroup<ComponentA>(get<ComponentB>());
+        auto system = coordinator->registerQuerySystem<BatchQuerySystem>();
+        const Entity entity = coordinator->createEntity();
+        coordinator->resetSignatureEvaluationStats();
+
+        // No system or group references TestComponent
+        coordinator->addComponent(entity, TestComponent{1});
+        EXPECT_EQ(coordinator->getSignatureEvaluationStats().total(), 0u);
+
+        coordinator->addComponent(entity, ComponentA{1});
+        SignatureEvaluationStats stats = coordinator->getSignatureEvaluationStats();
+        EXPECT_EQ(stats.querySystemEvaluations, 1u);
+        EXPECT_EQ(stats.groupEvaluations, 1u);
+
+        coordinator->resetSignatureEvaluationStats();
+        coordinator->addComponent(entity, ComponentB{1.0f});
+        stats = coordinator->getSignatureEvaluationStats();
+        EXPECT_EQ(stats.querySystemEvaluations, 0u);
+        EXPECT_EQ(stats.groupEvaluations, 1u);
+        EXPECT_EQ(group->size(), 1);
+        EXPECT_EQ(system->entities.size(), 1);
+    }
+
+    TEST_F(CoordinatorTest, CachedQueryTracksSignatureChanges) {
+        const Entity both = coordinator->createEntity();
+        coordinator->addComponent(both, ComponentA{1});
+        coordinator->addComponent(both, ComponentB{1.0f});
+        const Entity onlyA = coordinator->createEntity();
+        coordinator->addComponent(onlyA, ComponentA{2});
+
+        // Seeded from the existing entities on first use, then reused
+        auto query = coordinator->registerQuery<ComponentA, Exclude<ComponentB>>();
+        EXPECT_EQ(query, (coordinator->registerQuery<ComponentA, Exclude<ComponentB>>()));
+        ASSERT_EQ(query->size(), 1);
+        EXPECT_TRUE(query->contains(onlyA));
+
+        // Gaining an excluded component leaves the query, losing it joins again
+        coordinator->addComponent(onlyA, ComponentB{2.0f});
+        EXPECT_TRUE(query->entities().empty());
+        coordinator->removeComponent<ComponentB>(both);
+        EXPECT_TRUE(query->contains(both));
+
+        const std::vector<Entity> spawned = coordinator->createEntities(3, ComponentA{3});
+        EXPECT_EQ(query->size(), 4);
+        coordinator->destroyEntity(spawned[1]);
+        EXPECT_FALSE(query->contains(spawned[1]));
+
+        const std::span<const Entity> result = coordinator->getAllEntitiesWith<ComponentA, Exclude<ComponentB>>();
+        EXPECT_EQ(result.data(), query->entities().data());
+        EXPECT_EQ(result.size(), 3);
+    }
+
+    TEST_F(CoordinatorTest, SnapshotRestoresEntitiesComponentsAndSystems) {
+        auto group = coordinator->registerGroup<ComponentA>(get<ComponentB>());
+        auto system = coordinator->registerQuerySystem<BatchQuerySystem>();
+        const std::vector<Entity> entities = coordinator->createEntities(100, ComponentA{1}, ComponentB{2.0f});
+        for (size_t i = 0; i < entities.size(); ++i)
+            coordinator->getComponent<ComponentA>(entities[i]).value = static_cast<int>(i);
+        const Entity onlyA = coordinator->createEntity();
+        coordinator->addComponent(onlyA, ComponentA{-1});
+        coordinator->destroyEntity(entities[10]);
+        auto query = coordinator->registerQuery<ComponentA, Exclude<ComponentB>>();
+        coordinator->getHierarchy().setParent(entities[1], entities[0]);
+        coordinator->getHierarchy().setParent(entities[2], entities[1]);
+
+        const EntityHandle handle = coordinator->getEntityHandle(entities[5]);
+        const std::vector<Entity> groupEntities(group->entities().begin(), group->entities().end());
+        const WorldSnapshot snapshot = coordinator->snapshot();
+
+        coordinator->destroyEntity(entities[5]);
+        coordinator->removeComponent<ComponentB>(entities[6]);
+        coordinator->getComponent<ComponentA>(entities[7]).value = 1000;
+        coordinator->createEntities(50, ComponentA{3});
+        coordinator->destroyEntity(onlyA);
+        // Destroying a node attaches its children to its parent
+        coordinator->destroyEntity(entities[1]);
+        EXPECT_EQ(coordinator->getHierarchy().getParent(entities[2]), entities[0]);
+
+        coordinator->restore(snapshot);
+
+        EXPECT_TRUE(coordinator->isEntityValid(handle));
+        EXPECT_EQ(coordinator->getComponent<ComponentA>(entities[7]).value, 7);
+        EXPECT_TRUE(coordinator->entityHasComponent<ComponentB>(entities[6]));
+        EXPECT_FALSE(coordinator->isEntityValid(coordinator->getEntityHandle(entities[10])));
+        EXPECT_TRUE(std::ranges::equal(group->entities(), groupEntities));
+        EXPECT_EQ(system->entities.size(), 100);
+        ASSERT_EQ(query->size(), 1);
+        EXPECT_TRUE(query->contains(onlyA));
+        EXPECT_EQ(coordinator->getHierarchy().getParent(entities[2]), entities[1]);
+        EXPECT_EQ(coordinator->getHierarchy().subtree(entities[0]).size(), 3);
+
+        // The free list is restored too, the next ID is the one freed before the snapshot
+        EXPECT_EQ(coordinator->createEntity(), entities[10]);
+
+        // Structural changes keep working on the restored world
+        coordinator->removeComponent<ComponentB>(entities[20]);
+        EXPECT_EQ(group->size(), groupEntities.size() - 1);
+    }
+
+    TEST_F(CoordinatorTest, RejectedSnapshotLeavesWorldUntouched) {
+        const Entity entity = coordinator->createEntity();
+        coordinator->addComponent(entity, ComponentA{5});
+        WorldSnapshot snapshot = coordinator->snapshot();
+        // Cut inside the entity block
+        snapshot.data.resize(20);
+
+        coordinator->createEntity();
+        EXPECT_THROW(coordinator->restore(snapshot), InvalidSnapshot);
+        EXPECT_EQ(coordinator->getComponent<ComponentA>(entity).value, 5);
+
+        snapshot.data.assign(16, std::byte{0});
+        EXPECT_THROW(coordinator->restore(snapshot), InvalidSnapshot);
+    }
+
+    TEST_F(CoordinatorTest, SnapshotTruncatedInLaterArrayLeavesWorldUntouched) {
+        const std::vector<Entity> entities = coordinator->createEntities(10, ComponentA{1}, ComponentB{2.0f});
+        const WorldSnapshot snapshot = coordinator->snapshot();
+
+        for (const Entity entity : entities) {
+            coordinator->getComponent<ComponentA>(entity).value = 10;
+            coordinator->getComponent<ComponentB>(entity).data = 20.0f;
+        }
+        const Entity added = coordinator->createEntity();
+        coordinator->addComponent(added, ComponentA{30});
+
+        // The component blocks come last, ordered by type: dropping the final bytes cuts the
+        // last array while every block before it still parses
+        WorldSnapshot truncated = snapshot;
+        truncated.data.resize(truncated.data.size() - 1);
+        EXPECT_THROW(coordinator->restore(truncated), InvalidSnapshot);
+
+        for (const Entity entity : entities) {
+            EXPECT_EQ(coordinator->getComponent<ComponentA>(entity).value, 10);
+            EXPECT_FLOAT_EQ(coordinator->getComponent<ComponentB>(entity).data, 20.0f);
+        }
+        EXPECT_EQ(coordinator->getComponent<ComponentA>(added).value, 30);
+        EXPECT_EQ(coordinator->getComponentArray<ComponentA>()->size(), entities.size() + 1);
+        EXPECT_EQ(coordinator->getComponentArray<ComponentB>()->size(), entities.size());
+
+        coordinator->restore(snapshot);
+        EXPECT_EQ(coordinator->getComponent<ComponentA>(entities[0]).value, 1);
+        EXPECT_FALSE(coordinator->entityHasComponent<ComponentA>(added));
+    }
+
+    TEST_F(CoordinatorTest, RestoreMovesHierarchyVersionPastTheLiveOne) {
+        const Entity parent = coordinator->createEntity();
+        const Entity child = coordinator->createEntity();
+        coordinator->getHierarchy().setParent(child, parent);
+        const WorldSnapshot snapshot = coordinator->snapshot();
+
+        // Both restores parse the same content into a fresh hierarchy, the second one must
+        // still invalidate what was cached for the first
+        coordinator->restore(snapshot);
+        const std::uint64_t restoredVersion = coordinator->getHierarchy().version();
+        coordinator->restore(snapshot);
+
+        EXPECT_GT(coordinator->getHierarchy().version(), restoredVersion);
+        EXPECT_EQ(coordinator->getHierarchy().getParent(child), parent);
+    }
 }
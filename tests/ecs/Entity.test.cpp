@@ -290,4 +290,99 @@ namespace parallax::ecs {
 	    EXPECT_EQ(newE, e);
 	}
 
+
+	// Generational handles
+	TEST_F(EntityManagerTest, HandleOfLivingEntityIsValid) {
+	    Entity e = entityManager.createEntity();
+
+	    EntityHandle handle = entityManager.getHandle(e);
+	    EXPECT_EQ(handle.index, e);
+	    EXPECT_EQ(handle.generation, 0);
+	    EXPECT_TRUE(entityManager.isValid(handle));
+	}
+
+	TEST_F(EntityManagerTest, HandleBecomesStaleWhenEntityIsRecycled) {
+	    Entity e = entityManager.createEntity();
+	    EntityHandle oldHandle = entityManager.getHandle(e);
+
+	    entityManager.destroyEntity(e);
+	    EXPECT_FALSE(entityManager.isValid(oldHandle));
+	    EXPECT_EQ(entityManager.getHandle(e), INVALID_ENTITY_HANDLE);
+
+	    // Same ID is reused but with a new generation
+	    Entity reused = entityManager.createEntity();
+	    EXPECT_EQ(reused, e);
+	    EXPECT_EQ(entityManager.getGeneration(reused), 1);
+	    EXPECT_FALSE(entityManager.isValid(oldHandle));
+	    EXPECT_TRUE(entityManager.isValid(entityManager.getHandle(reused)));
+	}
+
+	TEST_F(EntityManagerTest, InvalidHandleIsNeverValid) {
+	    EXPECT_FALSE(entityManager.isValid(INVALID_ENTITY_HANDLE));
+	    entityManager.createEntity();
+	    EXPECT_FALSE(entityManager.isValid(INVALID_ENTITY_HANDLE));
+	    EXPECT_FALSE(entityManager.isValid(EntityHandle{MAX_ENTITIES - 1, 0}));
+	}
+
+	TEST_F(EntityManagerTest, IsAliveTracksLifecycle) {
+	    EXPECT_FALSE(entityManager.isAlive(0));
+	    Entity e = entityManager.createEntity();
+	    EXPECT_TRUE(entityManager.isAlive(e));
+	    entityManager.destroyEntity(e);
+	    EXPECT_FALSE(entityManager.isAlive(e));
+	}
+
+	// Lazy allocation
+	TEST_F(EntityManagerTest, IdsAreAllocatedOnDemand) {
+	    EXPECT_EQ(entityManager.getAllocatedEntityCount(), 0);
+
+	    auto entities = createMultipleEntities(10);
+	    EXPECT_EQ(entityManager.getAllocatedEntityCount(), 10);
+
+	    // Recycling does not allocate new IDs
+	    entityManager.destroyEntity(entities[3]);
+	    entityManager.createEntity();
+	    EXPECT_EQ(entityManager.getAllocatedEntityCount(), 10);
+
+	    // Untouched IDs still report an empty signature
+	    EXPECT_EQ(entityManager.getSignature(MAX_ENTITIES - 1).count(), 0);
+	}
+
+	// Swap-remove keeps the living list consistent
+	TEST_F(EntityManagerTest, DestroyKeepsLivingListConsistent) {
+	    auto entities = createMultipleEntities(100);
+
+	    for (size_t i = 0; i < entities.size(); i += 2)
+	        entityManager.destroyEntity(entities[i]);
+
+	    auto living = entityManager.getLivingEntities();
+	    ASSERT_EQ(living.size(), 50);
+	    std::set<Entity> livingSet(living.begin(), living.end());
+	    EXPECT_EQ(livingSet.size(), 50);
+	    for (size_t i = 0; i < entities.size(); ++i) {
+	        EXPECT_EQ(livingSet.contains(entities[i]), i % 2 == 1);
+	        EXPECT_EQ(entityManager.isAlive(entities[i]), i % 2 == 1);
+	    }
+
+	    // Destroy the remaining ones in creation order, each living entity must still be found
+	    for (size_t i = 1; i < entities.size(); i += 2)
+	        entityManager.destroyEntity(entities[i]);
+	    EXPECT_EQ(entityManager.getLivingEntityCount(), 0);
+	}
+
+	TEST_F(EntityManagerTest, CreateEntitiesReusesFreeIdsFirst) {
+		const Entity first = entityManager.createEntity();
+		const Entity second = entityManager.createEntity();
+		entityManager.destroyEntity(first);
+
+		const std::vector<Entity> entities = entityManager.createEntities(3);
+
+		ASSERT_EQ(entities.size(), 3);
+		EXPECT_EQ(entities[0], first);
+		EXPECT_EQ(entities[1], second + 1);
+		EXPECT_EQ(entities[2], second + 2);
+		EXPECT_EQ(entityManager.getLivingEntityCount(), 4);
+		for (const Entity entity : entities)
+			EXPECT_TRUE(entityManager.isAlive(entity));
+	}
 }
@@ -0,0 +1,198 @@
+//// EntityCommandBuffer.test.cpp /////////////////////////////////////////////
+//
+// ⢀⢀⢀⣤⣤⣤⡀⢀⢀⢀⢀⢀⢀⢠⣤⡄⢀⢀⢀⢀⣠⣤⣤⣤⣤⣤⣤⣤⣤⣤⡀⢀⢀⢀⢠⣤⣄⢀⢀⢀⢀⢀⢀⢀⣤⣤⢀⢀⢀⢀⢀⢀⢀⢀⣀⣄⢀⢀⢠⣄⣀⢀⢀⢀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⣿⣷⡀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡟⡛⡛⡛⡛⡛⡛⡛⢁⢀⢀⢀⢀⢻⣿⣦⢀⢀⢀⢀⢠⣾⡿⢃⢀⢀⢀⢀⢀⣠⣾⣿⢿⡟⢀⢀⡙⢿⢿⣿⣦⡀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⡛⣿⣷⡀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡙⣿⡷⢀⢀⣰⣿⡟⢁⢀⢀⢀⢀⢀⣾⣿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⣿⡆⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⡈⢿⣷⡄⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣇⣀⣀⣀⣀⣀⣀⣀⢀⢀⢀⢀⢀⢀⢀⡈⢀⢀⣼⣿⢏⢀⢀⢀⢀⢀⢀⣼⣿⡏⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡘⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⡈⢿⣿⡄⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣿⢿⢿⢿⢿⢿⢿⢿⢇⢀⢀⢀⢀⢀⢀⢀⢠⣾⣿⣧⡀⢀⢀⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⡈⢿⣿⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣰⣿⡟⡛⣿⣷⡄⢀⢀⢀⢀⢀⢿⣿⣇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⡈⢿⢀⢀⢸⣿⡇⢀⢀⢀⢀⡛⡟⢁⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⡟⢀⢀⡈⢿⣿⣄⢀⢀⢀⢀⡘⣿⣿⣄⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⢏⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⢀⣀⣀⣀⣀⣀⣀⣀⣀⣀⡀⢀⢀⢀⣠⣾⡿⢃⢀⢀⢀⢀⢀⢻⣿⣧⡀⢀⢀⢀⡈⢻⣿⣷⣦⣄⢀⢀⣠⣤⣶⣿⡿⢋⢀⢀⢀⢀
+// ⢀⢀⢀⢿⢿⢀⢀⢀⢀⢀⢀⢀⢀⢸⢿⢃⢀⢀⢀⢀⢻⢿⢿⢿⢿⢿⢿⢿⢿⢿⢃⢀⢀⢀⢿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⡗⢀⢀⢀⢀⢀⡈⡉⡛⡛⢀⢀⢹⡛⢋⢁⢀⢀⢀⢀⢀⢀
+//
+//  Author:      Parallax Engine Team
+//  Date:        16/10/2026
+//  Description: Test file for the deferred entity command buffer
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <gtest/gtest.h>
+#include <string>
+#include <utility>
+#include <vector>
+#include "ecs/Coordinator.hpp"
+#include "ecs/EntityCommandBuffer.hpp"
+#include "ecs/JobSystem.hpp"
+
+namespace parallax::ecs {
+
+    struct CmdPosition { float x = 0.0f; };
+    struct CmdVelocity { float x = 0.0f; };
+    // Records into the command buffer of the current thread when moved while s_recordOnMove is set
+    struct CmdName {
+        inline static Coordinator *s_recordOnMove = nullptr;
+
+        std::string name;
+
+        CmdName() = default;
+        CmdName(std::string value) : name(std::move(value)) {}
+        CmdName(const CmdName &) = default;
+        CmdName(CmdName &&other) noexcept : name(std::move(other.name))
+        {
+            if (Coordinator *coordinator = std::exchange(s_recordOnMove, nullptr)) {
+                EntityCommandBuffer &commands = coordinator->getCommandBuffer();
+                commands.addComponent(commands.createEntity(), CmdName{"spawned"});
+            }
+        }
+        CmdName &operator=(const CmdName &) = default;
+        CmdName &operator=(CmdName &&) = default;
+    };
+
+    class EntityCommandBufferTest : public ::testing::Test {
+    protected:
+        void SetUp() override
+        {
+            coordinator = std::make_unique<Coordinator>();
+            coordinator->init();
+            coordinator->registerComponent<CmdPosition>();
+            coordinator->registerComponent<CmdVelocity>();
+            coordinator->registerComponent<CmdName>();
+        }
+
+        std::unique_ptr<Coordinator> coordinator;
+        EntityCommandBuffer buffer;
+    };
+
+    TEST_F(EntityCommandBufferTest, CommandsAreDeferredUntilPlayback) {
+        const Entity entity = coordinator->createEntity();
+        buffer.addComponent(entity, CmdPosition{1.0f});
+
+        EXPECT_FALSE(coordinator->entityHasComponent<CmdPosition>(entity));
+        EXPECT_EQ(buffer.size(), 1);
+
+        buffer.playback(*coordinator);
+
+        ASSERT_TRUE(coordinator->entityHasComponent<CmdPosition>(entity));
+        EXPECT_FLOAT_EQ(coordinator->getComponent<CmdPosition>(entity).x, 1.0f);
+        EXPECT_TRUE(buffer.empty());
+    }
+
+    TEST_F(EntityCommandBufferTest, PendingEntitiesResolveAtPlayback) {
+        const PendingEntity first = buffer.createEntity();
+        const PendingEntity second = buffer.createEntity();
+        buffer.addComponent(first, CmdName{"first"});
+        buffer.addComponent(second, CmdName{std::string(64, 'x')});
+        buffer.addComponent(second, CmdVelocity{2.0f});
+
+        const std::vector<Entity> created = buffer.playback(*coordinator);
+
+        ASSERT_EQ(created.size(), 2);
+        EXPECT_EQ(coordinator->getComponent<CmdName>(created[first.index]).name, "first");
+        EXPECT_EQ(coordinator->getComponent<CmdName>(created[second.index]).name, std::string(64, 'x'));
+        EXPECT_FLOAT_EQ(coordinator->getComponent<CmdVelocity>(created[second.index]).x, 2.0f);
+    }
+
+    TEST_F(EntityCommandBufferTest, ChangesToOneEntityAreCoalesced) {
+        auto group = coordinator->registerGroup<CmdPosition, CmdVelocity>(get<>());
+        const Entity entity = coordinator->createEntity();
+        coordinator->addComponent(entity, CmdName{"entity"});
+
+        // Added then removed: the entity must never enter the group
+        buffer.addComponent(entity, CmdPosition{1.0f});
+        buffer.addComponent(entity, CmdVelocity{1.0f});
+        buffer.removeComponent<CmdVelocity>(entity);
+        buffer.removeComponent<CmdName>(entity);
+        buffer.playback(*coordinator);
+
+        const Signature signature = coordinator->getSignature(entity);
+        EXPECT_TRUE(signature.test(getComponentTypeID<CmdPosition>()));
+        EXPECT_FALSE(signature.test(getComponentTypeID<CmdVelocity>()));
+        EXPECT_FALSE(signature.test(getComponentTypeID<CmdName>()));
+        EXPECT_EQ(group->size(), 0);
+
+        buffer.addComponent(entity, CmdVelocity{3.0f});
+        buffer.playback(*coordinator);
+        ASSERT_EQ(group->size(), 1);
+        EXPECT_EQ(group->entities()[0], entity);
+    }
+
+    TEST_F(EntityCommandBufferTest, AddingAnExistingComponentReplacesIt) {
+        const Entity entity = coordinator->createEntity();
+        coordinator->addComponent(entity, CmdName{"old"});
+        const Tick before = coordinator->advanceTick();
+
+        buffer.addComponent(entity, CmdName{"new"});
+        buffer.playback(*coordinator);
+
+        EXPECT_EQ(coordinator->getComponentArray<CmdName>()->get(entity).name, "new");
+        EXPECT_TRUE(coordinator->getComponentArray<CmdName>()->isChangedSince(entity, before - 1));
+    }
+
+    TEST_F(EntityCommandBufferTest, DestroyDropsLaterCommands) {
+        const Entity entity = coordinator->createEntity();
+        coordinator->addComponent(entity, CmdPosition{});
+        const EntityHandle handle = coordinator->getEntityHandle(entity);
+
+        buffer.destroyEntity(entity);
+        buffer.addComponent(entity, CmdVelocity{});
+        buffer.playback(*coordinator);
+
+        EXPECT_FALSE(coordinator->isEntityValid(handle));
+        EXPECT_EQ(coordinator->getComponentArray<CmdPosition>()->size(), 0);
+        EXPECT_EQ(coordinator->getComponentArray<CmdVelocity>()->size(), 0);
+    }
+
+    TEST_F(EntityCommandBufferTest, ClearDropsCommandsWithoutApplyingThem) {
+        const Entity entity = coordinator->createEntity();
+        buffer.addComponent(entity, CmdName{std::string(128, 'y')});
+        buffer.clear();
+        buffer.playback(*coordinator);
+
+        EXPECT_FALSE(coordinator->entityHasComponent<CmdName>(entity));
+    }
+
+    TEST_F(EntityCommandBufferTest, WorkerThreadsRecordIntoTheirOwnBuffers) {
+        constexpr size_t entityCount = 2000;
+        std::vector<Entity> entities;
+        for (size_t i = 0; i < entityCount; ++i)
+            entities.push_back(coordinator->createEntity());
+
+        JobSystem jobSystem(3);
+        jobSystem.parallelFor(0, entityCount, 64, [&](const size_t begin, const size_t end) {
+            EntityCommandBuffer &commands = coordinator->getCommandBuffer();
+            for (size_t i = begin; i < end; ++i)
+                commands.addComponent(entities[i], CmdPosition{static_cast<float>(i)});
+        });
+
+        EXPECT_EQ(coordinator->getComponentArray<CmdPosition>()->size(), 0);
+        coordinator->flushCommandBuffers();
+
+        ASSERT_EQ(coordinator->getComponentArray<CmdPosition>()->size(), entityCount);
+        for (size_t i = 0; i < entityCount; ++i)
+            EXPECT_FLOAT_EQ(coordinator->getComponent<CmdPosition>(entities[i]).x, static_cast<float>(i));
+        EXPECT_TRUE(coordinator->getCommandBuffer().empty());
+    }
+
+    TEST_F(EntityCommandBufferTest, CommandsRecordedDuringFlushApplyOnTheNextFlush) {
+        const Entity entity = coordinator->createEntity();
+        coordinator->getCommandBuffer().addComponent(entity, CmdName{"entity"});
+
+        // Moving the component into its array during playback records a new entity
+        CmdName::s_recordOnMove = coordinator.get();
+        coordinator->flushCommandBuffers();
+
+        EXPECT_EQ(CmdName::s_recordOnMove, nullptr);
+        ASSERT_EQ(coordinator->getAllEntitiesWith<CmdName>().size(), 1);
+        EXPECT_EQ(coordinator->getComponent<CmdName>(entity).name, "entity");
+        EXPECT_FALSE(coordinator->getCommandBuffer().empty());
+
+        coordinator->flushCommandBuffers();
+
+        const auto named = coordinator->getAllEntitiesWith<CmdName>();
+        ASSERT_EQ(named.size(), 2);
+        const Entity spawned = named[0] == entity ? named[1] : named[0];
+        EXPECT_EQ(coordinator->getComponent<CmdName>(spawned).name, "spawned");
+        EXPECT_TRUE(coordinator->getCommandBuffer().empty());
+    }
+
+}
@@ -24,6 +24,8 @@
 #include <string>
 #include <vector>
 #include <algorithm>
+#include <cmath>
+#include <random>
 
 namespace parallax::ecs {
 
@@ -296,6 +298,68 @@ namespace parallax::ecs {
 	    EXPECT_EQ(callCount, 2);
 	}
 
+	TEST_F(GroupTest, EachParallelVisitsEveryEntity) {
+	    auto group = createGroup<PositionComponent, VelocityComponent>(std::make_tuple(tagArray));
+	    for (Entity i = 0; i < 5; ++i)
+	        group->addToGroup(entities[i]);
+
+	    // Grain size of 1 forces one job per entity
+	    group->eachParallel([](Entity, PositionComponent& position, const VelocityComponent& velocity, TagComponent&) {
+	        position.x += velocity.vx;
+	    }, 1);
+
+	    for (Entity i = 0; i < 5; ++i)
+	        EXPECT_FLOAT_EQ(positionArray->get(i).x, i * 1.0f + i * 0.5f);
+	}
+
+	TEST_F(GroupTest, EachChangedSinceSkipsUnchangedEntities) {
+	    auto group = createGroup<PositionComponent, VelocityComponent>(std::make_tuple(tagArray));
+	    for (Entity i = 0; i < 5; ++i)
+	        group->addToGroup(entities[i]);
+
+	    positionArray->setCurrentTick(2);
+	    tagArray->setCurrentTick(2);
+	    positionArray->markChanged(entities[1]);
+	    tagArray->markChanged(entities[3]);
+
+	    // Any iterated component
+	    std::vector<Entity> visited;
+	    group->each(ChangedSince<>{FIRST_TICK}, [&visited](Entity e, PositionComponent&, VelocityComponent&, TagComponent&) {
+	        visited.push_back(e);
+	    });
+	    std::ranges::sort(visited);
+	    EXPECT_EQ(visited, (std::vector<Entity>{1, 3}));
+
+	    // Only the watched component
+	    visited.clear();
+	    group->each(ChangedSince<PositionComponent>{FIRST_TICK}, [&visited](Entity e, PositionComponent&, VelocityComponent&, TagComponent&) {
+	        visited.push_back(e);
+	    });
+	    EXPECT_EQ(visited, (std::vector<Entity>{1}));
+
+	    // Nothing changed after tick 2
+	    int callCount = 0;
+	    group->each(ChangedSince<>{2}, [&callCount](Entity, PositionComponent&, VelocityComponent&, TagComponent&) {
+	        callCount++;
+	    });
+	    EXPECT_EQ(callCount, 0);
+	}
+
+	TEST_F(GroupTest, SortByKeepsChangeTicks) {
+	    auto group = createGroup<PositionComponent, HealthComponent>(std::make_tuple(tagArray));
+	    for (Entity i = 0; i < 5; ++i)
+	        group->addToGroup(entities[i]);
+
+	    healthArray->setCurrentTick(4);
+	    healthArray->markChanged(entities[0]);
+
+	    group->sortBy<HealthComponent, int>([](const HealthComponent& h) { return h.health; });
+
+	    EXPECT_EQ(healthArray->getChangeTick(entities[0]), 4);
+	    EXPECT_EQ(healthArray->getChangeTick(entities[4]), FIRST_TICK);
+	    EXPECT_EQ(healthArray->getChangeTickAt(4), 4); // Highest health sorted last
+	}
+
 	TEST_F(GroupTest, SortByOwnedComponent) {
 	    auto group = createGroup<PositionComponent, HealthComponent>(std::make_tuple(tagArray));
 
@@ -361,6 +425,65 @@ namespace parallax::ecs {
 	    EXPECT_EQ(groupEntities[4], 0); // Entity 0 has highest health (100)
 	}
 
+	TEST_F(GroupTest, SortByMatchesStableSortOnLargeGroups) {
+	    auto group = createGroup<PositionComponent, VelocityComponent>(std::make_tuple(tagArray));
+
+	    std::mt19937 gen(7);
+	    std::uniform_real_distribution<float> dist(-1000.0f, 1000.0f);
+	    for (Entity i = 5; i < 3000; ++i) {
+	        // Few distinct values so that stability is exercised
+	        const float x = std::round(dist(gen) / 100.0f) * 100.0f;
+	        positionArray->insert(i, PositionComponent(x, static_cast<float>(i)));
+	        velocityArray->insert(i, VelocityComponent(static_cast<float>(i)));
+	        tagArray->insert(i, TagComponent());
+	    }
+	    for (Entity i = 0; i < 3000; ++i)
+	        group->addToGroup(i);
+
+	    for (const bool ascending : {true, false}) {
+	        std::vector<Entity> expected(group->entities().begin(), group->entities().end());
+	        std::ranges::stable_sort(expected, [&](const Entity a, const Entity b) {
+	            const float xa = positionArray->get(a).x;
+	            const float xb = positionArray->get(b).x;
+	            return ascending ? xa < xb : xb < xa;
+	        });
+
+	        group->invalidateSorting();
+	        group->sortBy<PositionComponent, float>([](const PositionComponent& p) { return p.x; }, ascending);
+
+	        const auto groupEntities = group->entities();
+	        ASSERT_TRUE(std::ranges::equal(groupEntities, expected));
+	        // Every owned array followed the same permutation
+	        const auto velocities = group->get<VelocityComponent>();
+	        for (size_t i = 0; i < groupEntities.size(); ++i) {
+	            const Entity e = groupEntities[i];
+	            EXPECT_EQ(velocities[i].vx, e < 5 ? e * 0.5f : static_cast<float>(e));
+	        }
+	    }
+	}
+
+	TEST_F(GroupTest, SortByNearlySortedAndNonArithmeticKeys) {
+	    auto group = createGroup<PositionComponent, TagComponent>(std::make_tuple(healthArray));
+	    for (Entity i = 0; i < 5; ++i)
+	        group->addToGroup(entities[i]);
+
+	    group->sortBy<HealthComponent, int>([](const HealthComponent& h) { return h.health; });
+	    EXPECT_TRUE(std::ranges::equal(group->entities(), std::vector<Entity>{4, 3, 2, 1, 0}));
+
+	    // Swapping two neighbours only needs the insertion sort path
+	    healthArray->get(2).health = 65;
+	    group->invalidateSorting();
+	    group->sortBy<HealthComponent, int>([](const HealthComponent& h) { return h.health; });
+	    EXPECT_TRUE(std::ranges::equal(group->entities(), std::vector<Entity>{4, 2, 3, 1, 0}));
+
+	    // Strings have no radix key and fall back to the comparison sort
+	    group->sortBy<TagComponent, std::string>([](const TagComponent& t) { return t.tag; }, false);
+	    EXPECT_TRUE(std::ranges::equal(group->entities(), std::vector<Entity>{4, 3, 2, 1, 0}));
+	    const auto tags = group->get<TagComponent>();
+	    for (size_t i = 0; i < tags.size(); ++i)
+	        EXPECT_EQ(tags[i].tag, "Entity_" + std::to_string(4 - i));
+	}
+
 	TEST_F(GroupTest, InvalidateSorting) {
 	    auto group = createGroup<PositionComponent>(std::make_tuple(healthArray));
 
@@ -534,6 +657,64 @@ namespace parallax::ecs {
 	    EXPECT_EQ(oddCount, 2); // Entities 1, 3
 	}
 
+	TEST_F(GroupTest, PartitionHandleTracksMembershipChanges) {
+	    auto group = createGroup<PositionComponent, TagComponent>(std::make_tuple(healthArray));
+	    for (Entity i = 0; i < 5; ++i)
+	        group->addToGroup(entities[i]);
+
+	    const auto handle = group->getPartitionHandle<TagComponent, int>(
+	        [](const TagComponent& tag) { return tag.category; }
+	    );
+	    ASSERT_TRUE(handle.isValid());
+	    // The same partitioning is shared by every caller
+	    const auto sameHandle = group->getPartitionHandle<TagComponent, int>([](const TagComponent&) { return 0; });
+	    EXPECT_EQ(sameHandle.index, handle.index);
+	    EXPECT_EQ(group->getPartitionView(handle).partitionCount(), 3);
+
+	    // Every partition must be a contiguous range of entities sharing the key,
+	    // with the owned components still aligned with their entity
+	    auto checkPartitions = [&](const size_t expectedSize) {
+	        const auto view = group->getPartitionView(handle);
+	        size_t covered = 0;
+	        for (const int key : view.getPartitionKeys()) {
+	            const auto* partition = view.getPartition(key);
+	            ASSERT_NE(partition, nullptr);
+	            EXPECT_EQ(partition->startIndex, covered);
+	            covered += partition->count;
+	            view.each(key, [key](const Entity e, PositionComponent& pos, TagComponent& tag, HealthComponent&) {
+	                EXPECT_EQ(tag.category, key);
+	                EXPECT_EQ(tag.tag, "Entity_" + std::to_string(e));
+	                EXPECT_FLOAT_EQ(pos.x, static_cast<float>(e));
+	            });
+	        }
+	        EXPECT_EQ(covered, expectedSize);
+	        EXPECT_EQ(group->size(), expectedSize);
+	    };
+
+	    for (Entity i = 5; i < 12; ++i) {
+	        positionArray->insert(i, PositionComponent(static_cast<float>(i)));
+	        tagArray->insert(i, TagComponent("Entity_" + std::to_string(i), i % 4));
+	        healthArray->insert(i, HealthComponent());
+	        group->addToGroup(i);
+	    }
+	    checkPartitions(12);
+	    EXPECT_EQ(group->getPartitionView(handle).partitionCount(), 4);
+
+	    // Entities 7 and 11 are the only ones in category 3, removing both drops the partition
+	    group->removeFromGroup(3);
+	    group->removeFromGroup(7);
+	    group->removeFromGroup(0);
+	    checkPartitions(9);
+	    group->removeFromGroup(11);
+	    checkPartitions(8);
+	    EXPECT_EQ(group->getPartitionView(handle).getPartition(3), nullptr);
+	    EXPECT_EQ(group->getPartitionView(handle).partitionCount(), 3);
+
+	    const std::vector<Entity> batch = {0, 3};
+	    group->addToGroup(batch);
+	    checkPartitions(10);
+	}
+
 	TEST_F(GroupTest, EmptyGroup) {
 	    auto group = createGroup<PositionComponent>(std::make_tuple(velocityArray));
 
@@ -21,9 +21,11 @@
 #include "Coordinator.hpp"
 #include "Access.hpp"
 #include "SingletonComponent.hpp"
+#include <algorithm>
 #include <memory>
 #include <string>
 #include <type_traits>
+#include <vector>
 
 namespace parallax::ecs {
 
@@ -360,6 +362,82 @@ namespace parallax::ecs {
         system->updatePositions();
     }
 
+    // System updating positions through the parallel iteration
+    class ParallelPositionSystem : public GroupSystem<Owned<Write<Position>>, NonOwned<Read<Velocity>>> {
+    public:
+        void updatePositions(const size_t grainSize) {
+            eachParallel([](Entity, Position& position, const Velocity& velocity) {
+                position.x += velocity.vx;
+                position.y += velocity.vy;
+                position.z += velocity.vz;
+            }, grainSize);
+        }
+    };
+
+    TEST_F(GroupSystemTest, EachParallelRespectsAccessAndMarksWrites) {
+        // Enough entities for the range to be split into many chunks across the workers
+        for (int i = 5; i < 1000; ++i) {
+            Entity entity = coordinator->createEntity();
+            entities.push_back(entity);
+            coordinator->addComponent(entity, Position(i * 1.0f, i * 2.0f, i * 3.0f));
+            coordinator->addComponent(entity, Velocity(i * 0.5f, i * 1.0f, i * 1.5f));
+        }
+
+        auto system = coordinator->registerGroupSystem<ParallelPositionSystem>();
+        ASSERT_EQ(system->getEntities().size(), entities.size());
+
+        auto positionArray = coordinator->getComponentArray<Position>();
+        auto velocityArray = coordinator->getComponentArray<Velocity>();
+        const Tick before = coordinator->advanceTick();
+        for (const Entity entity : entities) {
+            ASSERT_FALSE(positionArray->isChangedSince(entity, before));
+            ASSERT_FALSE(velocityArray->isChangedSince(entity, before));
+        }
+        const Tick current = coordinator->advanceTick();
+
+        system->updatePositions(16);
+
+        for (size_t i = 0; i < entities.size(); ++i) {
+            const Position& pos = positionArray->get(entities[i]);
+            EXPECT_FLOAT_EQ(pos.x, i * 1.0f + i * 0.5f);
+            EXPECT_FLOAT_EQ(pos.y, i * 2.0f + i * 1.0f);
+            EXPECT_FLOAT_EQ(pos.z, i * 3.0f + i * 1.5f);
+            // The written component is stamped with the current tick, the read one keeps its old tick
+            EXPECT_EQ(positionArray->getChangeTick(entities[i]), current);
+            EXPECT_TRUE(positionArray->isChangedSince(entities[i], before));
+            EXPECT_FALSE(velocityArray->isChangedSince(entities[i], before));
+        }
+    }
+
+    TEST_F(GroupSystemTest, EachParallelWritesReachChangeObservers) {
+        for (int i = 5; i < 1000; ++i) {
+            Entity entity = coordinator->createEntity();
+            entities.push_back(entity);
+            coordinator->addComponent(entity, Position(i * 1.0f, i * 2.0f, i * 3.0f));
+            coordinator->addComponent(entity, Velocity(i * 0.5f, i * 1.0f, i * 1.5f));
+        }
+        auto system = coordinator->registerGroupSystem<ParallelPositionSystem>();
+
+        std::vector<Entity> changedPositions;
+        size_t changedVelocities = 0;
+        coordinator->onChange<Position>([&](std::span<const Entity> changed) {
+            changedPositions.insert(changedPositions.end(), changed.begin(), changed.end());
+        });
+        coordinator->onChange<Velocity>([&](std::span<const Entity> changed) { changedVelocities += changed.size(); });
+        coordinator->flushObservers();
+        changedPositions.clear();
+
+        // Every worker records the entities it writes into the same array
+        system->updatePositions(16);
+        coordinator->flushObservers();
+
+        std::vector<Entity> expected = entities;
+        std::ranges::sort(expected);
+        std::ranges::sort(changedPositions);
+        EXPECT_EQ(changedPositions, expected);
+        EXPECT_EQ(changedVelocities, 0);
+    }
+
     // Test with system that accesses non-registered component
     struct Unregistered {
         int value = 0;
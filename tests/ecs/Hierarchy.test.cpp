@@ -0,0 +1,157 @@
+//// Hierarchy.test.cpp ///////////////////////////////////////////////////////
+//
+// ⢀⢀⢀⣤⣤⣤⡀⢀⢀⢀⢀⢀⢀⢠⣤⡄⢀⢀⢀⢀⣠⣤⣤⣤⣤⣤⣤⣤⣤⣤⡀⢀⢀⢀⢠⣤⣄⢀⢀⢀⢀⢀⢀⢀⣤⣤⢀⢀⢀⢀⢀⢀⢀⢀⣀⣄⢀⢀⢠⣄⣀⢀⢀⢀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⣿⣷⡀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡟⡛⡛⡛⡛⡛⡛⡛⢁⢀⢀⢀⢀⢻⣿⣦⢀⢀⢀⢀⢠⣾⡿⢃⢀⢀⢀⢀⢀⣠⣾⣿⢿⡟⢀⢀⡙⢿⢿⣿⣦⡀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⡛⣿⣷⡀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡙⣿⡷⢀⢀⣰⣿⡟⢁⢀⢀⢀⢀⢀⣾⣿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⣿⡆⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⡈⢿⣷⡄⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣇⣀⣀⣀⣀⣀⣀⣀⢀⢀⢀⢀⢀⢀⢀⡈⢀⢀⣼⣿⢏⢀⢀⢀⢀⢀⢀⣼⣿⡏⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡘⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⡈⢿⣿⡄⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣿⢿⢿⢿⢿⢿⢿⢿⢇⢀⢀⢀⢀⢀⢀⢀⢠⣾⣿⣧⡀⢀⢀⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⡈⢿⣿⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣰⣿⡟⡛⣿⣷⡄⢀⢀⢀⢀⢀⢿⣿⣇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⡈⢿⢀⢀⢸⣿⡇⢀⢀⢀⢀⡛⡟⢁⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⡟⢀⢀⡈⢿⣿⣄⢀⢀⢀⢀⡘⣿⣿⣄⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⢏⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⢀⣀⣀⣀⣀⣀⣀⣀⣀⣀⡀⢀⢀⢀⣠⣾⡿⢃⢀⢀⢀⢀⢀⢻⣿⣧⡀⢀⢀⢀⡈⢻⣿⣷⣦⣄⢀⢀⣠⣤⣶⣿⡿⢋⢀⢀⢀⢀
+// ⢀⢀⢀⢿⢿⢀⢀⢀⢀⢀⢀⢀⢀⢸⢿⢃⢀⢀⢀⢀⢻⢿⢿⢿⢿⢿⢿⢿⢿⢿⢃⢀⢀⢀⢿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⡗⢀⢀⢀⢀⢀⡈⡉⡛⡛⢀⢀⢹⡛⢋⢁⢀⢀⢀⢀⢀⢀
+//
+//  Author:      Parallax Engine Team
+//  Date:        16/10/2026
+//  Description: Test file for the flat hierarchy store
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <gtest/gtest.h>
+#include <random>
+#include <unordered_map>
+#include "ecs/Hierarchy.hpp"
+#include "ecs/ECSExceptions.hpp"
+
+namespace parallax::ecs {
+    class HierarchyTest : public ::testing::Test {
+    protected:
+        Hierarchy hierarchy;
+
+        // Checks the depth-first invariants and compares the parents with a reference map
+        void expectConsistent(const std::unordered_map<Entity, Entity> &expectedParents) const
+        {
+            const auto entities = hierarchy.entities();
+            const auto parents = hierarchy.parents();
+            const auto sizes = hierarchy.subtreeSizes();
+            ASSERT_EQ(entities.size(), expectedParents.size());
+
+            std::vector<std::uint32_t> recomputedSizes(entities.size(), 1);
+            for (std::size_t i = entities.size(); i-- > 0;) {
+                if (parents[i] == Hierarchy::NO_PARENT)
+                    continue;
+                ASSERT_LT(parents[i], i);
+                ASSERT_LE(i + sizes[i], parents[i] + sizes[parents[i]]);
+                recomputedSizes[parents[i]] += recomputedSizes[i];
+            }
+            for (std::size_t i = 0; i < entities.size(); ++i) {
+                EXPECT_EQ(sizes[i], recomputedSizes[i]);
+                EXPECT_EQ(hierarchy.indexOf(entities[i]), i);
+                EXPECT_EQ(hierarchy.getParent(entities[i]), expectedParents.at(entities[i]));
+            }
+        }
+    };
+
+    TEST_F(HierarchyTest, StoresTreesInDepthFirstOrder) {
+        // 0 -> {1 -> {3}, 2}, built the way a model importer walks its nodes
+        hierarchy.setParent(1, 0);
+        hierarchy.setParent(3, 1);
+        hierarchy.setParent(2, 0);
+        hierarchy.setParent(10, INVALID_ENTITY);
+
+        EXPECT_EQ(std::vector<Entity>(hierarchy.entities().begin(), hierarchy.entities().end()),
+                  (std::vector<Entity>{0, 1, 3, 2, 10}));
+        EXPECT_EQ(hierarchy.subtree(0).size(), 4);
+        EXPECT_EQ(std::vector<Entity>(hierarchy.descendants(1).begin(), hierarchy.descendants(1).end()),
+                  (std::vector<Entity>{3}));
+        EXPECT_TRUE(hierarchy.subtree(42).empty());
+
+        std::vector<Entity> children;
+        hierarchy.forEachChild(0, [&](const Entity child) { children.push_back(child); });
+        EXPECT_EQ(children, (std::vector<Entity>{1, 2}));
+        expectConsistent({{0, INVALID_ENTITY}, {1, 0}, {2, 0}, {3, 1}, {10, INVALID_ENTITY}});
+    }
+
+    TEST_F(HierarchyTest, ReparentingSplicesWholeSubtrees) {
+        std::mt19937 gen(7);
+        std::unordered_map<Entity, Entity> expectedParents;
+        constexpr Entity nodeCount = 64;
+        for (Entity entity = 0; entity < nodeCount; ++entity) {
+            const Entity parent = entity == 0 ? INVALID_ENTITY : static_cast<Entity>(gen() % entity);
+            hierarchy.setParent(entity, parent);
+            expectedParents[entity] = parent;
+        }
+        expectConsistent(expectedParents);
+
+        for (int step = 0; step < 500; ++step) {
+            const Entity entity = gen() % nodeCount;
+            const Entity parent = gen() % 5 == 0 ? INVALID_ENTITY : static_cast<Entity>(gen() % nodeCount);
+
+            bool cycle = parent == entity;
+            for (Entity ancestor = parent; !cycle && ancestor != INVALID_ENTITY; ancestor = expectedParents[ancestor])
+                cycle = ancestor == entity;
+            if (cycle) {
+                EXPECT_THROW(hierarchy.setParent(entity, parent), HierarchyCycle);
+                continue;
+            }
+            hierarchy.setParent(entity, parent);
+            expectedParents[entity] = parent;
+            expectConsistent(expectedParents);
+        }
+    }
+
+    TEST_F(HierarchyTest, RemovingNodesKeepsTheOrderDepthFirst) {
+        hierarchy.setParent(1, 0);
+        hierarchy.setParent(2, 1);
+        hierarchy.setParent(3, 1);
+        hierarchy.setParent(4, 0);
+        hierarchy.setParent(5, 4);
+
+        // Children of a removed node are attached to its parent
+        hierarchy.remove(1);
+        EXPECT_FALSE(hierarchy.contains(1));
+        expectConsistent({{0, INVALID_ENTITY}, {2, 0}, {3, 0}, {4, 0}, {5, 4}});
+
+        hierarchy.removeSubtree(4);
+        EXPECT_FALSE(hierarchy.contains(5));
+        expectConsistent({{0, INVALID_ENTITY}, {2, 0}, {3, 0}});
+
+        hierarchy.remove(0);
+        expectConsistent({{2, INVALID_ENTITY}, {3, INVALID_ENTITY}});
+        hierarchy.remove(42);
+        hierarchy.clear();
+        EXPECT_EQ(hierarchy.size(), 0);
+        EXPECT_FALSE(hierarchy.contains(2));
+    }
+
+    TEST_F(HierarchyTest, InsertingNodesChangesTheVersion) {
+        // Unparenting an entity that has no node yet only inserts it as a root
+        const std::uint64_t version = hierarchy.version();
+        hierarchy.setParent(1, INVALID_ENTITY);
+        EXPECT_TRUE(hierarchy.contains(1));
+        EXPECT_NE(hierarchy.version(), version);
+
+        // Unparenting a root that is already stored changes nothing
+        const std::uint64_t insertedVersion = hierarchy.version();
+        hierarchy.setParent(1, INVALID_ENTITY);
+        EXPECT_EQ(hierarchy.version(), insertedVersion);
+    }
+
+    TEST_F(HierarchyTest, HandlesDeepChains) {
+        // A 10k bone chain must not need any recursion
+        constexpr Entity depth = 10000;
+        std::unordered_map<Entity, Entity> expectedParents{{0, INVALID_ENTITY}};
+        for (Entity bone = 1; bone < depth; ++bone) {
+            hierarchy.setParent(bone, bone - 1);
+            expectedParents[bone] = bone - 1;
+        }
+        EXPECT_EQ(hierarchy.subtreeSizes()[0], depth);
+        EXPECT_EQ(hierarchy.subtree(depth / 2).size(), depth / 2);
+
+        // Moving the lower half of the rig under the root
+        hierarchy.setParent(depth / 2, 0);
+        expectedParents[depth / 2] = 0;
+        expectConsistent(expectedParents);
+        EXPECT_EQ(hierarchy.subtreeSizes()[0], depth);
+        EXPECT_EQ(hierarchy.subtree(1).size(), depth / 2 - 1);
+    }
+}
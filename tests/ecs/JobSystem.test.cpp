@@ -0,0 +1,104 @@
+//// JobSystem.test.cpp ///////////////////////////////////////////////////////
+//
+// ⢀⢀⢀⣤⣤⣤⡀⢀⢀⢀⢀⢀⢀⢠⣤⡄⢀⢀⢀⢀⣠⣤⣤⣤⣤⣤⣤⣤⣤⣤⡀⢀⢀⢀⢠⣤⣄⢀⢀⢀⢀⢀⢀⢀⣤⣤⢀⢀⢀⢀⢀⢀⢀⢀⣀⣄⢀⢀⢠⣄⣀⢀⢀⢀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⣿⣷⡀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡟⡛⡛⡛⡛⡛⡛⡛⢁⢀⢀⢀⢀⢻⣿⣦⢀⢀⢀⢀⢠⣾⡿⢃⢀⢀⢀⢀⢀⣠⣾⣿⢿⡟⢀⢀⡙⢿⢿⣿⣦⡀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⡛⣿⣷⡀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡙⣿⡷⢀⢀⣰⣿⡟⢁⢀⢀⢀⢀⢀⣾⣿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⣿⡆⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⡈⢿⣷⡄⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣇⣀⣀⣀⣀⣀⣀⣀⢀⢀⢀⢀⢀⢀⢀⡈⢀⢀⣼⣿⢏⢀⢀⢀⢀⢀⢀⣼⣿⡏⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡘⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⡈⢿⣿⡄⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣿⢿⢿⢿⢿⢿⢿⢿⢇⢀⢀⢀⢀⢀⢀⢀⢠⣾⣿⣧⡀⢀⢀⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⡈⢿⣿⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣰⣿⡟⡛⣿⣷⡄⢀⢀⢀⢀⢀⢿⣿⣇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⡈⢿⢀⢀⢸⣿⡇⢀⢀⢀⢀⡛⡟⢁⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⡟⢀⢀⡈⢿⣿⣄⢀⢀⢀⢀⡘⣿⣿⣄⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⢏⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⢀⣀⣀⣀⣀⣀⣀⣀⣀⣀⡀⢀⢀⢀⣠⣾⡿⢃⢀⢀⢀⢀⢀⢻⣿⣧⡀⢀⢀⢀⡈⢻⣿⣷⣦⣄⢀⢀⣠⣤⣶⣿⡿⢋⢀⢀⢀⢀
+// ⢀⢀⢀⢿⢿⢀⢀⢀⢀⢀⢀⢀⢀⢸⢿⢃⢀⢀⢀⢀⢻⢿⢿⢿⢿⢿⢿⢿⢿⢿⢃⢀⢀⢀⢿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⡗⢀⢀⢀⢀⢀⡈⡉⡛⡛⢀⢀⢹⡛⢋⢁⢀⢀⢀⢀⢀⢀
+//
+//  Author:      Parallax Engine Team
+//  Date:        16/10/2026
+//  Description: Test file for the work-stealing job system
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <gtest/gtest.h>
+#include <atomic>
+#include <numeric>
+#include <stdexcept>
+#include <vector>
+#include "JobSystem.hpp"
+
+namespace parallax::ecs {
+
+    class JobSystemTest : public ::testing::Test {
+    protected:
+        JobSystem jobSystem{4};
+    };
+
+    TEST_F(JobSystemTest, SubmittedJobsAllRun) {
+        JobCounter counter;
+        std::atomic<int> executed = 0;
+
+        for (int i = 0; i < 100; ++i)
+            jobSystem.submit([&executed] { ++executed; }, counter);
+        jobSystem.wait(counter);
+
+        EXPECT_TRUE(counter.isDone());
+        EXPECT_EQ(executed, 100);
+    }
+
+    TEST_F(JobSystemTest, ParallelForVisitsEveryIndexOnce) {
+        std::vector<int> visits(10000, 0);
+
+        jobSystem.parallelFor(0, visits.size(), 64, [&visits](const size_t start, const size_t end) {
+            for (size_t i = start; i < end; ++i)
+                visits[i]++;
+        });
+
+        for (const int visit : visits)
+            EXPECT_EQ(visit, 1);
+    }
+
+    TEST_F(JobSystemTest, ParallelForHandlesEmptyAndSmallRanges) {
+        int calls = 0;
+        jobSystem.parallelFor(5, 5, 16, [&calls](size_t, size_t) { calls++; });
+        EXPECT_EQ(calls, 0);
+
+        // Fits in a single chunk, so it runs inline on the calling thread
+        jobSystem.parallelFor(0, 10, 16, [&calls](const size_t start, const size_t end) {
+            EXPECT_EQ(start, 0);
+            EXPECT_EQ(end, 10);
+            calls++;
+        });
+        EXPECT_EQ(calls, 1);
+    }
+
+    TEST_F(JobSystemTest, NestedParallelForDoesNotDeadlock) {
+        std::atomic<size_t> total = 0;
+
+        jobSystem.parallelFor(0, 64, 1, [this, &total](size_t, size_t) {
+            jobSystem.parallelFor(0, 100, 10, [&total](const size_t start, const size_t end) {
+                total += end - start;
+            });
+        });
+
+        EXPECT_EQ(total, 6400);
+    }
+
+    TEST_F(JobSystemTest, WaitRethrowsJobException) {
+        EXPECT_THROW(
+            jobSystem.parallelFor(0, 100, 1, [](const size_t start, size_t) {
+                if (start == 42)
+                    throw std::runtime_error("job failed");
+            }),
+            std::runtime_error);
+    }
+
+    TEST(JobSystemNoWorkerTest, RunsEverythingOnCallingThread) {
+        JobSystem jobSystem(0);
+        EXPECT_EQ(jobSystem.getWorkerCount(), 0);
+
+        std::vector<int> values(1000);
+        jobSystem.parallelFor(0, values.size(), 10, [&values](const size_t start, const size_t end) {
+            for (size_t i = start; i < end; ++i)
+                values[i] = static_cast<int>(i);
+        });
+
+        EXPECT_EQ(std::accumulate(values.begin(), values.end(), 0), 999 * 1000 / 2);
+    }
+}
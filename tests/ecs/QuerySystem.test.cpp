@@ -22,6 +22,7 @@
 #include "Access.hpp"
 #include "../utils/comparison.hpp"
 #include "SingletonComponent.hpp"
+#include <algorithm>
 #include <memory>
 #include <string>
 #include <type_traits>
@@ -265,6 +266,59 @@ namespace parallax::ecs {
         EXPECT_FLOAT_EQ(vel.vy, 99.0f - 1.0f * (0.0f / 10.0f));
     }
 
+    // 3. System iterating through forEach instead of per-entity getComponent calls
+    class ForEachMovementSystem : public QuerySystem<Write<Position>, Read<Velocity>> {
+    public:
+        std::vector<Entity> visited;
+
+        void move() {
+            forEach([this](const Entity entity, Position &pos, const Velocity &vel) {
+                static_assert(std::is_same_v<decltype(pos), Position &>);
+                static_assert(std::is_same_v<decltype(vel), const Velocity &>);
+                visited.push_back(entity);
+                pos.x += vel.vx;
+                pos.y += vel.vy;
+                pos.z += vel.vz;
+            });
+        }
+    };
+
+    TEST_F(QuerySystemTest, ForEachVisitsEveryMatchingEntity) {
+        auto system = coordinator->registerQuerySystem<ForEachMovementSystem>();
+
+        system->move();
+
+        // The Position/Tag-only entity is skipped, every other entity is visited exactly once
+        ASSERT_EQ(system->visited.size(), 5);
+        std::vector<Entity> expected(entities.begin(), entities.begin() + 5);
+        std::ranges::sort(system->visited);
+        EXPECT_EQ(system->visited, expected);
+
+        for (size_t i = 0; i < 5; ++i) {
+            const Position &pos = coordinator->getComponent<Position>(entities[i]);
+            EXPECT_FLOAT_EQ(pos.x, i * 1.0f + i * 0.5f);
+            EXPECT_FLOAT_EQ(pos.y, i * 2.0f + i * 1.0f);
+            EXPECT_FLOAT_EQ(pos.z, i * 3.0f + i * 1.5f);
+        }
+        EXPECT_EQ(coordinator->getComponent<Position>(entities[5]), Position(10.0f, 20.0f, 30.0f));
+    }
+
+    TEST_F(QuerySystemTest, ForEachStampsOnlyWriteComponents) {
+        auto system = coordinator->registerQuerySystem<ForEachMovementSystem>();
+        auto positions = coordinator->getComponentArray<Position>();
+        auto velocities = coordinator->getComponentArray<Velocity>();
+
+        const Tick since = coordinator->advanceTick();
+        coordinator->advanceTick();
+        system->move();
+
+        for (size_t i = 0; i < 5; ++i) {
+            EXPECT_TRUE(positions->isChangedSince(entities[i], since));
+            EXPECT_FALSE(velocities->isChangedSince(entities[i], since));
+        }
+        EXPECT_FALSE(positions->isChangedSince(entities[5], since));
+    }
+
     TEST_F(QuerySystemTest, AccessingMissingComponent) {
         auto system = coordinator->registerQuerySystem<MovementSystem>();
 
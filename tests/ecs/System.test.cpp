@@ -222,4 +222,42 @@ namespace parallax::ecs {
         EXPECT_FALSE(querySystem->entities.contains(entity));
         EXPECT_TRUE(otherSystem->entities.contains(entity));
     }
+
+    TEST_F(SystemImplementationTest, SignatureChangesOnlyEvaluateReferencingSystems) {
+        class BitOneQuerySystem : public AQuerySystem {
+        public:
+            const Signature& getSignature() const override { return signature; }
+            Signature signature{0b010};
+        };
+        class BitsOneTwoQuerySystem : public AQuerySystem {
+        public:
+            const Signature& getSignature() const override { return signature; }
+            Signature signature{0b110};
+        };
+        auto bitOneSystem = systemManager.registerQuerySystem<BitOneQuerySystem>();
+        auto bitsOneTwoSystem = systemManager.registerQuerySystem<BitsOneTwoQuerySystem>();
+
+        // Adding component 1 concerns two of the three systems
+        systemManager.entitySignatureChanged(1, Signature{0b001}, Signature{0b011});
+        EXPECT_EQ(systemManager.getSignatureEvaluationCount(), 2u);
+        EXPECT_TRUE(bitOneSystem->entities.contains(1));
+        EXPECT_FALSE(bitsOneTwoSystem->entities.contains(1));
+
+        // A system referencing several changed bits is still evaluated once
+        systemManager.resetSignatureEvaluationCount();
+        systemManager.entitySignatureChanged(2, Signature{}, Signature{0b110});
+        EXPECT_EQ(systemManager.getSignatureEvaluationCount(), 2u);
+        EXPECT_TRUE(bitsOneTwoSystem->entities.contains(2));
+        EXPECT_FALSE(querySystem->entities.contains(2));
+
+        // Components no system references cost nothing
+        systemManager.resetSignatureEvaluationCount();
+        systemManager.entitySignatureChanged(2, Signature{0b110}, Signature{0b1110});
+        EXPECT_EQ(systemManager.getSignatureEvaluationCount(), 0u);
+
+        systemManager.resetSignatureEvaluationCount();
+        systemManager.entityDestroyed(1, Signature{0b011});
+        EXPECT_EQ(systemManager.getSignatureEvaluationCount(), 3u);
+        EXPECT_FALSE(bitOneSystem->entities.contains(1));
+    }
 }
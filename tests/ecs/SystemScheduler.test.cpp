@@ -0,0 +1,139 @@
+//// SystemScheduler.test.cpp /////////////////////////////////////////////////
+//
+// ⢀⢀⢀⣤⣤⣤⡀⢀⢀⢀⢀⢀⢀⢠⣤⡄⢀⢀⢀⢀⣠⣤⣤⣤⣤⣤⣤⣤⣤⣤⡀⢀⢀⢀⢠⣤⣄⢀⢀⢀⢀⢀⢀⢀⣤⣤⢀⢀⢀⢀⢀⢀⢀⢀⣀⣄⢀⢀⢠⣄⣀⢀⢀⢀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⣿⣷⡀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡟⡛⡛⡛⡛⡛⡛⡛⢁⢀⢀⢀⢀⢻⣿⣦⢀⢀⢀⢀⢠⣾⡿⢃⢀⢀⢀⢀⢀⣠⣾⣿⢿⡟⢀⢀⡙⢿⢿⣿⣦⡀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⡛⣿⣷⡀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡙⣿⡷⢀⢀⣰⣿⡟⢁⢀⢀⢀⢀⢀⣾⣿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⣿⡆⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⡈⢿⣷⡄⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣇⣀⣀⣀⣀⣀⣀⣀⢀⢀⢀⢀⢀⢀⢀⡈⢀⢀⣼⣿⢏⢀⢀⢀⢀⢀⢀⣼⣿⡏⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡘⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⡈⢿⣿⡄⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣿⢿⢿⢿⢿⢿⢿⢿⢇⢀⢀⢀⢀⢀⢀⢀⢠⣾⣿⣧⡀⢀⢀⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⡈⢿⣿⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣰⣿⡟⡛⣿⣷⡄⢀⢀⢀⢀⢀⢿⣿⣇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⡈⢿⢀⢀⢸⣿⡇⢀⢀⢀⢀⡛⡟⢁⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⡟⢀⢀⡈⢿⣿⣄⢀⢀⢀⢀⡘⣿⣿⣄⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⢏⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⢀⣀⣀⣀⣀⣀⣀⣀⣀⣀⡀⢀⢀⢀⣠⣾⡿⢃⢀⢀⢀⢀⢀⢻⣿⣧⡀⢀⢀⢀⡈⢻⣿⣷⣦⣄⢀⢀⣠⣤⣶⣿⡿⢋⢀⢀⢀⢀
+// ⢀⢀⢀⢿⢿⢀⢀⢀⢀⢀⢀⢀⢀⢸⢿⢃⢀⢀⢀⢀⢻⢿⢿⢿⢿⢿⢿⢿⢿⢿⢃⢀⢀⢀⢿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⡗⢀⢀⢀⢀⢀⡈⡉⡛⡛⢀⢀⢹⡛⢋⢁⢀⢀⢀⢀⢀⢀
+//
+//  Author:      Parallax Engine Team
+//  Date:        16/10/2026
+//  Description: Test file for the access-driven system scheduler
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+#include "SystemScheduler.hpp"
+#include "ECSExceptions.hpp"
+
+namespace parallax::ecs {
+
+    struct SchedPosition { float x = 0.0f; };
+    struct SchedVelocity { float x = 0.0f; };
+    struct SchedContext {
+        struct CamerasPart {};
+        struct LightsPart {};
+    };
+
+    class SystemSchedulerTest : public ::testing::Test {
+    protected:
+        SystemScheduler scheduler;
+        JobSystem jobSystem{3};
+        std::mutex orderMutex;
+        std::vector<std::string> order;
+
+        std::function<void()> record(const std::string &name)
+        {
+            return [this, name] {
+                std::lock_guard lock(orderMutex);
+                order.push_back(name);
+            };
+        }
+
+        [[nodiscard]] size_t indexOf(const std::string &name) const
+        {
+            return static_cast<size_t>(std::ranges::find(order, name) - order.begin());
+        }
+    };
+
+    TEST_F(SystemSchedulerTest, ConflictingAccessCreatesDependency) {
+        const auto writer = scheduler.addSystem("Writer", SystemAccess::from<Write<SchedPosition>>(), record("Writer"));
+        const auto reader = scheduler.addSystem("Reader", SystemAccess::from<Read<SchedPosition>>(), record("Reader"));
+        const auto other = scheduler.addSystem("Other", SystemAccess::from<Write<SchedVelocity>>(), record("Other"));
+
+        EXPECT_EQ(scheduler.getDependencies(reader), std::vector<SystemScheduler::SystemId>{writer});
+        EXPECT_TRUE(scheduler.getDependencies(other).empty());
+        ASSERT_EQ(scheduler.getStages().size(), 2);
+        EXPECT_EQ(scheduler.getStages()[0], (std::vector<SystemScheduler::SystemId>{writer, other}));
+    }
+
+    TEST_F(SystemSchedulerTest, ReadersDoNotDependOnEachOther) {
+        scheduler.addSystem("A", SystemAccess::from<Read<SchedPosition>, ReadSingleton<SchedContext>>(), record("A"));
+        scheduler.addSystem("B", SystemAccess::from<Read<SchedPosition>, ReadSingleton<SchedContext>>(), record("B"));
+
+        EXPECT_EQ(scheduler.getStages().size(), 1);
+    }
+
+    TEST_F(SystemSchedulerTest, SingletonPartsOnlyConflictWithSamePartOrWholeType) {
+        const auto cameras = scheduler.addSystem("Cameras",
+            SystemAccess::from<WriteSingleton<SchedContext, SchedContext::CamerasPart>>(), record("Cameras"));
+        const auto lights = scheduler.addSystem("Lights",
+            SystemAccess::from<WriteSingleton<SchedContext, SchedContext::LightsPart>>(), record("Lights"));
+        const auto moreLights = scheduler.addSystem("MoreLights",
+            SystemAccess::from<WriteSingleton<SchedContext, SchedContext::LightsPart>>(), record("MoreLights"));
+        const auto consumer = scheduler.addSystem("Consumer",
+            SystemAccess::from<ReadSingleton<SchedContext>>(), record("Consumer"));
+
+        EXPECT_TRUE(scheduler.getDependencies(lights).empty());
+        EXPECT_EQ(scheduler.getDependencies(moreLights), std::vector<SystemScheduler::SystemId>{lights});
+        // Transitive dependency on Lights is implied by MoreLights
+        EXPECT_EQ(scheduler.getDependencies(consumer), (std::vector<SystemScheduler::SystemId>{cameras, moreLights}));
+    }
+
+    TEST_F(SystemSchedulerTest, RunRespectsDependencies) {
+        scheduler.addSystem("Writer", SystemAccess::from<Write<SchedPosition>>(), record("Writer"));
+        scheduler.addSystem("Independent", SystemAccess::from<Write<SchedVelocity>>(), record("Independent"));
+        scheduler.addSystem("Reader", SystemAccess::from<Read<SchedPosition>, Read<SchedVelocity>>(), record("Reader"));
+
+        for (int frame = 0; frame < 50; ++frame) {
+            order.clear();
+            scheduler.run(jobSystem);
+            ASSERT_EQ(order.size(), 3);
+            EXPECT_LT(indexOf("Writer"), indexOf("Reader"));
+            EXPECT_LT(indexOf("Independent"), indexOf("Reader"));
+        }
+    }
+
+    TEST_F(SystemSchedulerTest, MainThreadSystemsRunOnCallingThread) {
+        const std::thread::id caller = std::this_thread::get_id();
+        std::atomic<bool> ranOnCaller = false;
+
+        scheduler.addSystem("Worker", SystemAccess::from<Write<SchedPosition>>(), record("Worker"));
+        scheduler.addSystem("Render", SystemAccess::from<Read<SchedPosition>>(), [&] {
+            ranOnCaller = std::this_thread::get_id() == caller;
+        }, SystemThread::Main);
+
+        scheduler.run(jobSystem);
+        EXPECT_TRUE(ranOnCaller);
+        EXPECT_NE(scheduler.describeSchedule().find("Render [main thread]"), std::string::npos);
+    }
+
+    TEST_F(SystemSchedulerTest, ExplicitDependencyAndErrors) {
+        const auto first = scheduler.addSystem("First", SystemAccess{}, record("First"));
+        const auto second = scheduler.addSystem("Second", SystemAccess{}, record("Second"));
+
+        EXPECT_THROW(scheduler.addDependency(second, first), InvalidSystemDependency);
+        scheduler.addDependency(first, second);
+        EXPECT_EQ(scheduler.getDependencies(second), std::vector<SystemScheduler::SystemId>{first});
+    }
+
+    TEST_F(SystemSchedulerTest, RunRethrowsSystemException) {
+        scheduler.addSystem("Failing", SystemAccess::from<Write<SchedPosition>>(), [] {
+            throw std::runtime_error("system failed");
+        });
+        scheduler.addSystem("After", SystemAccess::from<Read<SchedPosition>>(), record("After"));
+
+        EXPECT_THROW(scheduler.run(jobSystem), std::runtime_error);
+        EXPECT_TRUE(order.empty());
+    }
+}
@@ -0,0 +1,105 @@
+//// CullingKernel.test.cpp ///////////////////////////////////////////////////
+//
+// ⢀⢀⢀⣤⣤⣤⡀⢀⢀⢀⢀⢀⢀⢠⣤⡄⢀⢀⢀⢀⣠⣤⣤⣤⣤⣤⣤⣤⣤⣤⡀⢀⢀⢀⢠⣤⣄⢀⢀⢀⢀⢀⢀⢀⣤⣤⢀⢀⢀⢀⢀⢀⢀⢀⣀⣄⢀⢀⢠⣄⣀⢀⢀⢀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⣿⣷⡀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡟⡛⡛⡛⡛⡛⡛⡛⢁⢀⢀⢀⢀⢻⣿⣦⢀⢀⢀⢀⢠⣾⡿⢃⢀⢀⢀⢀⢀⣠⣾⣿⢿⡟⢀⢀⡙⢿⢿⣿⣦⡀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⡛⣿⣷⡀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡙⣿⡷⢀⢀⣰⣿⡟⢁⢀⢀⢀⢀⢀⣾⣿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⣿⡆⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⡈⢿⣷⡄⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣇⣀⣀⣀⣀⣀⣀⣀⢀⢀⢀⢀⢀⢀⢀⡈⢀⢀⣼⣿⢏⢀⢀⢀⢀⢀⢀⣼⣿⡏⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡘⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⡈⢿⣿⡄⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣿⢿⢿⢿⢿⢿⢿⢿⢇⢀⢀⢀⢀⢀⢀⢀⢠⣾⣿⣧⡀⢀⢀⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⡈⢿⣿⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣰⣿⡟⡛⣿⣷⡄⢀⢀⢀⢀⢀⢿⣿⣇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⡈⢿⢀⢀⢸⣿⡇⢀⢀⢀⢀⡛⡟⢁⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⡟⢀⢀⡈⢿⣿⣄⢀⢀⢀⢀⡘⣿⣿⣄⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⢏⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⢀⣀⣀⣀⣀⣀⣀⣀⣀⣀⡀⢀⢀⢀⣠⣾⡿⢃⢀⢀⢀⢀⢀⢻⣿⣧⡀⢀⢀⢀⡈⢻⣿⣷⣦⣄⢀⢀⣠⣤⣶⣿⡿⢋⢀⢀⢀⢀
+// ⢀⢀⢀⢿⢿⢀⢀⢀⢀⢀⢀⢀⢀⢸⢿⢃⢀⢀⢀⢀⢻⢿⢿⢿⢿⢿⢿⢿⢿⢿⢃⢀⢀⢀⢿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⡗⢀⢀⢀⢀⢀⡈⡉⡛⡛⢀⢀⢹⡛⢋⢁⢀⢀⢀⢀⢀⢀
+//
+//  Author:      Parallax Engine Team
+//  Date:        16/10/2026
+//  Description: Source file for the frustum culling kernel tests
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <gtest/gtest.h>
+#include "systems/CullingKernel.hpp"
+#include "renderer/RendererExceptions.hpp"
+
+#include <random>
+#include <vector>
+
+using namespace parallax;
+
+class CullingKernelTest : public ::testing::Test {
+    protected:
+        // The identity view-projection sees the [-1, 1] cube
+        const math::Frustum frustum = math::extractFrustum(glm::mat4(1.0f));
+
+        static glm::mat4x3 translation(const glm::vec3 &position)
+        {
+            glm::mat4x3 matrix(1.0f);
+            matrix[3] = position;
+            return matrix;
+        }
+
+        static math::AABB unitBox()
+        {
+            return {glm::vec3(-0.5f), glm::vec3(0.5f)};
+        }
+};
+
+TEST_F(CullingKernelTest, KeepsBoxesInsideOrCrossingTheFrustum) {
+    system::WorldBounds bounds;
+    bounds.add(unitBox(), translation({0.0f, 0.0f, 0.0f}));  // inside
+    bounds.add(unitBox(), translation({1.2f, 0.0f, 0.0f}));  // crossing the right plane
+    bounds.add(unitBox(), translation({3.0f, 0.0f, 0.0f}));  // right of the frustum
+    bounds.add(unitBox(), translation({0.0f, -3.0f, 0.0f})); // below
+    bounds.add(unitBox(), translation({0.0f, 0.0f, 3.0f}));  // past the far plane
+    bounds.add(math::AABB{}, translation({50.0f, 50.0f, 50.0f})); // unknown bounds are never culled
+
+    for (const auto path : {system::CullingKernelPath::Scalar, system::bestCullingKernelPath()}) {
+        std::vector<std::uint8_t> visible(bounds.size());
+        EXPECT_EQ(system::cullBounds(frustum, bounds, visible, path), 3u);
+        EXPECT_EQ(visible, (std::vector<std::uint8_t>{1, 1, 0, 0, 0, 1}));
+    }
+}
+
+TEST_F(CullingKernelTest, UsesTheTransformedBounds) {
+    // Scaled up, the box centered outside the frustum reaches back into it
+    glm::mat4x3 scaled = translation({2.0f, 0.0f, 0.0f});
+    scaled[0] = glm::vec3(4.0f, 0.0f, 0.0f);
+
+    system::WorldBounds bounds;
+    bounds.add(unitBox(), scaled);
+    bounds.add(unitBox(), translation({2.0f, 0.0f, 0.0f}));
+
+    std::vector<std::uint8_t> visible(bounds.size());
+    EXPECT_EQ(system::cullBounds(frustum, bounds, visible), 1u);
+    EXPECT_EQ(visible, (std::vector<std::uint8_t>{1, 0}));
+}
+
+TEST_F(CullingKernelTest, SimdPathMatchesScalarPath) {
+    std::mt19937 gen(11);
+    std::uniform_real_distribution<float> position(-4.0f, 4.0f);
+    std::uniform_real_distribution<float> size(0.01f, 2.0f);
+
+    // Not a multiple of 4, so the SIMD path also runs its scalar tail
+    system::WorldBounds bounds;
+    for (int i = 0; i < 1003; ++i) {
+        const glm::vec3 halfSize(size(gen), size(gen), size(gen));
+        bounds.add({glm::vec3(0.0f) - halfSize, halfSize}, translation({position(gen), position(gen), position(gen)}));
+    }
+
+    std::vector<std::uint8_t> scalar(bounds.size());
+    std::vector<std::uint8_t> simd(bounds.size());
+    const std::size_t scalarCount = system::cullBounds(frustum, bounds, scalar, system::CullingKernelPath::Scalar);
+    const std::size_t simdCount = system::cullBounds(frustum, bounds, simd, system::bestCullingKernelPath());
+    EXPECT_EQ(scalarCount, simdCount);
+    EXPECT_EQ(scalar, simd);
+    EXPECT_GT(scalarCount, 0u);
+    EXPECT_LT(scalarCount, bounds.size());
+}
+
+TEST_F(CullingKernelTest, VisibleTooSmallThrows) {
+    system::WorldBounds bounds;
+    bounds.add(unitBox(), translation({0.0f, 0.0f, 0.0f}));
+    bounds.add(unitBox(), translation({0.0f, 0.0f, 0.0f}));
+
+    std::vector<std::uint8_t> visible(1);
+    EXPECT_THROW(system::cullBounds(frustum, bounds, visible), renderer::NxOutOfRangeException);
+}
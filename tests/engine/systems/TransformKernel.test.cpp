@@ -0,0 +1,91 @@
+//// TransformKernel.test.cpp /////////////////////////////////////////////////
+//
+// ⢀⢀⢀⣤⣤⣤⡀⢀⢀⢀⢀⢀⢀⢠⣤⡄⢀⢀⢀⢀⣠⣤⣤⣤⣤⣤⣤⣤⣤⣤⡀⢀⢀⢀⢠⣤⣄⢀⢀⢀⢀⢀⢀⢀⣤⣤⢀⢀⢀⢀⢀⢀⢀⢀⣀⣄⢀⢀⢠⣄⣀⢀⢀⢀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⣿⣷⡀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡟⡛⡛⡛⡛⡛⡛⡛⢁⢀⢀⢀⢀⢻⣿⣦⢀⢀⢀⢀⢠⣾⡿⢃⢀⢀⢀⢀⢀⣠⣾⣿⢿⡟⢀⢀⡙⢿⢿⣿⣦⡀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⡛⣿⣷⡀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡙⣿⡷⢀⢀⣰⣿⡟⢁⢀⢀⢀⢀⢀⣾⣿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⣿⡆⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⡈⢿⣷⡄⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣇⣀⣀⣀⣀⣀⣀⣀⢀⢀⢀⢀⢀⢀⢀⡈⢀⢀⣼⣿⢏⢀⢀⢀⢀⢀⢀⣼⣿⡏⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡘⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⡈⢿⣿⡄⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣿⢿⢿⢿⢿⢿⢿⢿⢇⢀⢀⢀⢀⢀⢀⢀⢠⣾⣿⣧⡀⢀⢀⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⡈⢿⣿⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣰⣿⡟⡛⣿⣷⡄⢀⢀⢀⢀⢀⢿⣿⣇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⡈⢿⢀⢀⢸⣿⡇⢀⢀⢀⢀⡛⡟⢁⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⡟⢀⢀⡈⢿⣿⣄⢀⢀⢀⢀⡘⣿⣿⣄⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⢏⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⢀⣀⣀⣀⣀⣀⣀⣀⣀⣀⡀⢀⢀⢀⣠⣾⡿⢃⢀⢀⢀⢀⢀⢻⣿⣧⡀⢀⢀⢀⡈⢻⣿⣷⣦⣄⢀⢀⣠⣤⣶⣿⡿⢋⢀⢀⢀⢀
+// ⢀⢀⢀⢿⢿⢀⢀⢀⢀⢀⢀⢀⢀⢸⢿⢃⢀⢀⢀⢀⢻⢿⢿⢿⢿⢿⢿⢿⢿⢿⢃⢀⢀⢀⢿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⡗⢀⢀⢀⢀⢀⡈⡉⡛⡛⢀⢀⢹⡛⢋⢁⢀⢀⢀⢀⢀⢀
+//
+//  Author:      Parallax Engine Team
+//  Date:        16/10/2026
+//  Description: Source file for the transform kernel tests
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <gtest/gtest.h>
+#include "systems/TransformKernel.hpp"
+
+#define GLM_ENABLE_EXPERIMENTAL
+#include <glm/gtx/quaternion.hpp>
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+using namespace parallax;
+
+class TransformKernelTest : public ::testing::Test {
+    protected:
+        // Not a multiple of 4 nor 8, so every path also runs its scalar tail
+        static std::vector<components::TransformComponent> randomTransforms(const std::size_t count = 1003)
+        {
+            std::mt19937 gen(7);
+            std::uniform_real_distribution<float> position(-100.0f, 100.0f);
+            std::uniform_real_distribution<float> scale(0.1f, 10.0f);
+            std::uniform_real_distribution<float> unit(-1.0f, 1.0f);
+
+            std::vector<components::TransformComponent> transforms(count);
+            for (auto &transform : transforms) {
+                transform.pos = {position(gen), position(gen), position(gen)};
+                transform.size = {scale(gen), scale(gen), scale(gen)};
+                transform.quat = glm::normalize(glm::quat(unit(gen), unit(gen), unit(gen), unit(gen)));
+            }
+            return transforms;
+        }
+};
+
+TEST_F(TransformKernelTest, MatchesTheGlmComposition) {
+    auto transforms = randomTransforms();
+    system::composeLocalMatrices(transforms, system::TransformKernelPath::Scalar);
+
+    for (const auto &transform : transforms) {
+        const glm::mat4 expected = glm::translate(glm::mat4(1.0f), transform.pos) *
+                                   glm::toMat4(transform.quat) *
+                                   glm::scale(glm::mat4(1.0f), transform.size);
+        for (int column = 0; column < 4; ++column) {
+            for (int row = 0; row < 3; ++row)
+                EXPECT_NEAR(transform.localMatrix[column][row], expected[column][row], 1e-4f);
+        }
+    }
+}
+
+TEST_F(TransformKernelTest, EverySupportedPathProducesTheSameMatrices) {
+    auto reference = randomTransforms();
+    system::composeLocalMatrices(reference, system::TransformKernelPath::Scalar);
+
+    for (const auto path : {system::TransformKernelPath::Sse, system::TransformKernelPath::Avx2}) {
+        if (!system::isTransformKernelPathSupported(path))
+            continue;
+        auto transforms = randomTransforms();
+        system::composeLocalMatrices(transforms, path);
+        for (std::size_t i = 0; i < transforms.size(); ++i)
+            EXPECT_EQ(transforms[i].localMatrix, reference[i].localMatrix) << "transform " << i;
+    }
+}
+
+TEST_F(TransformKernelTest, IndexedCompositionOnlyTouchesTheListedTransforms) {
+    auto transforms = randomTransforms(20);
+    auto reference = transforms;
+    system::composeLocalMatrices(reference);
+
+    const std::vector<std::uint32_t> indices = {1, 2, 3, 5, 8, 13, 17, 18, 19};
+    system::composeLocalMatrices(transforms, indices);
+    for (std::uint32_t i = 0; i < transforms.size(); ++i) {
+        const bool listed = std::ranges::find(indices, i) != indices.end();
+        EXPECT_EQ(transforms[i].localMatrix == reference[i].localMatrix, listed) << "transform " << i;
+    }
+}
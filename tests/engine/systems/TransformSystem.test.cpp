@@ -0,0 +1,200 @@
+//// TransformSystem.test.cpp /////////////////////////////////////////////////
+//
+// ⢀⢀⢀⣤⣤⣤⡀⢀⢀⢀⢀⢀⢀⢠⣤⡄⢀⢀⢀⢀⣠⣤⣤⣤⣤⣤⣤⣤⣤⣤⡀⢀⢀⢀⢠⣤⣄⢀⢀⢀⢀⢀⢀⢀⣤⣤⢀⢀⢀⢀⢀⢀⢀⢀⣀⣄⢀⢀⢠⣄⣀⢀⢀⢀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⣿⣷⡀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡟⡛⡛⡛⡛⡛⡛⡛⢁⢀⢀⢀⢀⢻⣿⣦⢀⢀⢀⢀⢠⣾⡿⢃⢀⢀⢀⢀⢀⣠⣾⣿⢿⡟⢀⢀⡙⢿⢿⣿⣦⡀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⡛⣿⣷⡀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡙⣿⡷⢀⢀⣰⣿⡟⢁⢀⢀⢀⢀⢀⣾⣿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⣿⡆⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⡈⢿⣷⡄⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣇⣀⣀⣀⣀⣀⣀⣀⢀⢀⢀⢀⢀⢀⢀⡈⢀⢀⣼⣿⢏⢀⢀⢀⢀⢀⢀⣼⣿⡏⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡘⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⡈⢿⣿⡄⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣿⢿⢿⢿⢿⢿⢿⢿⢇⢀⢀⢀⢀⢀⢀⢀⢠⣾⣿⣧⡀⢀⢀⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⡈⢿⣿⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣰⣿⡟⡛⣿⣷⡄⢀⢀⢀⢀⢀⢿⣿⣇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⡈⢿⢀⢀⢸⣿⡇⢀⢀⢀⢀⡛⡟⢁⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⡟⢀⢀⡈⢿⣿⣄⢀⢀⢀⢀⡘⣿⣿⣄⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⢏⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⢀⣀⣀⣀⣀⣀⣀⣀⣀⣀⡀⢀⢀⢀⣠⣾⡿⢃⢀⢀⢀⢀⢀⢻⣿⣧⡀⢀⢀⢀⡈⢻⣿⣷⣦⣄⢀⢀⣠⣤⣶⣿⡿⢋⢀⢀⢀⢀
+// ⢀⢀⢀⢿⢿⢀⢀⢀⢀⢀⢀⢀⢀⢸⢿⢃⢀⢀⢀⢀⢻⢿⢿⢿⢿⢿⢿⢿⢿⢿⢃⢀⢀⢀⢿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⡗⢀⢀⢀⢀⢀⡈⡉⡛⡛⢀⢀⢹⡛⢋⢁⢀⢀⢀⢀⢀⢀
+//
+//  Author:      Parallax Engine Team
+//  Date:        16/10/2026
+//  Description: Source file for the transform system tests
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <gtest/gtest.h>
+#include "ecs/Coordinator.hpp"
+#include "math/Affine.hpp"
+#include "components/Transform.hpp"
+#include "components/SceneComponents.hpp"
+#include "components/RenderContext.hpp"
+#include "systems/TransformSystem.hpp"
+
+#include <cstring>
+#include <random>
+
+using namespace parallax;
+
+class TransformSystemTest : public ::testing::Test {
+    protected:
+        std::shared_ptr<ecs::Coordinator> coordinator;
+        std::shared_ptr<system::TransformSystem> transformSystem;
+
+        void SetUp() override {
+            coordinator = std::make_shared<ecs::Coordinator>();
+            ecs::System::coord = coordinator;
+            coordinator->init();
+            coordinator->registerComponent<components::TransformComponent>();
+            coordinator->registerComponent<components::SceneTag>();
+            coordinator->registerSingletonComponent<components::RenderContext>();
+            coordinator->getSingletonComponent<components::RenderContext>().sceneRendered = 0;
+            transformSystem = coordinator->registerQuerySystem<system::TransformSystem>();
+        }
+
+        ecs::Entity createNode(const glm::vec3 &position, const ecs::Entity parent = ecs::INVALID_ENTITY)
+        {
+            const ecs::Entity entity = coordinator->createEntity();
+            components::TransformComponent transform{};
+            transform.pos = position;
+            coordinator->addComponent(entity, transform);
+            coordinator->addComponent(entity, components::SceneTag{});
+            if (parent != ecs::INVALID_ENTITY)
+                coordinator->getHierarchy().setParent(entity, parent);
+            return entity;
+        }
+
+        glm::vec3 worldPosition(const ecs::Entity entity)
+        {
+            // Read through the array, getComponent would stamp the transform as changed
+            const glm::mat4x3 &world = coordinator->getComponentArray<components::TransformComponent>()->get(entity).worldMatrix;
+            return {world[3].x, world[3].y, world[3].z};
+        }
+
+        void move(const ecs::Entity entity, const glm::vec3 &position)
+        {
+            coordinator->getComponent<components::TransformComponent>(entity).pos = position;
+        }
+};
+
+TEST_F(TransformSystemTest, PropagatesWorldMatricesDownTheHierarchy) {
+    const ecs::Entity root = createNode({1.0f, 0.0f, 0.0f});
+    const ecs::Entity child = createNode({0.0f, 2.0f, 0.0f}, root);
+    const ecs::Entity grandChild = createNode({0.0f, 0.0f, 3.0f}, child);
+    const ecs::Entity standalone = createNode({4.0f, 0.0f, 0.0f});
+
+    transformSystem->update();
+
+    EXPECT_EQ(worldPosition(root), glm::vec3(1.0f, 0.0f, 0.0f));
+    EXPECT_EQ(worldPosition(child), glm::vec3(1.0f, 2.0f, 0.0f));
+    EXPECT_EQ(worldPosition(grandChild), glm::vec3(1.0f, 2.0f, 3.0f));
+    EXPECT_EQ(worldPosition(standalone), glm::vec3(4.0f, 0.0f, 0.0f));
+    EXPECT_EQ(transformSystem->getStats().localMatrices, 4);
+    EXPECT_EQ(transformSystem->getStats().worldMatrices, 3);
+}
+
+TEST_F(TransformSystemTest, OnlyRecomputesTheSubtreesOfChangedNodes) {
+    const ecs::Entity rootA = createNode({1.0f, 0.0f, 0.0f});
+    const ecs::Entity childA = createNode({0.0f, 1.0f, 0.0f}, rootA);
+    const ecs::Entity rootB = createNode({0.0f, 0.0f, 5.0f});
+    const ecs::Entity childB = createNode({0.0f, 1.0f, 0.0f}, rootB);
+    transformSystem->update();
+
+    transformSystem->update();
+    EXPECT_EQ(transformSystem->getStats().localMatrices, 0);
+    EXPECT_EQ(transformSystem->getStats().worldMatrices, 0);
+
+    move(childB, {0.0f, 2.0f, 0.0f});
+    transformSystem->update();
+    EXPECT_EQ(transformSystem->getStats().localMatrices, 1);
+    EXPECT_EQ(transformSystem->getStats().worldMatrices, 1);
+    EXPECT_EQ(worldPosition(childB), glm::vec3(0.0f, 2.0f, 5.0f));
+
+    // Moving a parent carries its children along without rebuilding their local matrices
+    move(rootA, {3.0f, 0.0f, 0.0f});
+    transformSystem->update();
+    EXPECT_EQ(transformSystem->getStats().localMatrices, 1);
+    EXPECT_EQ(transformSystem->getStats().worldMatrices, 2);
+    EXPECT_EQ(worldPosition(childA), glm::vec3(3.0f, 1.0f, 0.0f));
+
+    // Reparenting changes world matrices without touching any transform
+    coordinator->getHierarchy().setParent(childA, rootB);
+    transformSystem->update();
+    EXPECT_EQ(transformSystem->getStats().localMatrices, 0);
+    EXPECT_EQ(worldPosition(childA), glm::vec3(0.0f, 1.0f, 5.0f));
+}
+
+TEST_F(TransformSystemTest, UnparentingAnEntityOutsideTheHierarchyKeepsItsWorldMatrixUpdated) {
+    const ecs::Entity root = createNode({1.0f, 0.0f, 0.0f});
+    createNode({0.0f, 1.0f, 0.0f}, root);
+    const ecs::Entity standalone = createNode({4.0f, 0.0f, 0.0f});
+    transformSystem->update();
+    ASSERT_FALSE(coordinator->getHierarchy().contains(standalone));
+
+    // The editor unparents dropped entities even when they have no hierarchy node yet
+    coordinator->getHierarchy().setParent(standalone, ecs::INVALID_ENTITY);
+    ASSERT_TRUE(coordinator->getHierarchy().contains(standalone));
+    move(standalone, {0.0f, 0.0f, 6.0f});
+    transformSystem->update();
+
+    EXPECT_EQ(worldPosition(standalone), glm::vec3(0.0f, 0.0f, 6.0f));
+}
+
+TEST_F(TransformSystemTest, NodesWithoutTransformPassTheirParentMatrixDown) {
+    const ecs::Entity root = createNode({1.0f, 0.0f, 0.0f});
+    const ecs::Entity middle = createNode({0.0f, 1.0f, 0.0f}, root);
+    const ecs::Entity leaf = createNode({0.0f, 0.0f, 1.0f}, middle);
+    transformSystem->update();
+
+    coordinator->removeComponent<components::TransformComponent>(middle);
+    coordinator->flushObservers();
+    transformSystem->update();
+
+    EXPECT_EQ(worldPosition(leaf), glm::vec3(1.0f, 0.0f, 1.0f));
+}
+
+TEST_F(TransformSystemTest, LevelParallelPropagationMatchesASerialWalkBitForBit) {
+    std::mt19937 gen(3);
+    std::uniform_real_distribution<float> value(-2.0f, 2.0f);
+    const auto randomTransform = [&] {
+        components::TransformComponent transform{};
+        transform.pos = {value(gen), value(gen), value(gen)};
+        transform.size = {1.0f + value(gen) * 0.25f, 1.0f + value(gen) * 0.25f, 1.0f + value(gen) * 0.25f};
+        transform.quat = glm::normalize(glm::quat(value(gen), value(gen), value(gen), value(gen)));
+        return transform;
+    };
+
+    // Wide and deep forest, some nodes without a transform
+    std::vector<ecs::Entity> nodes;
+    for (int i = 0; i < 4000; ++i) {
+        const ecs::Entity entity = coordinator->createEntity();
+        coordinator->addComponent(entity, components::SceneTag{});
+        if (i % 17 != 0)
+            coordinator->addComponent(entity, randomTransform());
+        if (i >= 8)
+            coordinator->getHierarchy().setParent(entity, nodes[std::uniform_int_distribution<std::size_t>(0, nodes.size() - 1)(gen)]);
+        nodes.push_back(entity);
+    }
+
+    const auto expectSerialResult = [&] {
+        const ecs::Hierarchy &hierarchy = coordinator->getHierarchy();
+        const auto transforms = coordinator->getComponentArray<components::TransformComponent>();
+        std::vector<glm::mat4x3> expected(hierarchy.size());
+        for (std::size_t node = 0; node < hierarchy.size(); ++node) {
+            const std::uint32_t parent = hierarchy.parents()[node];
+            const ecs::Entity entity = hierarchy.entities()[node];
+            if (!transforms->hasComponent(entity)) {
+                expected[node] = parent == ecs::Hierarchy::NO_PARENT ? glm::mat4x3(1.0f) : expected[parent];
+                continue;
+            }
+            const auto &transform = transforms->get(entity);
+            expected[node] = parent == ecs::Hierarchy::NO_PARENT ? transform.localMatrix : math::composeAffine(expected[parent], transform.localMatrix);
+            EXPECT_EQ(std::memcmp(&transform.worldMatrix, &expected[node], sizeof(glm::mat4x3)), 0) << "entity " << entity;
+        }
+    };
+
+    transformSystem->update();
+    expectSerialResult();
+
+    // Dirty propagation only, the hierarchy keeps its shape
+    for (int i = 0; i < 50; ++i) {
+        const ecs::Entity entity = nodes[std::uniform_int_distribution<std::size_t>(0, nodes.size() - 1)(gen)];
+        if (coordinator->getComponentArray<components::TransformComponent>()->hasComponent(entity))
+            move(entity, {value(gen), value(gen), value(gen)});
+    }
+    transformSystem->update();
+    expectSerialResult();
+}
@@ -299,6 +299,37 @@ TEST_F(RenderPipelineTest, DrawCommandsManagement) {
     EXPECT_TRUE(pipeline.getDrawCommands().empty());
 }
 
+TEST_F(RenderPipelineTest, DrawCommandsSortedBeforePasses) {
+    auto pass = createMockPass("Pass1");
+    pipeline.addRenderPass(pass);
+    pipeline.setRenderTarget(createMockFramebuffer());
+    pipeline.setCameraPosition({0.0f, 0.0f, 0.0f});
+
+    auto makeCommand = [](const float z, const bool isOpaque, const uint32_t filterMask) {
+        DrawCommand cmd;
+        cmd.worldPosition = {0.0f, 0.0f, z};
+        cmd.isOpaque = isOpaque;
+        cmd.filterMask = filterMask;
+        return cmd;
+    };
+    // Commands are identified by their depth
+    pipeline.addDrawCommand(makeCommand(-5.0f, true, 1 << 1));
+    pipeline.addDrawCommand(makeCommand(-3.0f, false, 1 << 0));
+    pipeline.addDrawCommand(makeCommand(-10.0f, true, 1 << 0));
+    pipeline.addDrawCommand(makeCommand(-30.0f, false, 1 << 0));
+    pipeline.addDrawCommand(makeCommand(-1.0f, true, 1 << 0));
+
+    std::vector<float> executedDepths;
+    EXPECT_CALL(*pass, execute(::testing::_)).WillOnce([&executedDepths](RenderPipeline &p) {
+        for (const DrawCommand &cmd : p.getDrawCommands())
+            executedDepths.push_back(cmd.worldPosition.z);
+    });
+    pipeline.execute();
+
+    // Opaque front to back, translucent back to front, then the commands of the next pass
+    EXPECT_EQ(executedDepths, (std::vector<float>{-1.0f, -10.0f, -30.0f, -3.0f, -5.0f}));
+}
+
 TEST_F(RenderPipelineTest, CameraClearColor) {
     glm::vec4 clearColor(0.1f, 0.2f, 0.3f, 1.0f);
 
@@ -109,4 +109,50 @@ namespace parallax::renderer {
 	    renderer3D->init();
 	}
 
+    TEST_F(Renderer3DTest, MaterialsAreIndexedUntilReset)
+    {
+        const int firstKey = 0;
+        const int secondKey = 0;
+        NxIndexedMaterial red;
+        red.albedoColor = {1.0f, 0.0f, 0.0f, 1.0f};
+        NxIndexedMaterial green;
+        green.albedoColor = {0.0f, 1.0f, 0.0f, 1.0f};
+
+        EXPECT_EQ(renderer3D->findMaterial(&firstKey), -1);
+        EXPECT_EQ(renderer3D->addMaterial(&firstKey, red), 0);
+        EXPECT_EQ(renderer3D->addMaterial(&secondKey, green), 1);
+        EXPECT_EQ(renderer3D->findMaterial(&firstKey), 0);
+        EXPECT_EQ(renderer3D->findMaterial(&secondKey), 1);
+        EXPECT_NO_THROW(renderer3D->bindMaterials());
+
+        renderer3D->resetMaterials();
+        EXPECT_EQ(renderer3D->findMaterial(&firstKey), -1);
+        EXPECT_EQ(renderer3D->addMaterial(&secondKey, green), 0);
+    }
+
+    TEST_F(Renderer3DTest, UploadUniformBlock)
+    {
+        const std::array<glm::vec4, 2> block = {glm::vec4(1.0f), glm::vec4(2.0f)};
+
+        EXPECT_NO_THROW(renderer3D->uploadUniformBlock(0, block.data(), sizeof(glm::vec4)));
+        // A bigger block reallocates the buffer of the binding
+        EXPECT_NO_THROW(renderer3D->uploadUniformBlock(0, block.data(), sizeof(block)));
+        EXPECT_THROW(renderer3D->uploadUniformBlock(NxRenderer3DStorage::maxUniformBlocks, block.data(), sizeof(block)),
+                     NxOutOfRangeException);
+    }
+
+    TEST_F(Renderer3DTest, InstancesAreAppendedUntilReset)
+    {
+        std::array<NxInstanceData, 3> instances;
+        for (int i = 0; i < 3; ++i)
+            instances[i].entityId = i;
+
+        EXPECT_EQ(renderer3D->addInstances(std::span(instances).first(2)), 0u);
+        EXPECT_EQ(renderer3D->addInstances(instances), 2u);
+        EXPECT_NO_THROW(renderer3D->bindInstances());
+
+        renderer3D->resetInstances();
+        EXPECT_EQ(renderer3D->addInstances(instances), 0u);
+    }
+
 }
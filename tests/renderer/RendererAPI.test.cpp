@@ -117,10 +117,12 @@ namespace parallax::renderer {
 
         auto vertexArray = std::make_shared<NxOpenGlVertexArray>();
         EXPECT_THROW(rendererApi.drawIndexed(vertexArray), NxGraphicsApiNotInitialized);
+        EXPECT_THROW(rendererApi.drawIndexedInstanced(vertexArray, 0, 2), NxGraphicsApiNotInitialized);
 
         // Validate exception is thrown when passing a null vertex array
         rendererApi.init();
         EXPECT_THROW(rendererApi.drawIndexed(nullptr), NxInvalidValue);
+        EXPECT_THROW(rendererApi.drawIndexedInstanced(nullptr, 0, 2), NxInvalidValue);
     }
 
 }
@@ -319,4 +319,38 @@ namespace parallax::renderer {
         shader.unbind();
     }
 
+    TEST_F(ShaderTest, UniformHandlesResolveToReflectedLocations)
+    {
+        NxOpenGlShader shader("TestShader", vertexShaderSource, fragmentShaderSource);
+        UniformRegistry &registry = UniformRegistry::getInstance();
+
+        // Reflection interned the names of the program
+        const UniformHandle colorHandle = registry.find("uColor");
+        ASSERT_NE(colorHandle, INVALID_UNIFORM_HANDLE);
+        EXPECT_EQ(registry.getName(colorHandle), "uColor");
+        EXPECT_EQ(registry.intern("uColor"), colorHandle);
+
+        const int colorLocation = shader.getUniformLocation(colorHandle);
+        EXPECT_EQ(colorLocation, glGetUniformLocation(shader.getProgramId(), "uColor"));
+        EXPECT_EQ(shader.getUniformLocation(registry.find("uModel")),
+                  glGetUniformLocation(shader.getProgramId(), "uModel"));
+
+        // Names the program does not use resolve to -1
+        EXPECT_EQ(shader.getUniformLocation(registry.intern("uNotInThisShader")), -1);
+        EXPECT_EQ(shader.getUniformLocation(INVALID_UNIFORM_HANDLE), -1);
+
+        shader.bind();
+        const glm::vec4 color(0.1f, 0.2f, 0.3f, 0.4f);
+        EXPECT_TRUE(shader.setUniformAt(colorLocation, color));
+        EXPECT_FALSE(shader.setUniformAt(-1, color));
+
+        GLfloat retrievedColor[4] = {};
+        glGetUniformfv(shader.getProgramId(), colorLocation, retrievedColor);
+        EXPECT_FLOAT_EQ(retrievedColor[0], color.x);
+        EXPECT_FLOAT_EQ(retrievedColor[1], color.y);
+        EXPECT_FLOAT_EQ(retrievedColor[2], color.z);
+        EXPECT_FLOAT_EQ(retrievedColor[3], color.w);
+        shader.unbind();
+    }
+
 }
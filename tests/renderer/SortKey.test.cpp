@@ -0,0 +1,96 @@
+//// SortKey.test.cpp /////////////////////////////////////////////////////////
+//
+// ⢀⢀⢀⣤⣤⣤⡀⢀⢀⢀⢀⢀⢀⢠⣤⡄⢀⢀⢀⢀⣠⣤⣤⣤⣤⣤⣤⣤⣤⣤⡀⢀⢀⢀⢠⣤⣄⢀⢀⢀⢀⢀⢀⢀⣤⣤⢀⢀⢀⢀⢀⢀⢀⢀⣀⣄⢀⢀⢠⣄⣀⢀⢀⢀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⣿⣷⡀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡟⡛⡛⡛⡛⡛⡛⡛⢁⢀⢀⢀⢀⢻⣿⣦⢀⢀⢀⢀⢠⣾⡿⢃⢀⢀⢀⢀⢀⣠⣾⣿⢿⡟⢀⢀⡙⢿⢿⣿⣦⡀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⡛⣿⣷⡀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡙⣿⡷⢀⢀⣰⣿⡟⢁⢀⢀⢀⢀⢀⣾⣿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⣿⡆⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⡈⢿⣷⡄⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣇⣀⣀⣀⣀⣀⣀⣀⢀⢀⢀⢀⢀⢀⢀⡈⢀⢀⣼⣿⢏⢀⢀⢀⢀⢀⢀⣼⣿⡏⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡘⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⡈⢿⣿⡄⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣿⢿⢿⢿⢿⢿⢿⢿⢇⢀⢀⢀⢀⢀⢀⢀⢠⣾⣿⣧⡀⢀⢀⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⡈⢿⣿⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣰⣿⡟⡛⣿⣷⡄⢀⢀⢀⢀⢀⢿⣿⣇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⡈⢿⢀⢀⢸⣿⡇⢀⢀⢀⢀⡛⡟⢁⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⡟⢀⢀⡈⢿⣿⣄⢀⢀⢀⢀⡘⣿⣿⣄⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⢏⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⢀⣀⣀⣀⣀⣀⣀⣀⣀⣀⡀⢀⢀⢀⣠⣾⡿⢃⢀⢀⢀⢀⢀⢻⣿⣧⡀⢀⢀⢀⡈⢻⣿⣷⣦⣄⢀⢀⣠⣤⣶⣿⡿⢋⢀⢀⢀⢀
+// ⢀⢀⢀⢿⢿⢀⢀⢀⢀⢀⢀⢀⢀⢸⢿⢃⢀⢀⢀⢀⢻⢿⢿⢿⢿⢿⢿⢿⢿⢿⢃⢀⢀⢀⢿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⡗⢀⢀⢀⢀⢀⡈⡉⡛⡛⢀⢀⢹⡛⢋⢁⢀⢀⢀⢀⢀⢀
+//
+//  Author:      Parallax Engine Team
+//  Date:        16/10/2026
+//  Description: Test file for the draw command sort keys
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <random>
+#include <vector>
+
+#include "SortKey.hpp"
+#include "RendererExceptions.hpp"
+
+namespace parallax::renderer {
+
+    class SortKeyTest : public ::testing::Test {
+        protected:
+            static std::vector<std::uint32_t> sortedIndices(std::vector<SortEntry> entries)
+            {
+                std::vector<SortEntry> scratch(entries.size());
+                radixSort(entries, scratch);
+                std::vector<std::uint32_t> indices;
+                for (const SortEntry &entry : entries)
+                    indices.push_back(entry.index);
+                return indices;
+            }
+    };
+
+    TEST_F(SortKeyTest, PassComesFirst)
+    {
+        EXPECT_LT(makeSortKey(0, false, 900, 900, 900, 1000.0f), makeSortKey(1, true, 1, 0, 1, 0.0f));
+    }
+
+    TEST_F(SortKeyTest, OpaqueBeforeTranslucent)
+    {
+        EXPECT_LT(makeSortKey(0, true, 900, 900, 900, 1000.0f), makeSortKey(0, false, 1, 0, 1, 0.0f));
+    }
+
+    TEST_F(SortKeyTest, OpaqueGroupedByStateThenFrontToBack)
+    {
+        EXPECT_LT(makeSortKey(0, true, 1, 0, 1, 1000.0f), makeSortKey(0, true, 2, 0, 1, 1.0f));
+        EXPECT_LT(makeSortKey(0, true, 1, 0, 1, 1000.0f), makeSortKey(0, true, 1, 1, 1, 1.0f));
+        EXPECT_LT(makeSortKey(0, true, 1, 0, 1, 1.0f), makeSortKey(0, true, 1, 0, 1, 4.0f));
+    }
+
+    TEST_F(SortKeyTest, TranslucentBackToFrontThenState)
+    {
+        EXPECT_LT(makeSortKey(0, false, 2, 5, 3, 100.0f), makeSortKey(0, false, 1, 0, 1, 4.0f));
+        EXPECT_LT(makeSortKey(0, false, 1, 0, 1, 4.0f), makeSortKey(0, false, 2, 0, 1, 4.0f));
+    }
+
+    TEST_F(SortKeyTest, RadixSortOrdersByKeyAndIsStable)
+    {
+        const std::vector<SortEntry> entries = {{30, 0}, {10, 1}, {20, 2}, {10, 3}, {SortKey{1} << 62, 4}, {0, 5}};
+        EXPECT_EQ(sortedIndices(entries), (std::vector<std::uint32_t>{5, 1, 3, 2, 0, 4}));
+    }
+
+    TEST_F(SortKeyTest, RadixSortMatchesStableSort)
+    {
+        std::mt19937_64 generator(7);
+        std::vector<SortEntry> entries;
+        for (std::uint32_t i = 0; i < 5000; ++i) {
+            const bool isOpaque = generator() % 2 == 0;
+            entries.push_back({makeSortKey(static_cast<unsigned int>(generator() % 4), isOpaque,
+                                           static_cast<unsigned int>(generator() % 8), static_cast<unsigned int>(generator() % 16),
+                                           static_cast<unsigned int>(generator() % 8), static_cast<float>(generator() % 10000) * 0.1f), i});
+        }
+        std::vector<SortEntry> expected = entries;
+        std::ranges::stable_sort(expected, {}, &SortEntry::key);
+
+        std::vector<std::uint32_t> expectedIndices;
+        for (const SortEntry &entry : expected)
+            expectedIndices.push_back(entry.index);
+        EXPECT_EQ(sortedIndices(entries), expectedIndices);
+    }
+
+    TEST_F(SortKeyTest, RadixSortRejectsSmallScratch)
+    {
+        std::vector<SortEntry> entries(4);
+        std::vector<SortEntry> scratch(2);
+        EXPECT_THROW(radixSort(entries, scratch), NxOutOfRangeException);
+    }
+}